@@ -0,0 +1,515 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_ADLER32_H
+#define CHOCOBO1_ADLER32_H
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
+// SSSE3 & AVX2 kernels, chosen at run time when the CPU supports them
+// define `USE_X86_SIMD_CHOCOBO1_HASH` to 0 to always use the portable code
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#if (defined(__x86_64__) || defined(_M_X64))
+#if defined(__has_builtin)
+#if (__has_builtin(__builtin_is_constant_evaluated) && __has_builtin(__builtin_cpu_supports))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#elif (defined(_MSC_VER) && (_MSC_VER >= 1925))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#endif
+#endif
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#define USE_X86_SIMD_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_SSSE3_CHOCOBO1_HASH
+#define TARGET_AVX2_CHOCOBO1_HASH
+#else
+#define TARGET_SSSE3_CHOCOBO1_HASH __attribute__((target("ssse3")))
+#define TARGET_AVX2_CHOCOBO1_HASH __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+#endif
+
+// with the prebuilt library, kernels are defined there only
+#ifndef INLINE_KERNEL_CHOCOBO1_HASH
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+#define INLINE_KERNEL_CHOCOBO1_HASH
+#else
+#define INLINE_KERNEL_CHOCOBO1_HASH inline
+#endif
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// Adler32();
+
+	// Adler32::combine(adlerA, adlerB, lengthB);  // merge checksums of adjacent segments, e.g. computed in parallel
+
+	// "abc"_adler32;  // C++20, digest as `Adler32::ResultArrayType` computed at compile time
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+#ifndef CONSTEXPR_CPP17_CHOCOBO1_HASH
+#if __cplusplus >= 201703L
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH constexpr
+#else
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH
+#endif
+#endif
+
+#ifndef CHOCOBO1_HASH_ROR_IMPL
+#define CHOCOBO1_HASH_ROR_IMPL
+	template <typename R, typename T>
+	constexpr R ror(const T x, const unsigned int s)
+	{
+		static_assert(std::is_unsigned<R>::value, "");
+		static_assert(std::is_unsigned<T>::value, "");
+		return static_cast<R>(x >> s);
+	}
+#endif
+
+
+namespace ADLER32_NS
+{
+	// largest number of bytes before `b` may overflow 32 bits, so the modulo is deferred until then
+	constexpr uint32_t MOD = 65521;
+	constexpr std::size_t NMAX = 5552;
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+	struct CpuFeatures
+	{
+		bool ssse3 = false;
+		bool avx2 = false;
+	};
+
+#if ((USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1) && !defined(BUILD_LIBRARY_CHOCOBO1_HASH))
+	const CpuFeatures& cpuFeatures();
+	TARGET_SSSE3_CHOCOBO1_HASH
+	void blocksSsse3(uint32_t &a, uint32_t &b, const uint8_t *&ptr, std::size_t &remaining);
+	TARGET_AVX2_CHOCOBO1_HASH
+	void blocksAvx2(uint32_t &a, uint32_t &b, const uint8_t *&ptr, std::size_t &remaining);
+#else
+	INLINE_KERNEL_CHOCOBO1_HASH const CpuFeatures& cpuFeatures()
+	{
+		static const CpuFeatures ret = []() -> CpuFeatures
+		{
+			CpuFeatures features;
+#ifdef _MSC_VER
+			int info[4] = {};
+			__cpuid(info, 1);
+			features.ssse3 = ((info[2] & (1 << 9)) != 0);
+			const bool osAvx = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 0x6) == 0x6);
+			__cpuidex(info, 7, 0);
+			features.avx2 = osAvx && ((info[1] & (1 << 5)) != 0);
+#else
+			__builtin_cpu_init();
+			features.ssse3 = (__builtin_cpu_supports("ssse3") != 0);
+			features.avx2 = (__builtin_cpu_supports("avx2") != 0);
+#endif
+			return features;
+		}();
+		return ret;
+	}
+
+	// Both kernels consume whole 32-byte blocks & leave the rest to the portable code.
+	// Per block: `a` gains the byte sum (`psadbw`), `b` gains 32 * (`a` before the block) plus the
+	// bytes weighted 32, 31, ..., 1 (`pmaddubsw` then `pmaddwd`). The 32 * `a` terms are collected in
+	// `prevSums` & shifted in once per `NMAX` bytes, which is also when the modulo happens.
+
+	TARGET_SSSE3_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void blocksSsse3(uint32_t &a, uint32_t &b, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m128i tapsHigh = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+		const __m128i tapsLow = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+		const __m128i ones = _mm_set1_epi16(1);
+		const __m128i zero = _mm_setzero_si128();
+
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min(remaining, (NMAX / 32 * 32)) / 32;
+			remaining -= (blocks * 32);
+
+			__m128i prevSums = _mm_cvtsi32_si128(static_cast<int>(a * blocks));
+			__m128i sumA = zero;
+			__m128i sumB = _mm_cvtsi32_si128(static_cast<int>(b));
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m128i bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+				const __m128i bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 16));
+
+				prevSums = _mm_add_epi32(prevSums, sumA);
+				sumA = _mm_add_epi32(sumA, _mm_add_epi32(_mm_sad_epu8(bytes1, zero), _mm_sad_epu8(bytes2, zero)));
+				sumB = _mm_add_epi32(sumB, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tapsHigh), ones));
+				sumB = _mm_add_epi32(sumB, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tapsLow), ones));
+			}
+			sumB = _mm_add_epi32(sumB, _mm_slli_epi32(prevSums, 5));
+
+			sumA = _mm_add_epi32(sumA, _mm_shuffle_epi32(sumA, _MM_SHUFFLE(1, 0, 3, 2)));
+			sumB = _mm_add_epi32(sumB, _mm_shuffle_epi32(sumB, _MM_SHUFFLE(2, 3, 0, 1)));
+			sumB = _mm_add_epi32(sumB, _mm_shuffle_epi32(sumB, _MM_SHUFFLE(1, 0, 3, 2)));
+			a = (a + static_cast<uint32_t>(_mm_cvtsi128_si32(sumA))) % MOD;
+			b = static_cast<uint32_t>(_mm_cvtsi128_si32(sumB)) % MOD;
+		}
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void blocksAvx2(uint32_t &a, uint32_t &b, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m256i taps = _mm256_setr_epi8(
+			32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+			16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+		const __m256i ones = _mm256_set1_epi16(1);
+		const __m256i zero = _mm256_setzero_si256();
+
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min(remaining, (NMAX / 32 * 32)) / 32;
+			remaining -= (blocks * 32);
+
+			__m256i prevSums = _mm256_setr_epi32(static_cast<int>(a * blocks), 0, 0, 0, 0, 0, 0, 0);
+			__m256i sumA = zero;
+			__m256i sumB = _mm256_setr_epi32(static_cast<int>(b), 0, 0, 0, 0, 0, 0, 0);
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+
+				prevSums = _mm256_add_epi32(prevSums, sumA);
+				sumA = _mm256_add_epi32(sumA, _mm256_sad_epu8(bytes, zero));
+				sumB = _mm256_add_epi32(sumB, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, taps), ones));
+			}
+			sumB = _mm256_add_epi32(sumB, _mm256_slli_epi32(prevSums, 5));
+
+			__m128i sumA128 = _mm_add_epi32(_mm256_castsi256_si128(sumA), _mm256_extracti128_si256(sumA, 1));
+			__m128i sumB128 = _mm_add_epi32(_mm256_castsi256_si128(sumB), _mm256_extracti128_si256(sumB, 1));
+			sumA128 = _mm_add_epi32(sumA128, _mm_shuffle_epi32(sumA128, _MM_SHUFFLE(1, 0, 3, 2)));
+			sumB128 = _mm_add_epi32(sumB128, _mm_shuffle_epi32(sumB128, _MM_SHUFFLE(2, 3, 0, 1)));
+			sumB128 = _mm_add_epi32(sumB128, _mm_shuffle_epi32(sumB128, _MM_SHUFFLE(1, 0, 3, 2)));
+			a = (a + static_cast<uint32_t>(_mm_cvtsi128_si32(sumA128))) % MOD;
+			b = static_cast<uint32_t>(_mm_cvtsi128_si32(sumB128)) % MOD;
+		}
+	}
+#endif
+#endif
+
+
+	class Adler32
+	{
+		// https://datatracker.ietf.org/doc/html/rfc1950#section-8
+
+		public:
+			using Byte = uint8_t;
+			using ValueType = uint32_t;
+			using ResultArrayType = std::array<Byte, 4>;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+
+			constexpr Adler32();
+
+			constexpr void reset();
+			constexpr Adler32& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toString()`, `toValue()`, `toVector()` are available
+
+			std::string toString() const;
+			std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP17_CHOCOBO1_HASH ResultArrayType toArray() const;
+			constexpr ValueType toValue() const;
+			template <typename T>
+			CONSTEXPR_CPP17_CHOCOBO1_HASH operator T() const noexcept;
+
+			constexpr Adler32& addData(Span<const Byte> inData);
+			constexpr Adler32& addData(const void *ptr, std::size_t length);
+			template <std::size_t N>
+			constexpr Adler32& addData(const Byte (&array)[N]);
+			template <typename T, std::size_t N>
+			Adler32& addData(const T (&array)[N]);
+			template <typename T>
+			Adler32& addData(Span<T> inSpan);
+
+			// value of the concatenation, from the values of both parts & the length of the second part
+			static constexpr ValueType combine(ValueType adlerA, ValueType adlerB, uint64_t lengthB);
+
+			friend constexpr bool operator==(const Adler32 &left, const Adler32 &right)
+			{
+				return (left.m_a == right.m_a) && (left.m_b == right.m_b);
+			}
+			friend constexpr bool operator!=(const Adler32 &left, const Adler32 &right)
+			{
+				return !(left == right);
+			}
+
+		private:
+			constexpr void addDataImpl(Span<const Byte> data);
+			constexpr void addDataPortable(const Byte *ptr, std::size_t remaining);
+
+			uint32_t m_a = 1;
+			uint32_t m_b = 0;
+	};
+
+
+	//
+	constexpr Adler32::Adler32()
+	{
+		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+
+		reset();
+	}
+
+	constexpr void Adler32::reset()
+	{
+		m_a = 1;
+		m_b = 0;
+	}
+
+	constexpr Adler32& Adler32::finalize()
+	{
+		return (*this);
+	}
+
+	inline std::string Adler32::toString() const
+	{
+		const auto digest = toArray();
+		std::string ret;
+		ret.resize(2 * digest.size());
+
+		auto *retPtr = &ret.front();
+		for (const auto c : digest)
+		{
+			const Byte upper = ror<Byte>(c, 4);
+			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
+
+			const Byte lower = c & 0xf;
+			*(retPtr++) = static_cast<char>((lower < 10) ? (lower + '0') : (lower - 10 + 'a'));
+		}
+
+		return ret;
+	}
+
+	inline std::vector<Adler32::Byte> Adler32::toVector() const
+	{
+		const auto digest = toArray();
+		return {digest.begin(), digest.end()};
+	}
+
+	CONSTEXPR_CPP17_CHOCOBO1_HASH inline Adler32::ResultArrayType Adler32::toArray() const
+	{
+		// big endian, as stored in zlib streams
+		const ValueType value = toValue();
+		return {{ror<Byte>(value, 24), ror<Byte>(value, 16), ror<Byte>(value, 8), ror<Byte>(value, 0)}};
+	}
+
+	constexpr Adler32::ValueType Adler32::toValue() const
+	{
+		return ((m_b << 16) | m_a);
+	}
+
+	template <typename T>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH Adler32::operator T() const noexcept
+	{
+		static_assert(std::is_unsigned<T>::value, "");
+
+		const auto digest = toArray();
+		T ret = 0;
+		for (int i = 0, iMax = static_cast<int>(std::min(sizeof(T), digest.size())); i < iMax; ++i)
+		{
+			ret <<= 8;
+			ret |= digest[i];
+		}
+		return ret;
+	}
+
+	constexpr Adler32& Adler32::addData(const Span<const Byte> inData)
+	{
+		addDataImpl(inData);
+		return (*this);
+	}
+
+	constexpr Adler32& Adler32::addData(const void *ptr, const std::size_t length)
+	{
+		// Span::size_type = std::size_t
+		return addData({static_cast<const Byte*>(ptr), length});
+	}
+
+	template <std::size_t N>
+	constexpr Adler32& Adler32::addData(const Byte (&array)[N])
+	{
+		return addData({array, N});
+	}
+
+	template <typename T, std::size_t N>
+	Adler32& Adler32::addData(const T (&array)[N])
+	{
+		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
+	}
+
+	template <typename T>
+	Adler32& Adler32::addData(const Span<T> inSpan)
+	{
+		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
+	}
+
+	constexpr Adler32::ValueType Adler32::combine(const ValueType adlerA, const ValueType adlerB, const uint64_t lengthB)
+	{
+		// a = aA + aB - 1, b = bA + bB + n * (aA - 1)
+		// https://github.com/madler/zlib/blob/master/adler32.c `adler32_combine_()`
+		const uint32_t n = static_cast<uint32_t>(lengthB % MOD);
+		const uint32_t aA = adlerA & 0xFFFF;
+		const uint32_t bA = adlerA >> 16;
+		const uint32_t aB = adlerB & 0xFFFF;
+		const uint32_t bB = adlerB >> 16;
+
+		const uint32_t a = (aA + aB + MOD - 1) % MOD;
+		const uint32_t b = static_cast<uint32_t>((bA + bB + ((static_cast<uint64_t>(n) * (aA + MOD - 1)) % MOD)) % MOD);
+		return ((b << 16) | a);
+	}
+
+	constexpr void Adler32::addDataImpl(const Span<const Byte> data)
+	{
+		const Byte *ptr = data.data();
+		std::size_t remaining = static_cast<std::size_t>(data.size());
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+		if (!__builtin_is_constant_evaluated() && (remaining >= 64))
+		{
+			const CpuFeatures &features = cpuFeatures();
+			if (features.avx2)
+				blocksAvx2(m_a, m_b, ptr, remaining);
+			else if (features.ssse3)
+				blocksSsse3(m_a, m_b, ptr, remaining);
+		}
+#endif
+
+		addDataPortable(ptr, remaining);
+	}
+
+	constexpr void Adler32::addDataPortable(const Byte *ptr, std::size_t remaining)
+	{
+		uint32_t a = m_a;
+		uint32_t b = m_b;
+		while (remaining > 0)
+		{
+			const std::size_t size = std::min(remaining, NMAX);
+			remaining -= size;
+
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				a += ptr[i];
+				b += a;
+			}
+			ptr += size;
+
+			a %= MOD;
+			b %= MOD;
+		}
+		m_a = a;
+		m_b = b;
+	}
+}
+}
+
+	using Adler32 = Hash::ADLER32_NS::Adler32;
+}
+
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval Adler32::ResultArrayType operator""_adler32(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Adler32>(str, length);
+	}
+}
+}
+#endif
+
+namespace std
+{
+	template <>
+	struct hash<Chocobo1::Adler32>
+	{
+		CONSTEXPR_CPP17_CHOCOBO1_HASH size_t operator()(const Chocobo1::Adler32 &hash) const noexcept
+		{
+			return hash;
+		}
+	};
+}
+
+#endif  // CHOCOBO1_ADLER32_H
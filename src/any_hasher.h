@@ -0,0 +1,551 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_ANY_HASHER_H
+#define CHOCOBO1_ANY_HASHER_H
+
+#include "adler32.h"
+#include "blake1_224.h"
+#include "blake1_256.h"
+#include "blake1_384.h"
+#include "blake1_512.h"
+#include "blake2.h"
+#include "blake2s.h"
+#include "crc.h"
+#include "cshake.h"
+#include "fletcher.h"
+#include "fnv.h"
+#include "has_160.h"
+#include "highwayhash.h"
+#include "md2.h"
+#include "md4.h"
+#include "md5.h"
+#include "ripemd_128.h"
+#include "ripemd_160.h"
+#include "ripemd_256.h"
+#include "ripemd_320.h"
+#include "siphash.h"
+#include "sha1.h"
+#include "sha2_224.h"
+#include "sha2_256.h"
+#include "sha2_384.h"
+#include "sha2_512.h"
+#include "sha2_512_224.h"
+#include "sha2_512_256.h"
+#include "sha3.h"
+#include "sm3.h"
+#include "tiger.h"
+#include "whirlpool.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// AnyHasher(HashId::SHA2_256);
+	// AnyHasher("sha2-256");  // same names as the driver program, `isValid()` is false for unknown names
+	// AnyHasher(HashId::SHAKE_128, 32);  // SHAKE & CSHAKE take a digest length in bytes
+	// AnyHasher(HashId::CSHAKE_128, 32, "name", "customization");
+	// AnyHasher(SipHash(key));  // or wrap any hasher object directly
+
+	// anyHasher.addData(...).finalize().toString();  // `toVector()` for the raw digest
+
+	// TupleHash is left out: every `nextData()` call is a tuple element, unlike `addData()`
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace AnyHasher_NS
+{
+	enum class HashId : int
+	{
+		Adler32,
+		Blake1_224, Blake1_256, Blake1_384, Blake1_512,
+		Blake2, Blake2s,
+		CRC_32, CRC_64_XZ,
+		CSHAKE_128, CSHAKE_256,
+		Fletcher16, Fletcher32, Fletcher64,
+		FNV32_1a, FNV64_1a,
+		HAS_160,
+		HighwayHash64, HighwayHash128, HighwayHash256,
+		MD2, MD4, MD5,
+		RIPEMD_128, RIPEMD_160, RIPEMD_256, RIPEMD_320,
+		SipHash,
+		SHA1,
+		SHA2_224, SHA2_256, SHA2_384, SHA2_512,
+		SHA2_512_224, SHA2_512_256,
+		SHA3_224, SHA3_256, SHA3_384, SHA3_512,
+		SHAKE_128, SHAKE_256,
+		SM3,
+		Tiger1_128, Tiger1_160, Tiger1_192,
+		Tiger2_128, Tiger2_160, Tiger2_192,
+		Whirlpool,
+		Invalid
+	};
+
+	template <typename... Ts>
+	constexpr std::size_t maxSizeOf()
+	{
+		const std::size_t sizes[] = {sizeof(Ts)...};
+		std::size_t ret = 0;
+		for (const std::size_t size : sizes)
+			ret = (size > ret) ? size : ret;
+		return ret;
+	}
+
+	template <typename... Ts>
+	constexpr std::size_t maxAlignOf()
+	{
+		const std::size_t aligns[] = {alignof(Ts)...};
+		std::size_t ret = 1;
+		for (const std::size_t align : aligns)
+			ret = (align > ret) ? align : ret;
+		return ret;
+	}
+
+#define CHOCOBO1_ANY_HASHER_TYPES \
+	Chocobo1::Adler32, \
+	Chocobo1::Blake1_224, Chocobo1::Blake1_256, Chocobo1::Blake1_384, Chocobo1::Blake1_512, \
+	Chocobo1::Blake2, Chocobo1::Blake2s, \
+	Chocobo1::CRC_32_ISO_HDLC, Chocobo1::CRC_64_XZ, \
+	Chocobo1::CSHAKE_128, Chocobo1::CSHAKE_256, \
+	Chocobo1::Fletcher16, Chocobo1::Fletcher32, Chocobo1::Fletcher64, \
+	Chocobo1::FNV32_1a, Chocobo1::FNV64_1a, \
+	Chocobo1::HAS_160, \
+	Chocobo1::HighwayHash64, Chocobo1::HighwayHash128, Chocobo1::HighwayHash256, \
+	Chocobo1::MD2, Chocobo1::MD4, Chocobo1::MD5, \
+	Chocobo1::RIPEMD_128, Chocobo1::RIPEMD_160, Chocobo1::RIPEMD_256, Chocobo1::RIPEMD_320, \
+	Chocobo1::SipHash, \
+	Chocobo1::SHA1, \
+	Chocobo1::SHA2_224, Chocobo1::SHA2_256, Chocobo1::SHA2_384, Chocobo1::SHA2_512, \
+	Chocobo1::SHA2_512_224, Chocobo1::SHA2_512_256, \
+	Chocobo1::SHA3_224, Chocobo1::SHA3_256, Chocobo1::SHA3_384, Chocobo1::SHA3_512, \
+	Chocobo1::SHAKE_128, Chocobo1::SHAKE_256, \
+	Chocobo1::SM3, \
+	Chocobo1::Tiger1_128, Chocobo1::Tiger1_160, Chocobo1::Tiger1_192, \
+	Chocobo1::Tiger2_128, Chocobo1::Tiger2_160, Chocobo1::Tiger2_192, \
+	Chocobo1::Whirlpool
+
+	static constexpr std::size_t STORAGE_SIZE = maxSizeOf<CHOCOBO1_ANY_HASHER_TYPES>();
+	static constexpr std::size_t STORAGE_ALIGN = maxAlignOf<CHOCOBO1_ANY_HASHER_TYPES>();
+
+#undef CHOCOBO1_ANY_HASHER_TYPES
+
+	template <typename T, typename = void>
+	struct IsHasher : std::false_type {};
+	template <typename T>
+	struct IsHasher<T, decltype(std::declval<T &>().addData(std::declval<const void *>(), std::size_t()), std::declval<T &>().finalize().toVector(), void())> : std::true_type {};
+
+	struct VTable
+	{
+		void (*addData)(void *self, const void *ptr, std::size_t length);
+		void (*finalize)(void *self);
+		void (*reset)(void *self);
+		std::string (*toString)(const void *self);
+		std::vector<uint8_t> (*toVector)(const void *self);
+		void (*copy)(void *dest, const void *src);
+		void (*destroy)(void *self);
+	};
+
+	template <typename T>
+	struct Model
+	{
+		static void addData(void *self, const void *ptr, const std::size_t length)
+		{
+			static_cast<T *>(self)->addData(ptr, length);
+		}
+		static void finalize(void *self)
+		{
+			static_cast<T *>(self)->finalize();
+		}
+		static void reset(void *self)
+		{
+			static_cast<T *>(self)->reset();
+		}
+		static std::string toString(const void *self)
+		{
+			return static_cast<const T *>(self)->toString();
+		}
+		static std::vector<uint8_t> toVector(const void *self)
+		{
+			return static_cast<const T *>(self)->toVector();
+		}
+		static void copy(void *dest, const void *src)
+		{
+			::new (dest) T(*static_cast<const T *>(src));
+		}
+		static void destroy(void *self)
+		{
+			static_cast<T *>(self)->~T();
+		}
+
+		static const VTable table;
+	};
+
+	template <typename T>
+	const VTable Model<T>::table = {&Model::addData, &Model::finalize, &Model::reset, &Model::toString, &Model::toVector, &Model::copy, &Model::destroy};
+
+
+	class AnyHasher
+	{
+		// Holds any hasher in place (no heap allocation) behind a table of function pointers,
+		// one indirect call per `addData()` chunk
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			static HashId findId(const std::string &name);  // `HashId::Invalid` if not found
+			static const char* name(HashId id);  // `nullptr` for `HashId::Invalid`
+
+			AnyHasher() = default;  // not valid
+			explicit AnyHasher(HashId id, int digestLength = 0, const std::string &functionName = {}, const std::string &customize = {});
+			explicit AnyHasher(const std::string &name, int digestLength = 0, const std::string &functionName = {}, const std::string &customize = {});
+			template <typename T, typename = typename std::enable_if<IsHasher<T>::value>::type>
+			explicit AnyHasher(const T &hasher);
+
+			AnyHasher(const AnyHasher &other);
+			AnyHasher& operator=(const AnyHasher &other);
+			~AnyHasher();
+
+			bool isValid() const;  // everything else requires a valid hasher
+			HashId id() const;  // `HashId::Invalid` when wrapping an object directly
+
+			void reset();
+			AnyHasher& finalize();  // after this, only `reset()`, `toString()`, `toVector()` are available
+
+			std::string toString() const;
+			std::vector<Byte> toVector() const;
+
+			AnyHasher& addData(Span<const Byte> inData);
+			AnyHasher& addData(const void *ptr, std::size_t length);
+			template <std::size_t N>
+			AnyHasher& addData(const Byte (&array)[N]);
+			template <typename T, std::size_t N>
+			AnyHasher& addData(const T (&array)[N]);
+			template <typename T>
+			AnyHasher& addData(Span<T> inSpan);
+
+		private:
+			template <typename T>
+			void emplace(const T &hasher);
+			void clear();
+
+			const VTable *m_vtable = nullptr;
+			HashId m_id = HashId::Invalid;
+			alignas(STORAGE_ALIGN) unsigned char m_storage[STORAGE_SIZE];
+	};
+
+
+	//
+	inline HashId AnyHasher::findId(const std::string &name)
+	{
+		for (int i = 0; i < static_cast<int>(HashId::Invalid); ++i)
+		{
+			if (name == AnyHasher::name(static_cast<HashId>(i)))
+				return static_cast<HashId>(i);
+		}
+		return HashId::Invalid;
+	}
+
+	inline const char* AnyHasher::name(const HashId id)
+	{
+		// same order as `HashId`
+		static const char *const names[] = {
+			"adler32",
+			"blake1-224", "blake1-256", "blake1-384", "blake1-512",
+			"blake2", "blake2s",
+			"crc-32", "crc-64-xz",
+			"cshake-128", "cshake-256",
+			"fletcher16", "fletcher32", "fletcher64",
+			"fnv32_1a", "fnv64_1a",
+			"has160",
+			"highwayhash-64", "highwayhash-128", "highwayhash-256",
+			"md2", "md4", "md5",
+			"ripemd-128", "ripemd-160", "ripemd-256", "ripemd-320",
+			"siphash",
+			"sha1",
+			"sha2-224", "sha2-256", "sha2-384", "sha2-512",
+			"sha2-512-224", "sha2-512-256",
+			"sha3-224", "sha3-256", "sha3-384", "sha3-512",
+			"shake-128", "shake-256",
+			"sm3",
+			"tiger1-128", "tiger1-160", "tiger1-192",
+			"tiger2-128", "tiger2-160", "tiger2-192",
+			"whirlpool"
+		};
+		static_assert(((sizeof(names) / sizeof(names[0])) == static_cast<std::size_t>(HashId::Invalid)), "Mismatched names");
+
+		const int index = static_cast<int>(id);
+		if ((index < 0) || (index >= static_cast<int>(HashId::Invalid)))
+			return nullptr;
+		return names[index];
+	}
+
+	inline AnyHasher::AnyHasher(const HashId id, const int digestLength, const std::string &functionName, const std::string &customize)
+	{
+		switch (id)
+		{
+			case HashId::Adler32: emplace(Chocobo1::Adler32()); break;
+			case HashId::Blake1_224: emplace(Chocobo1::Blake1_224()); break;
+			case HashId::Blake1_256: emplace(Chocobo1::Blake1_256()); break;
+			case HashId::Blake1_384: emplace(Chocobo1::Blake1_384()); break;
+			case HashId::Blake1_512: emplace(Chocobo1::Blake1_512()); break;
+			case HashId::Blake2: emplace(Chocobo1::Blake2()); break;
+			case HashId::Blake2s: emplace(Chocobo1::Blake2s()); break;
+			case HashId::CRC_32: emplace(Chocobo1::CRC_32_ISO_HDLC()); break;
+			case HashId::CRC_64_XZ: emplace(Chocobo1::CRC_64_XZ()); break;
+			case HashId::CSHAKE_128:
+				if (digestLength > 0)
+					emplace(Chocobo1::CSHAKE_128(digestLength, functionName, customize));
+				break;
+			case HashId::CSHAKE_256:
+				if (digestLength > 0)
+					emplace(Chocobo1::CSHAKE_256(digestLength, functionName, customize));
+				break;
+			case HashId::Fletcher16: emplace(Chocobo1::Fletcher16()); break;
+			case HashId::Fletcher32: emplace(Chocobo1::Fletcher32()); break;
+			case HashId::Fletcher64: emplace(Chocobo1::Fletcher64()); break;
+			case HashId::FNV32_1a: emplace(Chocobo1::FNV32_1a()); break;
+			case HashId::FNV64_1a: emplace(Chocobo1::FNV64_1a()); break;
+			case HashId::HAS_160: emplace(Chocobo1::HAS_160()); break;
+			case HashId::HighwayHash64:
+			case HashId::HighwayHash128:
+			case HashId::HighwayHash256:
+			{
+				const Byte key[32] = {};  // wrap a `HighwayHash` object for other keys
+				if (id == HashId::HighwayHash64)
+					emplace(Chocobo1::HighwayHash64(key));
+				else if (id == HashId::HighwayHash128)
+					emplace(Chocobo1::HighwayHash128(key));
+				else
+					emplace(Chocobo1::HighwayHash256(key));
+				break;
+			}
+			case HashId::MD2: emplace(Chocobo1::MD2()); break;
+			case HashId::MD4: emplace(Chocobo1::MD4()); break;
+			case HashId::MD5: emplace(Chocobo1::MD5()); break;
+			case HashId::RIPEMD_128: emplace(Chocobo1::RIPEMD_128()); break;
+			case HashId::RIPEMD_160: emplace(Chocobo1::RIPEMD_160()); break;
+			case HashId::RIPEMD_256: emplace(Chocobo1::RIPEMD_256()); break;
+			case HashId::RIPEMD_320: emplace(Chocobo1::RIPEMD_320()); break;
+			case HashId::SipHash:
+			{
+				const Byte key[16] = {};  // wrap a `SipHash` object for other keys
+				emplace(Chocobo1::SipHash(key));
+				break;
+			}
+			case HashId::SHA1: emplace(Chocobo1::SHA1()); break;
+			case HashId::SHA2_224: emplace(Chocobo1::SHA2_224()); break;
+			case HashId::SHA2_256: emplace(Chocobo1::SHA2_256()); break;
+			case HashId::SHA2_384: emplace(Chocobo1::SHA2_384()); break;
+			case HashId::SHA2_512: emplace(Chocobo1::SHA2_512()); break;
+			case HashId::SHA2_512_224: emplace(Chocobo1::SHA2_512_224()); break;
+			case HashId::SHA2_512_256: emplace(Chocobo1::SHA2_512_256()); break;
+			case HashId::SHA3_224: emplace(Chocobo1::SHA3_224()); break;
+			case HashId::SHA3_256: emplace(Chocobo1::SHA3_256()); break;
+			case HashId::SHA3_384: emplace(Chocobo1::SHA3_384()); break;
+			case HashId::SHA3_512: emplace(Chocobo1::SHA3_512()); break;
+			case HashId::SHAKE_128:
+				if (digestLength > 0)
+					emplace(Chocobo1::SHAKE_128(digestLength));
+				break;
+			case HashId::SHAKE_256:
+				if (digestLength > 0)
+					emplace(Chocobo1::SHAKE_256(digestLength));
+				break;
+			case HashId::SM3: emplace(Chocobo1::SM3()); break;
+			case HashId::Tiger1_128: emplace(Chocobo1::Tiger1_128()); break;
+			case HashId::Tiger1_160: emplace(Chocobo1::Tiger1_160()); break;
+			case HashId::Tiger1_192: emplace(Chocobo1::Tiger1_192()); break;
+			case HashId::Tiger2_128: emplace(Chocobo1::Tiger2_128()); break;
+			case HashId::Tiger2_160: emplace(Chocobo1::Tiger2_160()); break;
+			case HashId::Tiger2_192: emplace(Chocobo1::Tiger2_192()); break;
+			case HashId::Whirlpool: emplace(Chocobo1::Whirlpool()); break;
+
+			default:
+			case HashId::Invalid:
+				break;
+		}
+
+		if (isValid())
+			m_id = id;
+	}
+
+	inline AnyHasher::AnyHasher(const std::string &name, const int digestLength, const std::string &functionName, const std::string &customize)
+		: AnyHasher(findId(name), digestLength, functionName, customize)
+	{
+	}
+
+	template <typename T, typename>
+	AnyHasher::AnyHasher(const T &hasher)
+	{
+		emplace(hasher);
+	}
+
+	inline AnyHasher::AnyHasher(const AnyHasher &other)
+		: m_id(other.m_id)
+	{
+		if (other.m_vtable != nullptr)
+		{
+			other.m_vtable->copy(m_storage, other.m_storage);
+			m_vtable = other.m_vtable;
+		}
+	}
+
+	inline AnyHasher& AnyHasher::operator=(const AnyHasher &other)
+	{
+		if (this == &other)
+			return (*this);
+
+		clear();
+		if (other.m_vtable != nullptr)
+		{
+			other.m_vtable->copy(m_storage, other.m_storage);
+			m_vtable = other.m_vtable;
+			m_id = other.m_id;
+		}
+		return (*this);
+	}
+
+	inline AnyHasher::~AnyHasher()
+	{
+		clear();
+	}
+
+	inline bool AnyHasher::isValid() const
+	{
+		return (m_vtable != nullptr);
+	}
+
+	inline HashId AnyHasher::id() const
+	{
+		return m_id;
+	}
+
+	inline void AnyHasher::reset()
+	{
+		assert(isValid());
+		m_vtable->reset(m_storage);
+	}
+
+	inline AnyHasher& AnyHasher::finalize()
+	{
+		assert(isValid());
+		m_vtable->finalize(m_storage);
+		return (*this);
+	}
+
+	inline std::string AnyHasher::toString() const
+	{
+		assert(isValid());
+		return m_vtable->toString(m_storage);
+	}
+
+	inline std::vector<AnyHasher::Byte> AnyHasher::toVector() const
+	{
+		assert(isValid());
+		return m_vtable->toVector(m_storage);
+	}
+
+	inline AnyHasher& AnyHasher::addData(const Span<const Byte> inData)
+	{
+		return addData(inData.data(), static_cast<std::size_t>(inData.size()));
+	}
+
+	inline AnyHasher& AnyHasher::addData(const void *ptr, const std::size_t length)
+	{
+		assert(isValid());
+		m_vtable->addData(m_storage, ptr, length);
+		return (*this);
+	}
+
+	template <std::size_t N>
+	AnyHasher& AnyHasher::addData(const Byte (&array)[N])
+	{
+		return addData(array, N);
+	}
+
+	template <typename T, std::size_t N>
+	AnyHasher& AnyHasher::addData(const T (&array)[N])
+	{
+		return addData(array, (sizeof(T) * N));
+	}
+
+	template <typename T>
+	AnyHasher& AnyHasher::addData(const Span<T> inSpan)
+	{
+		return addData(inSpan.data(), inSpan.size_bytes());
+	}
+
+	template <typename T>
+	void AnyHasher::emplace(const T &hasher)
+	{
+		static_assert((sizeof(T) <= STORAGE_SIZE), "Hasher does not fit in AnyHasher");
+		static_assert(((STORAGE_ALIGN % alignof(T)) == 0), "Hasher alignment not supported by AnyHasher");
+
+		clear();
+		::new (static_cast<void *>(m_storage)) T(hasher);
+		m_vtable = &Model<T>::table;
+	}
+
+	inline void AnyHasher::clear()
+	{
+		if (m_vtable != nullptr)
+			m_vtable->destroy(m_storage);
+		m_vtable = nullptr;
+		m_id = HashId::Invalid;
+	}
+}
+}
+	using AnyHasher = Hash::AnyHasher_NS::AnyHasher;
+	using HashId = Hash::AnyHasher_NS::HashId;
+}
+
+#endif  // CHOCOBO1_ANY_HASHER_H
@@ -0,0 +1,804 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_ARGON2_H
+#define CHOCOBO1_ARGON2_H
+
+#include "blake2.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
+// AVX2 kernel, chosen at run time when the CPU supports them
+// define `USE_X86_SIMD_CHOCOBO1_HASH` to 0 to always use the portable code
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#if (defined(__x86_64__) || defined(_M_X64))
+#if defined(__has_builtin)
+#if (__has_builtin(__builtin_is_constant_evaluated) && __has_builtin(__builtin_cpu_supports))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#elif (defined(_MSC_VER) && (_MSC_VER >= 1925))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#endif
+#endif
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#define USE_X86_SIMD_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2_CHOCOBO1_HASH
+#else
+#define TARGET_AVX2_CHOCOBO1_HASH __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+#endif
+
+// with the prebuilt library, kernels are defined there only
+#ifndef INLINE_KERNEL_CHOCOBO1_HASH
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+#define INLINE_KERNEL_CHOCOBO1_HASH
+#else
+#define INLINE_KERNEL_CHOCOBO1_HASH inline
+#endif
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// Argon2id(memoryKiB, passes, lanes, tagLength = 32).hash(password, salt);  // tag as `std::vector<uint8_t>`
+	// Argon2id(...).setSecret(key).setAssociatedData(data).setThreads(4).hash(password, salt);
+	// Argon2id(...).hash(password, salt, service);  // lanes run with `service.post()`, e.g. `HashService`
+	// Argon2d(...);  Argon2i(...);
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace Argon2_NS
+{
+	using Byte = uint8_t;
+
+	static constexpr uint32_t VERSION = 0x13;
+	static constexpr uint32_t SYNC_POINTS = 4;  // slices per pass
+	static constexpr uint32_t ADDRESSES_PER_BLOCK = 128;
+
+	struct Block
+	{
+		uint64_t v[128];
+	};
+
+	inline void store32(Byte *ptr, const uint32_t value)
+	{
+		for (int i = 0; i < 4; ++i)
+			ptr[i] = static_cast<Byte>(value >> (i * 8));
+	}
+
+	inline void loadBlock(Block &block, const Byte *ptr)
+	{
+		for (int i = 0; i < 128; ++i)
+		{
+			uint64_t value = 0;
+			for (int j = 7; j >= 0; --j)
+				value = (value << 8) | ptr[(i * 8) + j];
+			block.v[i] = value;
+		}
+	}
+
+	inline void storeBlock(Byte *ptr, const Block &block)
+	{
+		for (int i = 0; i < 128; ++i)
+		{
+			for (int j = 0; j < 8; ++j)
+				ptr[(i * 8) + j] = static_cast<Byte>(block.v[i] >> (j * 8));
+		}
+	}
+
+	inline void secureZero(void *ptr, const std::size_t size)
+	{
+		// clears memory holding password derived data, the stores must not be removed as dead
+#if defined(__GNUC__)
+		std::memset(ptr, 0, size);
+		__asm__ __volatile__("" : : "r"(ptr) : "memory");
+#else
+		volatile Byte *bytes = static_cast<volatile Byte *>(ptr);
+		for (std::size_t i = 0; i < size; ++i)
+			bytes[i] = 0;
+#endif
+	}
+
+	inline void hashLong(Byte *out, const uint32_t outLength, const Byte *in, const std::size_t inLength)
+	{
+		// variable length hash function H' on BLAKE2b, RFC 9106 section 3.3
+		Byte lengthPrefix[4] = {};
+		store32(lengthPrefix, outLength);
+
+		if (outLength <= 64)
+		{
+			auto digest = Blake2(static_cast<int>(outLength)).addData(lengthPrefix).addData(in, inLength).finalize().toArray();
+			std::memcpy(out, digest.data(), outLength);
+			secureZero(digest.data(), digest.size());
+			return;
+		}
+
+		auto v = Blake2().addData(lengthPrefix).addData(in, inLength).finalize().toArray();
+		std::memcpy(out, v.data(), 32);
+
+		uint32_t offset = 32;
+		while ((outLength - offset) > 64)
+		{
+			v = Blake2().addData(v.data(), v.size()).finalize().toArray();
+			std::memcpy((out + offset), v.data(), 32);
+			offset += 32;
+		}
+
+		const uint32_t lastLength = outLength - offset;
+		v = Blake2(static_cast<int>(lastLength)).addData(v.data(), v.size()).finalize().toArray();
+		std::memcpy((out + offset), v.data(), lastLength);
+		secureZero(v.data(), v.size());
+	}
+
+	constexpr uint64_t fBlaMka(const uint64_t x, const uint64_t y)
+	{
+		return (x + y + (2 * (x & 0xFFFFFFFF) * (y & 0xFFFFFFFF)));
+	}
+
+	inline void mixG(uint64_t &a, uint64_t &b, uint64_t &c, uint64_t &d)
+	{
+		a = fBlaMka(a, b);
+		d = rotr((d ^ a), 32);
+		c = fBlaMka(c, d);
+		b = rotr((b ^ c), 24);
+		a = fBlaMka(a, b);
+		d = rotr((d ^ a), 16);
+		c = fBlaMka(c, d);
+		b = rotr((b ^ c), 63);
+	}
+
+	inline void roundP(uint64_t *(&v)[16])
+	{
+		mixG(*v[0], *v[4], *v[8], *v[12]);
+		mixG(*v[1], *v[5], *v[9], *v[13]);
+		mixG(*v[2], *v[6], *v[10], *v[14]);
+		mixG(*v[3], *v[7], *v[11], *v[15]);
+		mixG(*v[0], *v[5], *v[10], *v[15]);
+		mixG(*v[1], *v[6], *v[11], *v[12]);
+		mixG(*v[2], *v[7], *v[8], *v[13]);
+		mixG(*v[3], *v[4], *v[9], *v[14]);
+	}
+
+	inline void compress(const Block &prev, const Block &ref, Block &next, const bool withXor)
+	{
+		// compression function G, RFC 9106 section 3.5
+		Block r;
+		Block q;
+		for (int i = 0; i < 128; ++i)
+		{
+			r.v[i] = prev.v[i] ^ ref.v[i];
+			q.v[i] = withXor ? (r.v[i] ^ next.v[i]) : r.v[i];
+		}
+
+		// rows: 8 registers of 16 bytes each
+		for (int i = 0; i < 8; ++i)
+		{
+			uint64_t *v[16] = {};
+			for (int j = 0; j < 16; ++j)
+				v[j] = &r.v[(16 * i) + j];
+			roundP(v);
+		}
+		// columns
+		for (int i = 0; i < 8; ++i)
+		{
+			uint64_t *v[16] = {};
+			for (int j = 0; j < 16; ++j)
+				v[j] = &r.v[(2 * i) + (j & 1) + (16 * (j >> 1))];
+			roundP(v);
+		}
+
+		for (int i = 0; i < 128; ++i)
+			next.v[i] = q.v[i] ^ r.v[i];
+	}
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#if ((USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1) && !defined(BUILD_LIBRARY_CHOCOBO1_HASH))
+	bool hasAvx2();
+	TARGET_AVX2_CHOCOBO1_HASH
+	void compressAvx2(const Block &prev, const Block &ref, Block &next, bool withXor);
+#else
+	INLINE_KERNEL_CHOCOBO1_HASH bool hasAvx2()
+	{
+		static const bool ret = []() -> bool
+		{
+#ifdef _MSC_VER
+			int info[4] = {};
+			__cpuid(info, 1);
+			const bool osAvx = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 0x6) == 0x6);
+			__cpuidex(info, 7, 0);
+			return osAvx && ((info[1] & (1 << 5)) != 0);
+#else
+			__builtin_cpu_init();
+			return (__builtin_cpu_supports("avx2") != 0);
+#endif
+		}();
+		return ret;
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	inline __m256i fBlaMkaAvx2(const __m256i x, const __m256i y)
+	{
+		const __m256i product = _mm256_mul_epu32(x, y);
+		return _mm256_add_epi64(_mm256_add_epi64(x, y), _mm256_add_epi64(product, product));
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	inline void mixGAvx2(__m256i &a, __m256i &b, __m256i &c, __m256i &d)
+	{
+		const __m256i rotr24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+			3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+		const __m256i rotr16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+			2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+
+		a = fBlaMkaAvx2(a, b);
+		d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), _MM_SHUFFLE(2, 3, 0, 1));
+		c = fBlaMkaAvx2(c, d);
+		b = _mm256_shuffle_epi8(_mm256_xor_si256(b, c), rotr24);
+		a = fBlaMkaAvx2(a, b);
+		d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotr16);
+		c = fBlaMkaAvx2(c, d);
+		b = _mm256_xor_si256(b, c);
+		b = _mm256_xor_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b));
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	inline void roundPAvx2(__m256i &a, __m256i &b, __m256i &c, __m256i &d)
+	{
+		// the 4 columns at once, then the 4 diagonals after rotating rows `b`, `c`, `d` into place
+		mixGAvx2(a, b, c, d);
+		b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+		c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+		d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+		mixGAvx2(a, b, c, d);
+		b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+		c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+		d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void compressAvx2(const Block &prev, const Block &ref, Block &next, const bool withXor)
+	{
+		alignas(32) uint64_t r[128];
+		__m256i q[32];
+		for (int i = 0; i < 32; ++i)
+		{
+			const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(&prev.v[4 * i])),
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(&ref.v[4 * i])));
+			_mm256_store_si256(reinterpret_cast<__m256i *>(&r[4 * i]), x);
+			q[i] = withXor ? _mm256_xor_si256(x, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&next.v[4 * i]))) : x;
+		}
+
+		// rows are 4 consecutive registers
+		for (int i = 0; i < 8; ++i)
+		{
+			__m256i *row = reinterpret_cast<__m256i *>(&r[16 * i]);
+			__m256i a = _mm256_load_si256(row + 0);
+			__m256i b = _mm256_load_si256(row + 1);
+			__m256i c = _mm256_load_si256(row + 2);
+			__m256i d = _mm256_load_si256(row + 3);
+			roundPAvx2(a, b, c, d);
+			_mm256_store_si256((row + 0), a);
+			_mm256_store_si256((row + 1), b);
+			_mm256_store_si256((row + 2), c);
+			_mm256_store_si256((row + 3), d);
+		}
+
+		// columns are pairs of words, 16 words apart
+		for (int i = 0; i < 8; ++i)
+		{
+			__m256i v[4];
+			for (int j = 0; j < 4; ++j)
+			{
+				const __m128i low = _mm_load_si128(reinterpret_cast<const __m128i *>(&r[(2 * i) + (32 * j)]));
+				const __m128i high = _mm_load_si128(reinterpret_cast<const __m128i *>(&r[(2 * i) + (32 * j) + 16]));
+				v[j] = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+			}
+			roundPAvx2(v[0], v[1], v[2], v[3]);
+			for (int j = 0; j < 4; ++j)
+			{
+				_mm_store_si128(reinterpret_cast<__m128i *>(&r[(2 * i) + (32 * j)]), _mm256_castsi256_si128(v[j]));
+				_mm_store_si128(reinterpret_cast<__m128i *>(&r[(2 * i) + (32 * j) + 16]), _mm256_extracti128_si256(v[j], 1));
+			}
+		}
+
+		for (int i = 0; i < 32; ++i)
+		{
+			const __m256i x = _mm256_xor_si256(q[i], _mm256_load_si256(reinterpret_cast<const __m256i *>(&r[4 * i])));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(&next.v[4 * i]), x);
+		}
+	}
+#endif
+#endif
+
+
+	class Arena
+	{
+		// Memory for the blocks. On Linux it is mapped from huge pages when the system has them reserved,
+		// otherwise transparent huge pages are requested. Pages are only touched when the blocks are filled.
+
+		public:
+			explicit Arena(std::size_t blocks);
+			Arena(const Arena &) = delete;
+			Arena& operator=(const Arena &) = delete;
+			~Arena();
+
+			Block* data() const;
+
+		private:
+			Block *m_blocks = nullptr;
+			std::size_t m_size = 0;  // bytes mapped or allocated
+	};
+
+
+	struct Instance
+	{
+		Block *memory;
+		uint32_t passes;
+		uint32_t lanes;
+		uint32_t laneLength;
+		uint32_t segmentLength;
+		uint32_t memoryBlocks;
+		int type;
+		void (*compress)(const Block &prev, const Block &ref, Block &next, bool withXor);
+	};
+
+	inline uint32_t referenceIndex(const Instance &instance, const uint32_t pass, const uint32_t slice, const uint32_t index
+		, const uint32_t pseudoRandom, const bool sameLane)
+	{
+		// RFC 9106 section 3.4.1.2, the window of blocks that may be referenced
+		uint32_t areaSize = 0;
+		if (pass == 0)
+		{
+			if (slice == 0)
+				areaSize = index - 1;
+			else if (sameLane)
+				areaSize = (slice * instance.segmentLength) + index - 1;
+			else
+				areaSize = (slice * instance.segmentLength) - ((index == 0) ? 1 : 0);
+		}
+		else
+		{
+			if (sameLane)
+				areaSize = instance.laneLength - instance.segmentLength + index - 1;
+			else
+				areaSize = instance.laneLength - instance.segmentLength - ((index == 0) ? 1 : 0);
+		}
+
+		uint64_t relative = pseudoRandom;
+		relative = (relative * relative) >> 32;
+		relative = areaSize - 1 - ((areaSize * relative) >> 32);
+
+		const uint32_t start = ((pass == 0) || (slice == (SYNC_POINTS - 1))) ? 0 : ((slice + 1) * instance.segmentLength);
+		return static_cast<uint32_t>((start + relative) % instance.laneLength);
+	}
+
+	inline void fillSegment(const Instance &instance, const uint32_t pass, const uint32_t lane, const uint32_t slice)
+	{
+		const bool dataIndependent = (instance.type == 1) || ((instance.type == 2) && (pass == 0) && (slice < (SYNC_POINTS / 2)));
+
+		Block zero {};
+		Block input {};
+		Block addresses {};
+		const auto nextAddresses = [&]()
+		{
+			++input.v[6];
+			instance.compress(zero, input, addresses, false);
+			instance.compress(zero, addresses, addresses, false);
+		};
+
+		if (dataIndependent)
+		{
+			input.v[0] = pass;
+			input.v[1] = lane;
+			input.v[2] = slice;
+			input.v[3] = instance.memoryBlocks;
+			input.v[4] = instance.passes;
+			input.v[5] = static_cast<uint64_t>(instance.type);
+		}
+
+		uint32_t startIndex = 0;
+		if ((pass == 0) && (slice == 0))
+		{
+			startIndex = 2;  // the first 2 blocks of each lane come from H0
+			if (dataIndependent)
+				nextAddresses();
+		}
+
+		uint32_t current = (lane * instance.laneLength) + (slice * instance.segmentLength) + startIndex;
+		uint32_t previous = ((current % instance.laneLength) == 0) ? (current + instance.laneLength - 1) : (current - 1);
+
+		for (uint32_t i = startIndex; i < instance.segmentLength; ++i, ++current, ++previous)
+		{
+			if ((current % instance.laneLength) == 1)
+				previous = current - 1;
+
+			uint64_t pseudoRandom = 0;
+			if (dataIndependent)
+			{
+				if ((i % ADDRESSES_PER_BLOCK) == 0)
+					nextAddresses();
+				pseudoRandom = addresses.v[i % ADDRESSES_PER_BLOCK];
+			}
+			else
+			{
+				pseudoRandom = instance.memory[previous].v[0];
+			}
+
+			uint32_t refLane = static_cast<uint32_t>((pseudoRandom >> 32) % instance.lanes);
+			if ((pass == 0) && (slice == 0))
+				refLane = lane;
+
+			const uint32_t refIndex = referenceIndex(instance, pass, slice, i, static_cast<uint32_t>(pseudoRandom), (refLane == lane));
+			const Block &ref = instance.memory[(static_cast<std::size_t>(refLane) * instance.laneLength) + refIndex];
+
+			// version 1.3 XORs over the previous pass
+			instance.compress(instance.memory[previous], ref, instance.memory[current], (pass != 0));
+		}
+	}
+
+
+	template <int Type>  // `y` of RFC 9106: 0 = Argon2d, 1 = Argon2i, 2 = Argon2id
+	class Argon2
+	{
+		// https://www.rfc-editor.org/rfc/rfc9106
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+
+			Argon2(uint32_t memoryKiB, uint32_t passes, uint32_t lanes, uint32_t tagLength = 32);
+
+			Argon2& setSecret(Span<const Byte> secret);
+			Argon2& setAssociatedData(Span<const Byte> data);
+			Argon2& setThreads(unsigned int threads);  // default: one per lane, up to the number of cores
+
+			bool isValid() const;  // parameters are within the limits of RFC 9106
+
+			// empty when the parameters are invalid or the salt is shorter than 8 bytes
+			std::vector<Byte> hash(Span<const Byte> password, Span<const Byte> salt) const;
+			// the lanes of each slice are run on `pool.post(std::function<void ()>)`, don't call this from a worker of `pool`
+			template <typename Pool>
+			std::vector<Byte> hash(Span<const Byte> password, Span<const Byte> salt, Pool &pool) const;
+
+		private:
+			void prepare(Span<const Byte> password, Span<const Byte> salt, Arena &arena, Instance &instance) const;
+			std::vector<Byte> finish(const Instance &instance) const;
+
+			uint32_t m_memoryKiB = 0;
+			uint32_t m_passes = 0;
+			uint32_t m_lanes = 0;
+			uint32_t m_tagLength = 0;
+			unsigned int m_threads = 0;
+			std::vector<Byte> m_secret;
+			std::vector<Byte> m_associatedData;
+	};
+
+
+	//
+	inline Arena::Arena(const std::size_t blocks)
+	{
+		const std::size_t size = blocks * sizeof(Block);
+#if defined(__linux__)
+		const std::size_t hugePage = 2 * 1024 * 1024;
+		const std::size_t roundedSize = (size + hugePage - 1) / hugePage * hugePage;
+
+		void *map = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+		map = mmap(nullptr, roundedSize, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB), -1, 0);
+#endif
+		if (map == MAP_FAILED)
+		{
+			map = mmap(nullptr, roundedSize, (PROT_READ | PROT_WRITE), (MAP_PRIVATE | MAP_ANONYMOUS), -1, 0);
+#if defined(MADV_HUGEPAGE)
+			if (map != MAP_FAILED)
+				madvise(map, roundedSize, MADV_HUGEPAGE);
+#endif
+		}
+		if (map == MAP_FAILED)
+			throw std::bad_alloc();
+
+		m_blocks = static_cast<Block *>(map);
+		m_size = roundedSize;
+#else
+		m_blocks = new Block[blocks];
+		m_size = size;
+#endif
+	}
+
+	inline Arena::~Arena()
+	{
+#if defined(__linux__)
+		if (m_blocks != nullptr)
+			munmap(m_blocks, m_size);
+#else
+		// unlike unmapped pages, heap memory is handed out again as is
+		if (m_blocks != nullptr)
+			secureZero(m_blocks, m_size);
+		delete[] m_blocks;
+#endif
+	}
+
+	inline Block* Arena::data() const
+	{
+		return m_blocks;
+	}
+
+	template <int Type>
+	Argon2<Type>::Argon2(const uint32_t memoryKiB, const uint32_t passes, const uint32_t lanes, const uint32_t tagLength)
+		: m_memoryKiB(memoryKiB)
+		, m_passes(passes)
+		, m_lanes(lanes)
+		, m_tagLength(tagLength)
+	{
+		static_assert(((Type >= 0) && (Type <= 2)), "Unsupported Argon2 type");
+
+		m_threads = std::min(std::max(std::thread::hardware_concurrency(), 1u), std::max(lanes, 1u));
+	}
+
+	template <int Type>
+	Argon2<Type>& Argon2<Type>::setSecret(const Span<const Byte> secret)
+	{
+		m_secret.assign(secret.begin(), secret.end());
+		return (*this);
+	}
+
+	template <int Type>
+	Argon2<Type>& Argon2<Type>::setAssociatedData(const Span<const Byte> data)
+	{
+		m_associatedData.assign(data.begin(), data.end());
+		return (*this);
+	}
+
+	template <int Type>
+	Argon2<Type>& Argon2<Type>::setThreads(const unsigned int threads)
+	{
+		m_threads = std::max(threads, 1u);
+		return (*this);
+	}
+
+	template <int Type>
+	bool Argon2<Type>::isValid() const
+	{
+		return ((m_lanes >= 1) && (m_lanes <= 0xFFFFFF)
+			&& (m_tagLength >= 4)
+			&& (m_passes >= 1)
+			&& (m_memoryKiB >= (8 * m_lanes)));
+	}
+
+	template <int Type>
+	std::vector<typename Argon2<Type>::Byte> Argon2<Type>::hash(const Span<const Byte> password, const Span<const Byte> salt) const
+	{
+		// the worker threads live for one slice, the slices of a pass are few & long
+		const auto runSlice = [this](const Instance &instance, const uint32_t pass, const uint32_t slice)
+		{
+			const unsigned int threads = std::min(m_threads, instance.lanes);
+			const auto work = [&instance, pass, slice, threads](const unsigned int first)
+			{
+				for (uint32_t lane = first; lane < instance.lanes; lane += threads)
+					fillSegment(instance, pass, lane, slice);
+			};
+
+			std::vector<std::thread> workers;
+			workers.reserve(threads - 1);
+			for (unsigned int i = 1; i < threads; ++i)
+				workers.emplace_back(work, i);
+			work(0);
+			for (std::thread &worker : workers)
+				worker.join();
+		};
+
+		if (!isValid() || (salt.size() < 8))
+			return {};
+
+		Arena arena {static_cast<std::size_t>(m_memoryKiB)};
+		Instance instance {};
+		prepare(password, salt, arena, instance);
+
+		for (uint32_t pass = 0; pass < instance.passes; ++pass)
+		{
+			for (uint32_t slice = 0; slice < SYNC_POINTS; ++slice)
+				runSlice(instance, pass, slice);
+		}
+		return finish(instance);
+	}
+
+	template <int Type>
+	template <typename Pool>
+	std::vector<typename Argon2<Type>::Byte> Argon2<Type>::hash(const Span<const Byte> password, const Span<const Byte> salt, Pool &pool) const
+	{
+		if (!isValid() || (salt.size() < 8))
+			return {};
+
+		Arena arena {static_cast<std::size_t>(m_memoryKiB)};
+		Instance instance {};
+		prepare(password, salt, arena, instance);
+
+		std::mutex mutex;
+		std::condition_variable done;
+		for (uint32_t pass = 0; pass < instance.passes; ++pass)
+		{
+			for (uint32_t slice = 0; slice < SYNC_POINTS; ++slice)
+			{
+				// every lane of a slice has to be done before the next slice may reference it
+				uint32_t remaining = instance.lanes;
+				for (uint32_t lane = 0; lane < instance.lanes; ++lane)
+				{
+					pool.post([&instance, &mutex, &done, &remaining, pass, lane, slice]()
+					{
+						fillSegment(instance, pass, lane, slice);
+
+						const std::lock_guard<std::mutex> lock(mutex);
+						if (--remaining == 0)
+							done.notify_one();
+					});
+				}
+
+				std::unique_lock<std::mutex> lock(mutex);
+				done.wait(lock, [&remaining]() { return (remaining == 0); });
+			}
+		}
+		return finish(instance);
+	}
+
+	template <int Type>
+	void Argon2<Type>::prepare(const Span<const Byte> password, const Span<const Byte> salt, Arena &arena, Instance &instance) const
+	{
+		instance.lanes = m_lanes;
+		instance.segmentLength = m_memoryKiB / (m_lanes * SYNC_POINTS);
+		instance.laneLength = instance.segmentLength * SYNC_POINTS;
+		instance.memoryBlocks = instance.laneLength * m_lanes;
+		instance.passes = m_passes;
+		instance.type = Type;
+		instance.memory = arena.data();
+		instance.compress = &Argon2_NS::compress;
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+		if (hasAvx2())
+			instance.compress = &compressAvx2;
+#endif
+
+		// H0, RFC 9106 section 3.2
+		Blake2 h0;
+		const auto addNumber = [&h0](const std::size_t value)
+		{
+			Byte bytes[4] = {};
+			store32(bytes, static_cast<uint32_t>(value));
+			h0.addData(bytes);
+		};
+		const auto addField = [&h0, &addNumber](const Span<const Byte> field)
+		{
+			addNumber(field.size());
+			h0.addData(field);
+		};
+		addNumber(m_lanes);
+		addNumber(m_tagLength);
+		addNumber(m_memoryKiB);
+		addNumber(m_passes);
+		addNumber(VERSION);
+		addNumber(Type);
+		addField(password);
+		addField(salt);
+		addField({m_secret.data(), m_secret.size()});
+		addField({m_associatedData.data(), m_associatedData.size()});
+
+		Byte seed[64 + 8] = {};
+		auto digest = h0.finalize().toArray();
+		std::copy(digest.begin(), digest.end(), seed);
+		secureZero(digest.data(), digest.size());
+
+		Byte block[sizeof(Block)] = {};
+		for (uint32_t lane = 0; lane < m_lanes; ++lane)
+		{
+			store32((seed + 68), lane);
+			for (uint32_t i = 0; i < 2; ++i)
+			{
+				store32((seed + 64), i);
+				hashLong(block, sizeof(block), seed, sizeof(seed));
+				loadBlock(instance.memory[(static_cast<std::size_t>(lane) * instance.laneLength) + i], block);
+			}
+		}
+		secureZero(seed, sizeof(seed));
+		secureZero(block, sizeof(block));
+	}
+
+	template <int Type>
+	std::vector<typename Argon2<Type>::Byte> Argon2<Type>::finish(const Instance &instance) const
+	{
+		// XOR of the last column
+		Block lastColumn = instance.memory[instance.laneLength - 1];
+		for (uint32_t lane = 1; lane < instance.lanes; ++lane)
+		{
+			const Block &last = instance.memory[(static_cast<std::size_t>(lane) * instance.laneLength) + instance.laneLength - 1];
+			for (int i = 0; i < 128; ++i)
+				lastColumn.v[i] ^= last.v[i];
+		}
+
+		Byte block[sizeof(Block)] = {};
+		storeBlock(block, lastColumn);
+
+		std::vector<Byte> tag(m_tagLength);
+		hashLong(tag.data(), m_tagLength, block, sizeof(block));
+		secureZero(&lastColumn, sizeof(lastColumn));
+		secureZero(block, sizeof(block));
+		return tag;
+	}
+}
+}
+
+	using Argon2d = Hash::Argon2_NS::Argon2<0>;
+	using Argon2i = Hash::Argon2_NS::Argon2<1>;
+	using Argon2id = Hash::Argon2_NS::Argon2<2>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::Argon2_NS::Argon2<0>;
+	extern template class Hash::Argon2_NS::Argon2<1>;
+	extern template class Hash::Argon2_NS::Argon2<2>;
+#endif
+}
+
+#endif  // CHOCOBO1_ARGON2_H
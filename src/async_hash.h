@@ -0,0 +1,512 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_ASYNC_HASH_H
+#define CHOCOBO1_ASYNC_HASH_H
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#if (__cpp_impl_coroutine >= 201902L) && (__cpp_lib_coroutine >= 201902L)
+#define HAS_COROUTINE_CHOCOBO1_HASH 1
+#else
+#define HAS_COROUTINE_CHOCOBO1_HASH 0
+#endif
+
+#if (HAS_COROUTINE_CHOCOBO1_HASH == 1)
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// co_await asyncHash<SHA2_256>(data);
+	// AsyncHasher<Blake2> hasher; co_await hasher.addData(data); hasher.finalize();
+	// syncWait(task);  // for callers that are not coroutines
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace AsyncHash_NS
+{
+	template <typename T>
+	class Task;
+
+	template <typename T>
+	class TaskPromiseBase
+	{
+		public:
+			struct FinalAwaiter
+			{
+				bool await_ready() const noexcept
+				{
+					return false;
+				}
+
+				std::coroutine_handle<> await_suspend(const std::coroutine_handle<T> handle) const noexcept
+				{
+					// symmetric transfer back to whoever awaited us
+					const std::coroutine_handle<> continuation = handle.promise().m_continuation;
+					return continuation ? continuation : std::noop_coroutine();
+				}
+
+				void await_resume() const noexcept
+				{
+				}
+			};
+
+			std::suspend_always initial_suspend() const noexcept
+			{
+				return {};
+			}
+
+			FinalAwaiter final_suspend() const noexcept
+			{
+				return {};
+			}
+
+			void unhandled_exception() noexcept
+			{
+				m_exception = std::current_exception();
+			}
+
+			std::coroutine_handle<> m_continuation;
+			std::exception_ptr m_exception;
+	};
+
+	template <typename T>
+	class TaskPromise : public TaskPromiseBase<TaskPromise<T>>
+	{
+		public:
+			Task<T> get_return_object() noexcept;
+
+			template <typename U>
+			void return_value(U &&value)
+			{
+				m_value.emplace(std::forward<U>(value));
+			}
+
+			T result()
+			{
+				if (this->m_exception)
+					std::rethrow_exception(this->m_exception);
+				return std::move(*m_value);
+			}
+
+		private:
+			std::optional<T> m_value;
+	};
+
+	template <>
+	class TaskPromise<void> : public TaskPromiseBase<TaskPromise<void>>
+	{
+		public:
+			Task<void> get_return_object() noexcept;
+
+			void return_void() const noexcept
+			{
+			}
+
+			void result() const
+			{
+				if (this->m_exception)
+					std::rethrow_exception(this->m_exception);
+			}
+	};
+
+
+	template <typename T>
+	class Task
+	{
+		// Lazily started, single-shot awaitable
+
+		public:
+			using promise_type = TaskPromise<T>;
+
+			Task(Task &&other) noexcept
+				: m_handle(std::exchange(other.m_handle, nullptr))
+			{
+			}
+
+			Task& operator=(Task &&other) noexcept
+			{
+				if (this != &other)
+				{
+					if (m_handle)
+						m_handle.destroy();
+					m_handle = std::exchange(other.m_handle, nullptr);
+				}
+				return (*this);
+			}
+
+			~Task()
+			{
+				if (m_handle)
+					m_handle.destroy();
+			}
+
+			bool await_ready() const noexcept
+			{
+				assert(m_handle && "awaiting an empty (moved-from) Task");
+				return m_handle.done();
+			}
+
+			std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept
+			{
+				m_handle.promise().m_continuation = awaiting;
+				return m_handle;
+			}
+
+			T await_resume()
+			{
+				return m_handle.promise().result();
+			}
+
+		private:
+			friend promise_type;
+
+			explicit Task(const std::coroutine_handle<promise_type> handle) noexcept
+				: m_handle(handle)
+			{
+			}
+
+			std::coroutine_handle<promise_type> m_handle;
+	};
+
+	template <typename T>
+	Task<T> TaskPromise<T>::get_return_object() noexcept
+	{
+		return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+	}
+
+	inline Task<void> TaskPromise<void>::get_return_object() noexcept
+	{
+		return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+	}
+
+
+	class ThreadPool
+	{
+		// Resumes coroutines on a fixed set of worker threads
+
+		public:
+			explicit ThreadPool(unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u));
+			ThreadPool(const ThreadPool &) = delete;
+			ThreadPool& operator=(const ThreadPool &) = delete;
+			~ThreadPool();
+
+			void post(std::coroutine_handle<> handle);
+
+			auto schedule()  // `co_await pool.schedule()` continues on a worker thread
+			{
+				struct Awaiter
+				{
+					ThreadPool *pool;
+
+					bool await_ready() const noexcept
+					{
+						return false;
+					}
+
+					void await_suspend(const std::coroutine_handle<> handle) const
+					{
+						pool->post(handle);
+					}
+
+					void await_resume() const noexcept
+					{
+					}
+				};
+				return Awaiter {this};
+			}
+
+			static ThreadPool& instance();
+
+		private:
+			void run();
+
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+			std::queue<std::coroutine_handle<>> m_queue;
+			bool m_stop = false;
+			std::vector<std::thread> m_workers;
+	};
+
+	inline ThreadPool::ThreadPool(const unsigned int threads)
+	{
+		m_workers.reserve(threads);
+		for (unsigned int i = 0; i < threads; ++i)
+			m_workers.emplace_back([this]() { run(); });
+	}
+
+	inline ThreadPool::~ThreadPool()
+	{
+		{
+			const std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+		for (std::thread &worker : m_workers)
+			worker.join();
+	}
+
+	inline void ThreadPool::post(const std::coroutine_handle<> handle)
+	{
+		{
+			const std::lock_guard<std::mutex> lock(m_mutex);
+			m_queue.push(handle);
+		}
+		m_condition.notify_one();
+	}
+
+	inline ThreadPool& ThreadPool::instance()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	inline void ThreadPool::run()
+	{
+		while (true)
+		{
+			std::coroutine_handle<> handle;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return (m_stop || !m_queue.empty()); });
+				if (m_queue.empty())
+					return;
+				handle = m_queue.front();
+				m_queue.pop();
+			}
+			handle.resume();
+		}
+	}
+
+
+	struct AsyncOptions
+	{
+		// Inputs at least this large are hashed on `pool` instead of the awaiting thread,
+		// `nullptr` picks `ThreadPool::instance()`, which is only started by the first offloaded input
+		std::size_t offloadThreshold = 1024 * 1024;
+		ThreadPool *pool = nullptr;
+
+		// Smaller inputs are hashed inline, `chunkBudget` bytes at a time.
+		// Between chunks, and after coming back from `pool`, the coroutine is handed to `scheduler`
+		// which should resume it later (e.g. post it to the event loop).
+		// Without a scheduler the coroutine simply keeps running.
+		std::size_t chunkBudget = 64 * 1024;
+		std::function<void (std::coroutine_handle<>)> scheduler;
+	};
+
+	struct Reschedule
+	{
+		const std::function<void (std::coroutine_handle<>)> &scheduler;
+
+		bool await_ready() const noexcept
+		{
+			return !scheduler;
+		}
+
+		void await_suspend(const std::coroutine_handle<> handle) const
+		{
+			scheduler(handle);
+		}
+
+		void await_resume() const noexcept
+		{
+		}
+	};
+
+
+	template <typename Alg>
+	class AsyncHasher
+	{
+		// Awaitable wrapper around one of the hash classes.
+		// The object must stay alive until every `addData()` task has completed.
+
+		public:
+			using Byte = uint8_t;
+			using ResultArrayType = typename Alg::ResultArrayType;
+
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+
+			explicit AsyncHasher(AsyncOptions options = {}, Alg hasher = Alg());
+
+			Task<void> addData(Span<const Byte> inData);
+			Task<void> addData(const void *ptr, std::size_t length);
+
+			ResultArrayType finalize();  // hashes the remaining bits & returns `toArray()`
+			void reset();
+
+		private:
+			AsyncOptions m_options;
+			Alg m_hasher;
+	};
+
+
+	//
+	template <typename Alg>
+	AsyncHasher<Alg>::AsyncHasher(AsyncOptions options, Alg hasher)
+		: m_options(std::move(options))
+		, m_hasher(std::move(hasher))
+	{
+	}
+
+	template <typename Alg>
+	Task<void> AsyncHasher<Alg>::addData(Span<const Byte> inData)
+	{
+		if (inData.size() >= m_options.offloadThreshold)
+		{
+			ThreadPool &pool = (m_options.pool != nullptr) ? *m_options.pool : ThreadPool::instance();
+			co_await pool.schedule();
+			m_hasher.addData(inData.data(), inData.size());
+			co_await Reschedule {m_options.scheduler};
+			co_return;
+		}
+
+		const std::size_t budget = std::max<std::size_t>(m_options.chunkBudget, 1);
+		while (!inData.empty())
+		{
+			const std::size_t size = std::min(inData.size(), budget);
+			m_hasher.addData(inData.data(), size);
+			inData = inData.subspan(size);
+
+			if (!inData.empty())
+				co_await Reschedule {m_options.scheduler};
+		}
+	}
+
+	template <typename Alg>
+	Task<void> AsyncHasher<Alg>::addData(const void *ptr, const std::size_t length)
+	{
+		return addData({static_cast<const Byte *>(ptr), length});
+	}
+
+	template <typename Alg>
+	typename AsyncHasher<Alg>::ResultArrayType AsyncHasher<Alg>::finalize()
+	{
+		return m_hasher.finalize().toArray();
+	}
+
+	template <typename Alg>
+	void AsyncHasher<Alg>::reset()
+	{
+		m_hasher.reset();
+	}
+
+	template <typename Alg>
+	Task<typename Alg::ResultArrayType> asyncHash(const std::span<const uint8_t> data, AsyncOptions options = {}, Alg hasher = Alg())
+	{
+		AsyncHasher<Alg> asyncHasher(std::move(options), std::move(hasher));
+		co_await asyncHasher.addData(data);
+		co_return asyncHasher.finalize();
+	}
+
+
+	struct DetachedTask
+	{
+		struct promise_type
+		{
+			DetachedTask get_return_object() const noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never initial_suspend() const noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never final_suspend() const noexcept
+			{
+				return {};
+			}
+
+			void return_void() const noexcept
+			{
+			}
+
+			void unhandled_exception() const noexcept
+			{
+				std::terminate();
+			}
+		};
+	};
+
+	template <typename T>
+	DetachedTask syncWaitImpl(Task<T> task, std::promise<T> *promise)
+	{
+		try
+		{
+			if constexpr (std::is_void_v<T>)
+			{
+				co_await task;
+				promise->set_value();
+			}
+			else
+			{
+				promise->set_value(co_await task);
+			}
+		}
+		catch (...)
+		{
+			promise->set_exception(std::current_exception());
+		}
+	}
+
+	template <typename T>
+	T syncWait(Task<T> task)
+	{
+		// Blocks the calling thread until `task` finishes, don't call it from a `scheduler` thread
+		std::promise<T> promise;
+		std::future<T> future = promise.get_future();
+		syncWaitImpl(std::move(task), &promise);
+		return future.get();
+	}
+}
+}
+	template <typename T>
+	using AsyncTask = Hash::AsyncHash_NS::Task<T>;
+	using AsyncOptions = Hash::AsyncHash_NS::AsyncOptions;
+	using AsyncThreadPool = Hash::AsyncHash_NS::ThreadPool;
+	template <typename Alg>
+	using AsyncHasher = Hash::AsyncHash_NS::AsyncHasher<Alg>;
+	using Hash::AsyncHash_NS::asyncHash;
+	using Hash::AsyncHash_NS::syncWait;
+}
+
+#endif  // HAS_COROUTINE_CHOCOBO1_HASH
+
+#endif  // CHOCOBO1_ASYNC_HASH_H
@@ -45,6 +45,8 @@ namespace Chocobo1
 {
 	// Use these!!
 	// Blake1_224();
+
+	// "abc"_blake1_224;  // C++20, digest as `Blake1_224::ResultArrayType` computed at compile time
 }
 
 
@@ -158,8 +160,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -189,7 +195,21 @@ namespace Hash
 
 namespace Blake1_224_NS
 {
-	class Blake1_224
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr uint32_t cTable[16] =
+		{
+			0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, 0xa4093822, 0x299f31d0, 0x082efa98, 0xec4e6c89,
+			0x452821e6, 0x38d01377, 0xbe5466cf, 0x34e90c6c, 0xc0ac29b7, 0xc97c50dd, 0x3f84d5b5, 0xb5470917
+		};
+	};
+
+	template <typename T>
+	constexpr uint32_t Tables<T>::cTable[16];
+
+
+	class Blake1_224 : private Tables<>
 	{
 		// https://131002.net/blake/
 
@@ -245,16 +265,9 @@ namespace Blake1_224_NS
 
 			static constexpr int BLOCK_SIZE = 64;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
-			uint64_t m_sizeCounter = 0;
-
 			uint32_t m_h[8] = {};
-
-			static constexpr uint32_t cTable[16] =
-			{
-				0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, 0xa4093822, 0x299f31d0, 0x082efa98, 0xec4e6c89,
-				0x452821e6, 0x38d01377, 0xbe5466cf, 0x34e90c6c, 0xc0ac29b7, 0xc97c50dd, 0x3f84d5b5, 0xb5470917
-			};
+			uint64_t m_sizeCounter = 0;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 	};
 
 
@@ -290,6 +303,7 @@ namespace Blake1_224_NS
 	constexpr Blake1_224::Blake1_224()
 	{
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(Blake1_224) < (sizeof(m_buffer) + sizeof(m_sizeCounter) + sizeof(m_h) + alignof(Blake1_224))), "Constant tables should not be stored in each instance");
 		reset();
 	}
 
@@ -315,11 +329,19 @@ namespace Blake1_224_NS
 		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 
 		// append 1 bit
+		const auto messageLen = static_cast<int>(m_buffer.size());
 		m_buffer.fill(1 << 7);
 
-		// append paddings
-		const auto len = static_cast<int>(((2 * BLOCK_SIZE) - (m_buffer.size() + 8)) % BLOCK_SIZE);
-		m_buffer.fill(0, (len + 8));
+		// append paddings, the size field must fit in the last block
+		int lastMessageLen = messageLen;
+		if (m_buffer.size() > (BLOCK_SIZE - 8))
+		{
+			m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
+			addDataImpl({m_buffer.data(), m_buffer.size()}, (BLOCK_SIZE - messageLen));
+			m_buffer.clear();
+			lastMessageLen = 0;  // the counter is zero for a block without message bits
+		}
+		m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
 
 		// append size in bits
 		for (int i = 0; i < 4; ++i)
@@ -328,7 +350,7 @@ namespace Blake1_224_NS
 			m_buffer[m_buffer.size() - 4 + i] = ror<Byte>(sizeCounterBitsL, (8 * (3 - i)));
 		}
 
-		addDataImpl({m_buffer.data(), m_buffer.size()}, (len + 9));
+		addDataImpl({m_buffer.data(), m_buffer.size()}, (BLOCK_SIZE - lastMessageLen));
 		m_buffer.clear();
 
 		return (*this);
@@ -635,6 +657,41 @@ namespace Blake1_224_NS
 	using Blake1_224 = Hash::Blake1_224_NS::Blake1_224;
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval Blake1_224::ResultArrayType operator""_blake1_224(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Blake1_224>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <>
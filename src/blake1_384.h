@@ -45,6 +45,8 @@ namespace Chocobo1
 {
 	// Use these!!
 	// Blake1_384();
+
+	// "abc"_blake1_384;  // C++20, digest as `Blake1_384::ResultArrayType` computed at compile time
 }
 
 
@@ -158,8 +160,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -252,7 +258,21 @@ namespace Hash
 
 namespace Blake1_384_NS
 {
-	class Blake1_384
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr uint64_t cTable[16] =
+		{
+			0x243f6a8885a308d3, 0x13198a2e03707344, 0xa4093822299f31d0, 0x082efa98ec4e6c89, 0x452821e638d01377, 0xbe5466cf34e90c6c, 0xc0ac29b7c97c50dd, 0x3f84d5b5b5470917,
+			0x9216d5d98979fb1b, 0xd1310ba698dfb5ac, 0x2ffd72dbd01adfb7, 0xb8e1afed6a267e96, 0xba7c9045f12c7f99, 0x24a19947b3916cf7, 0x0801f2e2858efc16, 0x636920d871574e69
+		};
+	};
+
+	template <typename T>
+	constexpr uint64_t Tables<T>::cTable[16];
+
+
+	class Blake1_384 : private Tables<>
 	{
 		// https://131002.net/blake/
 
@@ -308,16 +328,9 @@ namespace Blake1_384_NS
 
 			static constexpr int BLOCK_SIZE = 128;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
-			Uint128 m_sizeCounter;
-
 			uint64_t m_h[8] = {};
-
-			static constexpr uint64_t cTable[16] =
-			{
-				0x243f6a8885a308d3, 0x13198a2e03707344, 0xa4093822299f31d0, 0x082efa98ec4e6c89, 0x452821e638d01377, 0xbe5466cf34e90c6c, 0xc0ac29b7c97c50dd, 0x3f84d5b5b5470917,
-				0x9216d5d98979fb1b, 0xd1310ba698dfb5ac, 0x2ffd72dbd01adfb7, 0xb8e1afed6a267e96, 0xba7c9045f12c7f99, 0x24a19947b3916cf7, 0x0801f2e2858efc16, 0x636920d871574e69
-			};
+			Uint128 m_sizeCounter;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 	};
 
 
@@ -357,6 +370,7 @@ namespace Blake1_384_NS
 	constexpr Blake1_384::Blake1_384()
 	{
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(Blake1_384) < (sizeof(m_buffer) + sizeof(m_sizeCounter) + sizeof(m_h) + alignof(Blake1_384))), "Constant tables should not be stored in each instance");
 		reset();
 	}
 
@@ -382,11 +396,19 @@ namespace Blake1_384_NS
 		const uint64_t sizeCounterBitsH = sizeCounterBits.high();
 
 		// append 1 bit
+		const auto messageLen = static_cast<int>(m_buffer.size());
 		m_buffer.fill(1 << 7);
 
-		// append paddings
-		const auto len = static_cast<int>(((2 * BLOCK_SIZE) - (m_buffer.size() + 16)) % BLOCK_SIZE);
-		m_buffer.fill(0, (len + 16));
+		// append paddings, the size field must fit in the last block
+		int lastMessageLen = messageLen;
+		if (m_buffer.size() > (BLOCK_SIZE - 16))
+		{
+			m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
+			addDataImpl({m_buffer.data(), m_buffer.size()}, (BLOCK_SIZE - messageLen));
+			m_buffer.clear();
+			lastMessageLen = 0;  // the counter is zero for a block without message bits
+		}
+		m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
 
 		// append size in bits
 		for (int i = 0; i < 8; ++i)
@@ -395,7 +417,7 @@ namespace Blake1_384_NS
 			m_buffer[m_buffer.size() -  8 + i] = ror<Byte>(sizeCounterBitsL, (8 * (7 - i)));
 		}
 
-		addDataImpl({m_buffer.data(), m_buffer.size()}, (len + 17));
+		addDataImpl({m_buffer.data(), m_buffer.size()}, (BLOCK_SIZE - lastMessageLen));
 		m_buffer.clear();
 
 		return (*this);
@@ -720,6 +742,41 @@ namespace Blake1_384_NS
 	using Blake1_384 = Hash::Blake1_384_NS::Blake1_384;
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval Blake1_384::ResultArrayType operator""_blake1_384(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Blake1_384>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <>
@@ -12,13 +12,16 @@
 #ifndef CHOCOBO1_BLAKE2_H
 #define CHOCOBO1_BLAKE2_H
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <climits>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -45,6 +48,10 @@ namespace Chocobo1
 {
 	// Use these!!
 	// Blake2();
+	// Blake2(const int digestLengthInBytes);  // 1 to 64 bytes, "BLAKE2b-256" is `Blake2(32)`
+	// Blake2bX(const uint32_t outputLengthInBytes, key, salt, personal);  // BLAKE2Xb extendable output, `squeeze()` after `finalize()`
+
+	// "abc"_blake2;  // C++20, digest as `Blake2::ResultArrayType` computed at compile time
 }
 
 
@@ -158,8 +165,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -252,7 +263,40 @@ namespace Hash
 
 namespace Blake2_NS
 {
-	class Blake2
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr uint64_t initializationVector[8] =
+		{
+			0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+			0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+		};
+
+		static constexpr uint8_t sigma[12][16] =
+		{
+			{ 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+			{14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3},
+			{11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4},
+			{ 7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8},
+			{ 9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13},
+			{ 2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9},
+			{12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11},
+			{13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10},
+			{ 6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5},
+			{10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0},
+			{ 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+			{14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3}
+		};
+	};
+
+	template <typename T>
+	constexpr uint64_t Tables<T>::initializationVector[8];
+
+	template <typename T>
+	constexpr uint8_t Tables<T>::sigma[12][16];
+
+
+	class Blake2 : private Tables<>
 	{
 		// https://blake2.net/
 
@@ -270,13 +314,14 @@ namespace Blake2_NS
 
 
 			constexpr Blake2();
+			constexpr explicit Blake2(int digestLength);
 
 			constexpr void reset();
 			CONSTEXPR_CPP17_CHOCOBO1_HASH Blake2& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toString()`, `toVector()` are available
 
 			std::string toString() const;
 			std::vector<Byte> toVector() const;
-			CONSTEXPR_CPP17_CHOCOBO1_HASH ResultArrayType toArray() const;
+			CONSTEXPR_CPP17_CHOCOBO1_HASH ResultArrayType toArray() const;  // bytes past the digest length are zero
 			template <typename T>
 			CONSTEXPR_CPP17_CHOCOBO1_HASH operator T() const noexcept;
 
@@ -304,19 +349,86 @@ namespace Blake2_NS
 			}
 
 		private:
+			friend class Blake2bX;
+
 			constexpr void addDataImpl(Span<const Byte> data, bool isFinal, int paddingLen = 0);
 
 			static constexpr int BLOCK_SIZE = 128;
 
-			Buffer<Byte, BLOCK_SIZE> m_buffer;
+			uint64_t m_h[8] = {};
 			Uint128 m_sizeCounter;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
+			uint8_t m_digestLength = 64;
+	};
 
-			uint64_t m_h[8] = {};
-			const uint64_t m_initializationVector[8] =
-			{
-				0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
-				0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
-			};
+	class Blake2bX : private Tables<>
+	{
+		// BLAKE2Xb: https://www.blake2.net/blake2x.pdf
+		// The root digest `H0` is a BLAKE2b-512 of the message with the output length in its parameter block, output
+		// block `i` is a BLAKE2b of `H0` alone with node offset `i`. The blocks don't depend on each other, so they are
+		// computed several at a time side by side, large requests are spread across threads and `seek()` costs nothing.
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			static constexpr uint32_t MAX_LENGTH = 0xFFFFFFFE;
+			static constexpr uint32_t UNKNOWN_LENGTH = 0xFFFFFFFF;  // up to 256 GiB, the output doesn't depend on how much is read
+
+
+			explicit Blake2bX(uint32_t outputLength, Span<const Byte> key = {}, Span<const Byte> salt = {}, Span<const Byte> personal = {});
+
+			bool isValid() const;  // output length 1 to `MAX_LENGTH` bytes or `UNKNOWN_LENGTH`, key up to 64 bytes, salt & personal up to 16 bytes
+			Blake2bX& setThreads(unsigned int threads);  // default: the number of cores
+
+			void reset();
+			Blake2bX& finalize();  // after this, only `reset()`, `squeeze()`, `seek()`, `position()`, `outputLength()`, `toString()`, `toVector()` are available
+
+			Blake2bX& squeeze(Span<Byte> output);  // the next `output.size()` bytes, bytes past the output length are zero
+			Blake2bX& seek(uint64_t offset);
+			uint64_t position() const;
+			uint64_t outputLength() const;
+
+			std::string toString() const;  // the whole output, empty for `UNKNOWN_LENGTH`
+			std::vector<Byte> toVector() const;
+
+			Blake2bX& addData(Span<const Byte> inData);
+			Blake2bX& addData(const void *ptr, std::size_t length);
+			template <typename T, std::size_t N>
+			Blake2bX& addData(const T (&array)[N]);
+			template <typename T>
+			Blake2bX& addData(Span<T> inSpan);
+
+		private:
+			template <int Lanes>
+			static void mix(uint64_t (&v)[16][Lanes], int a, int b, int c, int d, uint64_t x, uint64_t y);
+			template <int Lanes>
+			void outputBlocks(uint64_t first, std::size_t count, Byte *out) const;  // `count` up to `Lanes` blocks
+			void fillBlocks(uint64_t first, std::size_t count, Byte *out) const;
+			void generate(uint64_t offset, Span<Byte> output) const;
+			std::size_t blockLength(uint64_t block) const;
+
+			static constexpr int OUTPUT_BLOCK_SIZE = 64;
+			static constexpr int LANES = 4;
+			static constexpr std::size_t THREAD_GRAIN = 64 * 1024;  // bytes of output a thread is worth starting for
+
+			Blake2 m_root;
+			uint64_t m_rootParam[8] = {};
+			uint64_t m_nodeParam[8] = {};
+			uint64_t m_h0[8] = {};
+			std::array<Byte, 128> m_keyBlock {};
+			uint64_t m_position = 0;
+			uint32_t m_xofLength = 0;
+			unsigned int m_threads = 0;
+			bool m_hasKey = false;
+			bool m_valid = false;
 	};
 
 
@@ -356,6 +468,14 @@ namespace Blake2_NS
 	constexpr Blake2::Blake2()
 	{
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(Blake2) < (sizeof(m_buffer) + sizeof(m_sizeCounter) + sizeof(m_h) + alignof(Blake2))), "Constant tables should not be stored in each instance");
+		reset();
+	}
+
+	constexpr Blake2::Blake2(const int digestLength)
+		: m_digestLength(static_cast<uint8_t>(digestLength))
+	{
+		assert((digestLength >= 1) && (digestLength <= 64));
 		reset();
 	}
 
@@ -365,9 +485,9 @@ namespace Blake2_NS
 		m_sizeCounter = 0;
 
 		for (int i = 0; i < 8; ++i)
-			m_h[i] = m_initializationVector[i];
+			m_h[i] = initializationVector[i];
 
-		m_h[0] ^= (0x01010000 ^ (0 << 8) ^ 64);
+		m_h[0] ^= (0x01010000 ^ (0 << 8) ^ m_digestLength);
 	}
 
 	CONSTEXPR_CPP17_CHOCOBO1_HASH inline Blake2& Blake2::finalize()
@@ -386,11 +506,12 @@ namespace Blake2_NS
 	{
 		const auto digest = toArray();
 		std::string ret;
-		ret.resize(2 * digest.size());
+		ret.resize(2 * static_cast<std::size_t>(m_digestLength));
 
 		auto *retPtr = &ret.front();
-		for (const auto c : digest)
+		for (int i = 0; i < m_digestLength; ++i)
 		{
+			const Byte c = digest[i];
 			const Byte upper = ror<Byte>(c, 4);
 			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
 
@@ -404,7 +525,7 @@ namespace Blake2_NS
 	inline std::vector<Blake2::Byte> Blake2::toVector() const
 	{
 		const auto digest = toArray();
-		return {digest.begin(), digest.end()};
+		return {digest.begin(), (digest.begin() + m_digestLength)};
 	}
 
 	CONSTEXPR_CPP17_CHOCOBO1_HASH inline Blake2::ResultArrayType Blake2::toArray() const
@@ -419,6 +540,8 @@ namespace Blake2_NS
 			for (int j = 0; j < dataSize; ++j)
 				*(retPtr++) = ror<Byte>(i, (j * 8));
 		}
+		for (std::size_t i = m_digestLength; i < ret.size(); ++i)
+			ret[i] = 0;
 
 		return ret;
 	}
@@ -430,7 +553,7 @@ namespace Blake2_NS
 
 		const auto digest = toArray();
 		T ret = 0;
-		for (int i = 0, iMax = static_cast<int>(std::min(sizeof(T), digest.size())); i < iMax; ++i)
+		for (int i = 0, iMax = static_cast<int>(std::min<std::size_t>(sizeof(T), m_digestLength)); i < iMax; ++i)
 		{
 			ret <<= 8;
 			ret |= digest[i];
@@ -510,11 +633,11 @@ namespace Blake2_NS
 			uint64_t v[16] =
 			{
 				m_h[0], m_h[1], m_h[2], m_h[3], m_h[4], m_h[5], m_h[6], m_h[7],
-				m_initializationVector[0], m_initializationVector[1], m_initializationVector[2], m_initializationVector[3],
-				m_initializationVector[4] ^ m_sizeCounter.low(),
-				m_initializationVector[5] ^ m_sizeCounter.high(),
-				isFinal ? ~m_initializationVector[6] : m_initializationVector[6],
-				m_initializationVector[7]
+				initializationVector[0], initializationVector[1], initializationVector[2], initializationVector[3],
+				initializationVector[4] ^ m_sizeCounter.low(),
+				initializationVector[5] ^ m_sizeCounter.high(),
+				isFinal ? ~initializationVector[6] : initializationVector[6],
+				initializationVector[7]
 			};
 
 			#ifdef blakeMix
@@ -641,11 +764,354 @@ namespace Blake2_NS
 			m_h[7] ^= (v[7] ^ v[15]);
 		}
 	}
+
+	inline Blake2bX::Blake2bX(const uint32_t outputLength, const Span<const Byte> key, const Span<const Byte> salt, const Span<const Byte> personal)
+		: m_xofLength(outputLength)
+		, m_threads(std::max(std::thread::hardware_concurrency(), 1u))
+		, m_valid((outputLength > 0) && (key.size() <= 64) && (salt.size() <= 16) && (personal.size() <= 16))
+	{
+		if (!m_valid)
+			return;
+
+		Byte saltBlock[16] = {};
+		Byte personalBlock[16] = {};
+		std::copy(salt.begin(), salt.end(), saltBlock);
+		std::copy(personal.begin(), personal.end(), personalBlock);
+		const Loader<uint64_t> saltWords(saltBlock);
+		const Loader<uint64_t> personalWords(personalBlock);
+
+		for (int i = 0; i < 8; ++i)
+			m_rootParam[i] = initializationVector[i];
+		m_rootParam[4] ^= saltWords[0];
+		m_rootParam[5] ^= saltWords[1];
+		m_rootParam[6] ^= personalWords[0];
+		m_rootParam[7] ^= personalWords[1];
+		std::copy(std::begin(m_rootParam), std::end(m_rootParam), std::begin(m_nodeParam));
+
+		// root: digest length 64, fanout 1, depth 1, leaf length 0, node offset 0, xof length
+		m_rootParam[0] ^= (64 | (static_cast<uint64_t>(key.size()) << 8) | (1 << 16) | (1 << 24));
+		m_rootParam[1] ^= (static_cast<uint64_t>(outputLength) << 32);
+
+		// output blocks: fanout 0, depth 0, leaf length 64, node depth 0, inner length 64, the digest length & node offset vary
+		m_nodeParam[0] ^= (static_cast<uint64_t>(OUTPUT_BLOCK_SIZE) << 32);
+		m_nodeParam[1] ^= (static_cast<uint64_t>(outputLength) << 32);
+		m_nodeParam[2] ^= (static_cast<uint64_t>(OUTPUT_BLOCK_SIZE) << 8);
+
+		m_hasKey = !key.empty();
+		std::copy(key.begin(), key.end(), m_keyBlock.begin());
+
+		reset();
+	}
+
+	inline bool Blake2bX::isValid() const
+	{
+		return m_valid;
+	}
+
+	inline Blake2bX& Blake2bX::setThreads(const unsigned int threads)
+	{
+		m_threads = std::max(threads, 1u);
+		return (*this);
+	}
+
+	inline void Blake2bX::reset()
+	{
+		m_root.reset();
+		std::copy(std::begin(m_rootParam), std::end(m_rootParam), std::begin(m_root.m_h));
+		if (m_hasKey)
+			m_root.addData(m_keyBlock.data(), m_keyBlock.size());
+
+		for (uint64_t &h : m_h0)
+			h = 0;
+		m_position = 0;
+	}
+
+	inline Blake2bX& Blake2bX::finalize()
+	{
+		m_root.finalize();
+		std::copy(std::begin(m_root.m_h), std::end(m_root.m_h), std::begin(m_h0));
+		return (*this);
+	}
+
+	inline Blake2bX& Blake2bX::squeeze(const Span<Byte> output)
+	{
+		generate(m_position, output);
+		m_position += output.size();
+		return (*this);
+	}
+
+	inline Blake2bX& Blake2bX::seek(const uint64_t offset)
+	{
+		m_position = offset;
+		return (*this);
+	}
+
+	inline uint64_t Blake2bX::position() const
+	{
+		return m_position;
+	}
+
+	inline uint64_t Blake2bX::outputLength() const
+	{
+		return (m_xofLength == UNKNOWN_LENGTH)
+			? (static_cast<uint64_t>(OUTPUT_BLOCK_SIZE) << 32)
+			: m_xofLength;
+	}
+
+	inline std::string Blake2bX::toString() const
+	{
+		const std::vector<Byte> output = toVector();
+		std::string ret;
+		ret.resize(2 * output.size());
+
+		auto *retPtr = &ret.front();
+		for (const Byte c : output)
+		{
+			const Byte upper = ror<Byte>(c, 4);
+			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
+
+			const Byte lower = c & 0xf;
+			*(retPtr++) = static_cast<char>((lower < 10) ? (lower + '0') : (lower - 10 + 'a'));
+		}
+
+		return ret;
+	}
+
+	inline std::vector<Blake2bX::Byte> Blake2bX::toVector() const
+	{
+		if (!m_valid || (m_xofLength == UNKNOWN_LENGTH))
+			return {};
+
+		std::vector<Byte> ret(m_xofLength);
+		generate(0, ret);
+		return ret;
+	}
+
+	inline Blake2bX& Blake2bX::addData(const Span<const Byte> inData)
+	{
+		m_root.addData(inData);
+		return (*this);
+	}
+
+	inline Blake2bX& Blake2bX::addData(const void *ptr, const std::size_t length)
+	{
+		// Span::size_type = std::size_t
+		return addData({static_cast<const Byte*>(ptr), length});
+	}
+
+	template <typename T, std::size_t N>
+	Blake2bX& Blake2bX::addData(const T (&array)[N])
+	{
+		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
+	}
+
+	template <typename T>
+	Blake2bX& Blake2bX::addData(const Span<T> inSpan)
+	{
+		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
+	}
+
+	template <int Lanes>
+	inline void Blake2bX::mix(uint64_t (&v)[16][Lanes], const int a, const int b, const int c, const int d, const uint64_t x, const uint64_t y)
+	{
+		for (int l = 0; l < Lanes; ++l)
+		{
+			v[a][l] = (v[a][l] + v[b][l] + x);
+			v[d][l] = rotr((v[d][l] ^ v[a][l]), 32);
+			v[c][l] = (v[c][l] + v[d][l]);
+			v[b][l] = rotr((v[b][l] ^ v[c][l]), 24);
+			v[a][l] = (v[a][l] + v[b][l] + y);
+			v[d][l] = rotr((v[d][l] ^ v[a][l]), 16);
+			v[c][l] = (v[c][l] + v[d][l]);
+			v[b][l] = rotr((v[b][l] ^ v[c][l]), 63);
+		}
+	}
+
+	template <int Lanes>
+	void Blake2bX::outputBlocks(const uint64_t first, const std::size_t count, Byte *out) const
+	{
+		// every lane compresses the same single block message `H0 || zeros` as the final block,
+		// only the digest length & node offset in the initial state differ
+		assert((count > 0) && (count <= Lanes));
+
+		uint64_t h[8][Lanes];
+		uint64_t v[16][Lanes];
+		std::size_t lengths[Lanes];
+		for (int l = 0; l < Lanes; ++l)
+		{
+			const uint64_t block = first + std::min<std::size_t>(static_cast<std::size_t>(l), (count - 1));
+			lengths[l] = blockLength(block);
+			for (int i = 0; i < 8; ++i)
+				h[i][l] = m_nodeParam[i];
+			h[0][l] ^= lengths[l];
+			h[1][l] ^= block;
+
+			for (int i = 0; i < 8; ++i)
+			{
+				v[i][l] = h[i][l];
+				v[i + 8][l] = initializationVector[i];
+			}
+			v[12][l] ^= static_cast<uint64_t>(OUTPUT_BLOCK_SIZE);
+			v[14][l] = ~v[14][l];
+		}
+
+		uint64_t m[16] = {};
+		std::copy(std::begin(m_h0), std::end(m_h0), m);
+
+		for (const auto &s : sigma)
+		{
+			mix(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+			mix(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+			mix(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+			mix(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+			mix(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+			mix(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+			mix(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+			mix(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+		}
+
+		for (std::size_t l = 0; l < count; ++l)
+		{
+			Byte digest[OUTPUT_BLOCK_SIZE];
+			for (int i = 0; i < 8; ++i)
+			{
+				const uint64_t word = h[i][l] ^ v[i][l] ^ v[i + 8][l];
+				for (int j = 0; j < 8; ++j)
+					digest[(i * 8) + j] = ror<Byte>(word, static_cast<unsigned int>(j * 8));
+			}
+			std::memcpy((out + (l * OUTPUT_BLOCK_SIZE)), digest, lengths[l]);
+		}
+	}
+
+	inline void Blake2bX::fillBlocks(const uint64_t first, const std::size_t count, Byte *out) const
+	{
+		const auto fill = [this, first, out](std::size_t begin, const std::size_t end) -> void
+		{
+			for (; (end - begin) >= LANES; begin += LANES)
+				outputBlocks<LANES>((first + begin), LANES, (out + (begin * OUTPUT_BLOCK_SIZE)));
+			if (begin < end)
+				outputBlocks<LANES>((first + begin), (end - begin), (out + (begin * OUTPUT_BLOCK_SIZE)));
+		};
+
+		const std::size_t workers = std::min<std::size_t>(m_threads, ((count * OUTPUT_BLOCK_SIZE) / THREAD_GRAIN));
+		if (workers <= 1)
+		{
+			fill(0, count);
+			return;
+		}
+
+		// whole groups of lanes per thread
+		const std::size_t chunk = ((((count + workers - 1) / workers) + LANES - 1) / LANES) * LANES;
+		std::vector<std::thread> pool;
+		for (std::size_t begin = chunk; begin < count; begin += chunk)
+			pool.emplace_back(fill, begin, std::min((begin + chunk), count));
+		fill(0, std::min(chunk, count));
+		for (std::thread &t : pool)
+			t.join();
+	}
+
+	inline void Blake2bX::generate(const uint64_t offset, const Span<Byte> output) const
+	{
+		Byte *out = output.data();
+		std::size_t size = output.size();
+		if (!m_valid)
+		{
+			std::fill(out, (out + size), Byte(0));
+			return;
+		}
+
+		// bytes past the end
+		const uint64_t total = outputLength();
+		const uint64_t available = (offset < total) ? (total - offset) : 0;
+		if (size > available)
+		{
+			const auto valid = static_cast<std::size_t>(available);
+			std::fill((out + valid), (out + size), Byte(0));
+			size = valid;
+		}
+		if (size == 0)
+			return;
+
+		Byte block[OUTPUT_BLOCK_SIZE];
+		uint64_t index = offset / OUTPUT_BLOCK_SIZE;
+
+		// a partial first block
+		const auto skip = static_cast<std::size_t>(offset % OUTPUT_BLOCK_SIZE);
+		if ((skip != 0) || (size < blockLength(index)))
+		{
+			outputBlocks<1>(index, 1, block);
+			const std::size_t len = std::min(size, (blockLength(index) - skip));
+			std::memcpy(out, (block + skip), len);
+			out += len;
+			size -= len;
+			++index;
+		}
+
+		// whole blocks, the last block of a known length output may be short
+		std::size_t count = size / OUTPUT_BLOCK_SIZE;
+		std::size_t rest = size % OUTPUT_BLOCK_SIZE;
+		if ((rest != 0) && (blockLength(index + count) == rest))
+		{
+			++count;
+			rest = 0;
+		}
+		if (count > 0)
+			fillBlocks(index, count, out);
+
+		// a partial last block
+		if (rest != 0)
+		{
+			outputBlocks<1>((index + count), 1, block);
+			std::memcpy((out + (size - rest)), block, rest);
+		}
+	}
+
+	inline std::size_t Blake2bX::blockLength(const uint64_t block) const
+	{
+		const uint64_t remaining = outputLength() - (block * OUTPUT_BLOCK_SIZE);
+		return static_cast<std::size_t>(std::min<uint64_t>(remaining, OUTPUT_BLOCK_SIZE));
+	}
 }
 }
 
 	using Blake2 = Hash::Blake2_NS::Blake2;
+	using Blake2bX = Hash::Blake2_NS::Blake2bX;
+}
+
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval Blake2::ResultArrayType operator""_blake2(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Blake2>(str, length);
+	}
+}
 }
+#endif
 
 namespace std
 {
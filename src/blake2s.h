@@ -12,13 +12,16 @@
 #ifndef CHOCOBO1_BLAKE2S_H
 #define CHOCOBO1_BLAKE2S_H
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <climits>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -45,6 +48,9 @@ namespace Chocobo1
 {
 	// Use these!!
 	// Blake2s();
+	// Blake2sX(const uint16_t outputLengthInBytes, key, salt, personal);  // BLAKE2Xs extendable output, `squeeze()` after `finalize()`
+
+	// "abc"_blake2s;  // C++20, digest as `Blake2s::ResultArrayType` computed at compile time
 }
 
 
@@ -158,8 +164,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -189,7 +199,38 @@ namespace Hash
 
 namespace Blake2s_NS
 {
-	class Blake2s
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr uint32_t initializationVector[8] =
+		{
+			0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+			0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+		};
+
+		static constexpr uint8_t sigma[10][16] =
+		{
+			{ 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+			{14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3},
+			{11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4},
+			{ 7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8},
+			{ 9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13},
+			{ 2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9},
+			{12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11},
+			{13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10},
+			{ 6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5},
+			{10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0}
+		};
+	};
+
+	template <typename T>
+	constexpr uint32_t Tables<T>::initializationVector[8];
+
+	template <typename T>
+	constexpr uint8_t Tables<T>::sigma[10][16];
+
+
+	class Blake2s : private Tables<>
 	{
 		// https://blake2.net/
 
@@ -241,19 +282,84 @@ namespace Blake2s_NS
 			}
 
 		private:
+			friend class Blake2sX;
+
 			constexpr void addDataImpl(Span<const Byte> data, bool isFinal, int paddingLen = 0);
 
 			static constexpr int BLOCK_SIZE = 64;
 
-			Buffer<Byte, BLOCK_SIZE> m_buffer;
+			uint32_t m_h[8] = {};
 			uint64_t m_sizeCounter = 0;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
+	};
 
-			uint32_t m_h[8] = {};
-			const uint32_t m_initializationVector[8] =
-			{
-				0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
-				0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
-			};
+	class Blake2sX : private Tables<>
+	{
+		// BLAKE2Xs: https://www.blake2.net/blake2x.pdf
+		// Same construction as `Blake2bX` on BLAKE2s: 32-byte output blocks, each an independent BLAKE2s of the root digest
+		// with its own node offset, computed 8 at a time side by side & spread across threads for large requests.
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			static constexpr uint16_t MAX_LENGTH = 0xFFFE;
+			static constexpr uint16_t UNKNOWN_LENGTH = 0xFFFF;  // up to 128 GiB, the output doesn't depend on how much is read
+
+
+			explicit Blake2sX(uint16_t outputLength, Span<const Byte> key = {}, Span<const Byte> salt = {}, Span<const Byte> personal = {});
+
+			bool isValid() const;  // output length 1 to `MAX_LENGTH` bytes or `UNKNOWN_LENGTH`, key up to 32 bytes, salt & personal up to 8 bytes
+			Blake2sX& setThreads(unsigned int threads);  // default: the number of cores
+
+			void reset();
+			Blake2sX& finalize();  // after this, only `reset()`, `squeeze()`, `seek()`, `position()`, `outputLength()`, `toString()`, `toVector()` are available
+
+			Blake2sX& squeeze(Span<Byte> output);  // the next `output.size()` bytes, bytes past the output length are zero
+			Blake2sX& seek(uint64_t offset);
+			uint64_t position() const;
+			uint64_t outputLength() const;
+
+			std::string toString() const;  // the whole output, empty for `UNKNOWN_LENGTH`
+			std::vector<Byte> toVector() const;
+
+			Blake2sX& addData(Span<const Byte> inData);
+			Blake2sX& addData(const void *ptr, std::size_t length);
+			template <typename T, std::size_t N>
+			Blake2sX& addData(const T (&array)[N]);
+			template <typename T>
+			Blake2sX& addData(Span<T> inSpan);
+
+		private:
+			template <int Lanes>
+			static void mix(uint32_t (&v)[16][Lanes], int a, int b, int c, int d, uint32_t x, uint32_t y);
+			template <int Lanes>
+			void outputBlocks(uint64_t first, std::size_t count, Byte *out) const;  // `count` up to `Lanes` blocks
+			void fillBlocks(uint64_t first, std::size_t count, Byte *out) const;
+			void generate(uint64_t offset, Span<Byte> output) const;
+			std::size_t blockLength(uint64_t block) const;
+
+			static constexpr int OUTPUT_BLOCK_SIZE = 32;
+			static constexpr int LANES = 8;
+			static constexpr std::size_t THREAD_GRAIN = 64 * 1024;  // bytes of output a thread is worth starting for
+
+			Blake2s m_root;
+			uint32_t m_rootParam[8] = {};
+			uint32_t m_nodeParam[8] = {};
+			uint32_t m_h0[8] = {};
+			std::array<Byte, 64> m_keyBlock {};
+			uint64_t m_position = 0;
+			uint16_t m_xofLength = 0;
+			unsigned int m_threads = 0;
+			bool m_hasKey = false;
+			bool m_valid = false;
 	};
 
 
@@ -290,6 +396,7 @@ namespace Blake2s_NS
 	constexpr Blake2s::Blake2s()
 	{
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(Blake2s) < (sizeof(m_buffer) + sizeof(m_sizeCounter) + sizeof(m_h) + alignof(Blake2s))), "Constant tables should not be stored in each instance");
 		reset();
 	}
 
@@ -299,7 +406,7 @@ namespace Blake2s_NS
 		m_sizeCounter = 0;
 
 		for (int i = 0; i < 8; ++i)
-			m_h[i] = m_initializationVector[i];
+			m_h[i] = initializationVector[i];
 
 		m_h[0] ^= (0x01010000 ^ (0 << 8) ^ 32);
 	}
@@ -444,11 +551,11 @@ namespace Blake2s_NS
 			uint32_t v[16] =
 			{
 				m_h[0], m_h[1], m_h[2], m_h[3], m_h[4], m_h[5], m_h[6], m_h[7],
-				m_initializationVector[0], m_initializationVector[1], m_initializationVector[2], m_initializationVector[3],
-				m_initializationVector[4] ^ ror<uint32_t>(m_sizeCounter, 0),
-				m_initializationVector[5] ^ ror<uint32_t>(m_sizeCounter, 32),
-				isFinal ? ~m_initializationVector[6] : m_initializationVector[6],
-				m_initializationVector[7]
+				initializationVector[0], initializationVector[1], initializationVector[2], initializationVector[3],
+				initializationVector[4] ^ ror<uint32_t>(m_sizeCounter, 0),
+				initializationVector[5] ^ ror<uint32_t>(m_sizeCounter, 32),
+				isFinal ? ~initializationVector[6] : initializationVector[6],
+				initializationVector[7]
 			};
 
 			#ifdef blakeMix
@@ -559,12 +666,349 @@ namespace Blake2s_NS
 			m_h[7] ^= (v[7] ^ v[15]);
 		}
 	}
+
+	inline Blake2sX::Blake2sX(const uint16_t outputLength, const Span<const Byte> key, const Span<const Byte> salt, const Span<const Byte> personal)
+		: m_xofLength(outputLength)
+		, m_threads(std::max(std::thread::hardware_concurrency(), 1u))
+		, m_valid((outputLength > 0) && (key.size() <= 32) && (salt.size() <= 8) && (personal.size() <= 8))
+	{
+		if (!m_valid)
+			return;
+
+		Byte saltBlock[8] = {};
+		Byte personalBlock[8] = {};
+		std::copy(salt.begin(), salt.end(), saltBlock);
+		std::copy(personal.begin(), personal.end(), personalBlock);
+		const Loader<uint32_t> saltWords(saltBlock);
+		const Loader<uint32_t> personalWords(personalBlock);
+
+		for (int i = 0; i < 8; ++i)
+			m_rootParam[i] = initializationVector[i];
+		m_rootParam[4] ^= saltWords[0];
+		m_rootParam[5] ^= saltWords[1];
+		m_rootParam[6] ^= personalWords[0];
+		m_rootParam[7] ^= personalWords[1];
+		std::copy(std::begin(m_rootParam), std::end(m_rootParam), std::begin(m_nodeParam));
+
+		// root: digest length 32, fanout 1, depth 1, leaf length 0, node offset 0, xof length
+		m_rootParam[0] ^= (32 | (static_cast<uint32_t>(key.size()) << 8) | (1 << 16) | (1 << 24));
+		m_rootParam[3] ^= outputLength;
+
+		// output blocks: fanout 0, depth 0, leaf length 32, node depth 0, inner length 32, the digest length & node offset vary
+		m_nodeParam[1] ^= static_cast<uint32_t>(OUTPUT_BLOCK_SIZE);
+		m_nodeParam[3] ^= (outputLength | (static_cast<uint32_t>(OUTPUT_BLOCK_SIZE) << 24));
+
+		m_hasKey = !key.empty();
+		std::copy(key.begin(), key.end(), m_keyBlock.begin());
+
+		reset();
+	}
+
+	inline bool Blake2sX::isValid() const
+	{
+		return m_valid;
+	}
+
+	inline Blake2sX& Blake2sX::setThreads(const unsigned int threads)
+	{
+		m_threads = std::max(threads, 1u);
+		return (*this);
+	}
+
+	inline void Blake2sX::reset()
+	{
+		m_root.reset();
+		std::copy(std::begin(m_rootParam), std::end(m_rootParam), std::begin(m_root.m_h));
+		if (m_hasKey)
+			m_root.addData(m_keyBlock.data(), m_keyBlock.size());
+
+		for (uint32_t &h : m_h0)
+			h = 0;
+		m_position = 0;
+	}
+
+	inline Blake2sX& Blake2sX::finalize()
+	{
+		m_root.finalize();
+		std::copy(std::begin(m_root.m_h), std::end(m_root.m_h), std::begin(m_h0));
+		return (*this);
+	}
+
+	inline Blake2sX& Blake2sX::squeeze(const Span<Byte> output)
+	{
+		generate(m_position, output);
+		m_position += output.size();
+		return (*this);
+	}
+
+	inline Blake2sX& Blake2sX::seek(const uint64_t offset)
+	{
+		m_position = offset;
+		return (*this);
+	}
+
+	inline uint64_t Blake2sX::position() const
+	{
+		return m_position;
+	}
+
+	inline uint64_t Blake2sX::outputLength() const
+	{
+		return (m_xofLength == UNKNOWN_LENGTH)
+			? (static_cast<uint64_t>(OUTPUT_BLOCK_SIZE) << 32)
+			: m_xofLength;
+	}
+
+	inline std::string Blake2sX::toString() const
+	{
+		const std::vector<Byte> output = toVector();
+		std::string ret;
+		ret.resize(2 * output.size());
+
+		auto *retPtr = &ret.front();
+		for (const Byte c : output)
+		{
+			const Byte upper = ror<Byte>(c, 4);
+			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
+
+			const Byte lower = c & 0xf;
+			*(retPtr++) = static_cast<char>((lower < 10) ? (lower + '0') : (lower - 10 + 'a'));
+		}
+
+		return ret;
+	}
+
+	inline std::vector<Blake2sX::Byte> Blake2sX::toVector() const
+	{
+		if (!m_valid || (m_xofLength == UNKNOWN_LENGTH))
+			return {};
+
+		std::vector<Byte> ret(m_xofLength);
+		generate(0, ret);
+		return ret;
+	}
+
+	inline Blake2sX& Blake2sX::addData(const Span<const Byte> inData)
+	{
+		m_root.addData(inData);
+		return (*this);
+	}
+
+	inline Blake2sX& Blake2sX::addData(const void *ptr, const std::size_t length)
+	{
+		// Span::size_type = std::size_t
+		return addData({static_cast<const Byte*>(ptr), length});
+	}
+
+	template <typename T, std::size_t N>
+	Blake2sX& Blake2sX::addData(const T (&array)[N])
+	{
+		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
+	}
+
+	template <typename T>
+	Blake2sX& Blake2sX::addData(const Span<T> inSpan)
+	{
+		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
+	}
+
+	template <int Lanes>
+	inline void Blake2sX::mix(uint32_t (&v)[16][Lanes], const int a, const int b, const int c, const int d, const uint32_t x, const uint32_t y)
+	{
+		for (int l = 0; l < Lanes; ++l)
+		{
+			v[a][l] = (v[a][l] + v[b][l] + x);
+			v[d][l] = rotr((v[d][l] ^ v[a][l]), 16);
+			v[c][l] = (v[c][l] + v[d][l]);
+			v[b][l] = rotr((v[b][l] ^ v[c][l]), 12);
+			v[a][l] = (v[a][l] + v[b][l] + y);
+			v[d][l] = rotr((v[d][l] ^ v[a][l]), 8);
+			v[c][l] = (v[c][l] + v[d][l]);
+			v[b][l] = rotr((v[b][l] ^ v[c][l]), 7);
+		}
+	}
+
+	template <int Lanes>
+	void Blake2sX::outputBlocks(const uint64_t first, const std::size_t count, Byte *out) const
+	{
+		// every lane compresses the same single block message `H0 || zeros` as the final block,
+		// only the digest length & node offset in the initial state differ
+		assert((count > 0) && (count <= Lanes));
+
+		uint32_t h[8][Lanes];
+		uint32_t v[16][Lanes];
+		std::size_t lengths[Lanes];
+		for (int l = 0; l < Lanes; ++l)
+		{
+			const uint64_t block = first + std::min<std::size_t>(static_cast<std::size_t>(l), (count - 1));
+			lengths[l] = blockLength(block);
+			for (int i = 0; i < 8; ++i)
+				h[i][l] = m_nodeParam[i];
+			h[0][l] ^= static_cast<uint32_t>(lengths[l]);
+			h[2][l] ^= static_cast<uint32_t>(block);
+
+			for (int i = 0; i < 8; ++i)
+			{
+				v[i][l] = h[i][l];
+				v[i + 8][l] = initializationVector[i];
+			}
+			v[12][l] ^= static_cast<uint32_t>(OUTPUT_BLOCK_SIZE);
+			v[14][l] = ~v[14][l];
+		}
+
+		uint32_t m[16] = {};
+		std::copy(std::begin(m_h0), std::end(m_h0), m);
+
+		for (const auto &s : sigma)
+		{
+			mix(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+			mix(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+			mix(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+			mix(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+			mix(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+			mix(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+			mix(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+			mix(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+		}
+
+		for (std::size_t l = 0; l < count; ++l)
+		{
+			Byte digest[OUTPUT_BLOCK_SIZE];
+			for (int i = 0; i < 8; ++i)
+			{
+				const uint32_t word = h[i][l] ^ v[i][l] ^ v[i + 8][l];
+				for (int j = 0; j < 4; ++j)
+					digest[(i * 4) + j] = ror<Byte>(word, static_cast<unsigned int>(j * 8));
+			}
+			std::memcpy((out + (l * OUTPUT_BLOCK_SIZE)), digest, lengths[l]);
+		}
+	}
+
+	inline void Blake2sX::fillBlocks(const uint64_t first, const std::size_t count, Byte *out) const
+	{
+		const auto fill = [this, first, out](std::size_t begin, const std::size_t end) -> void
+		{
+			for (; (end - begin) >= LANES; begin += LANES)
+				outputBlocks<LANES>((first + begin), LANES, (out + (begin * OUTPUT_BLOCK_SIZE)));
+			if (begin < end)
+				outputBlocks<LANES>((first + begin), (end - begin), (out + (begin * OUTPUT_BLOCK_SIZE)));
+		};
+
+		const std::size_t workers = std::min<std::size_t>(m_threads, ((count * OUTPUT_BLOCK_SIZE) / THREAD_GRAIN));
+		if (workers <= 1)
+		{
+			fill(0, count);
+			return;
+		}
+
+		// whole groups of lanes per thread
+		const std::size_t chunk = ((((count + workers - 1) / workers) + LANES - 1) / LANES) * LANES;
+		std::vector<std::thread> pool;
+		for (std::size_t begin = chunk; begin < count; begin += chunk)
+			pool.emplace_back(fill, begin, std::min((begin + chunk), count));
+		fill(0, std::min(chunk, count));
+		for (std::thread &t : pool)
+			t.join();
+	}
+
+	inline void Blake2sX::generate(const uint64_t offset, const Span<Byte> output) const
+	{
+		Byte *out = output.data();
+		std::size_t size = output.size();
+
+		// bytes past the end
+		const uint64_t total = outputLength();
+		const uint64_t available = (offset < total) ? (total - offset) : 0;
+		if (size > available)
+		{
+			const auto valid = static_cast<std::size_t>(available);
+			std::fill((out + valid), (out + size), Byte(0));
+			size = valid;
+		}
+		if (!m_valid || (size == 0))
+			return;
+
+		Byte block[OUTPUT_BLOCK_SIZE];
+		uint64_t index = offset / OUTPUT_BLOCK_SIZE;
+
+		// a partial first block
+		const auto skip = static_cast<std::size_t>(offset % OUTPUT_BLOCK_SIZE);
+		if ((skip != 0) || (size < blockLength(index)))
+		{
+			outputBlocks<1>(index, 1, block);
+			const std::size_t len = std::min(size, (blockLength(index) - skip));
+			std::memcpy(out, (block + skip), len);
+			out += len;
+			size -= len;
+			++index;
+		}
+
+		// whole blocks, the last block of a known length output may be short
+		std::size_t count = size / OUTPUT_BLOCK_SIZE;
+		std::size_t rest = size % OUTPUT_BLOCK_SIZE;
+		if ((rest != 0) && (blockLength(index + count) == rest))
+		{
+			++count;
+			rest = 0;
+		}
+		if (count > 0)
+			fillBlocks(index, count, out);
+
+		// a partial last block
+		if (rest != 0)
+		{
+			outputBlocks<1>((index + count), 1, block);
+			std::memcpy((out + (size - rest)), block, rest);
+		}
+	}
+
+	inline std::size_t Blake2sX::blockLength(const uint64_t block) const
+	{
+		const uint64_t remaining = outputLength() - (block * OUTPUT_BLOCK_SIZE);
+		return static_cast<std::size_t>(std::min<uint64_t>(remaining, OUTPUT_BLOCK_SIZE));
+	}
 }
 }
 
 	using Blake2s = Hash::Blake2s_NS::Blake2s;
+	using Blake2sX = Hash::Blake2s_NS::Blake2sX;
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval Blake2s::ResultArrayType operator""_blake2s(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Blake2s>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <>
@@ -0,0 +1,380 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_BLOCK_LIST_HASH_H
+#define CHOCOBO1_BLOCK_LIST_HASH_H
+
+#include "md5.h"
+#include "multi_buffer.h"
+#include "sha1.h"
+#include "sha2_256.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// S3ETag().addData(...).finalize().toETag();  // "<hex>-<part count>", 8 MiB parts by default
+	// S3ETag(16 * 1024 * 1024);  // part size as used by the upload
+	// DropboxContentHash().addData(...).finalize().toString();  // 4 MiB blocks
+	// BlockListHash<Inner, Outer>(partSize).setThreads(8).addData(...).finalize().toString();
+
+	// Outer(Inner(part 0) || Inner(part 1) || ...), the last part may be shorter, no data means no parts.
+	// Whole parts within a single `addData()` call are hashed across threads, `MD5`, `SHA1` & `SHA2_256`
+	// parts also go through `MultiBuffer` lanes. Feed big spans (e.g. a mmaped file) to make use of it.
+	// A single part S3 upload has a plain MD5 ETag, this always computes the multipart form.
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace BlockListHash_NS
+{
+	// inner hashers with a `MultiBuffer` kernel
+	template <typename T>
+	struct HasLanes : std::false_type {};
+	template <>
+	struct HasLanes<MD5> : std::true_type {};
+	template <>
+	struct HasLanes<SHA1> : std::true_type {};
+	template <>
+	struct HasLanes<SHA2_256> : std::true_type {};
+
+
+	template <typename Inner, typename Outer = Inner>
+	class BlockListHash
+	{
+		public:
+			using Byte = uint8_t;
+			using ResultArrayType = decltype(std::declval<Outer>().toArray());
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			explicit BlockListHash(uint64_t partSize, const Inner &inner = Inner(), const Outer &outer = Outer());
+
+			BlockListHash& setThreads(unsigned int threads);  // default: the number of cores
+
+			bool isValid() const;  // `false` for a zero part size
+
+			void reset();
+			BlockListHash& finalize();  // after this, only `partCount()`, `reset()`, `toArray()`, `toETag()`, `toString()`, `toVector()` are available
+
+			uint64_t partCount() const;  // parts so far, the last partial one counts after `finalize()`
+			std::string toString() const;
+			std::string toETag() const;  // S3 multipart form: `toString()` + '-' + `partCount()`, the plain `Inner` digest for empty input
+			std::vector<Byte> toVector() const;
+			ResultArrayType toArray() const;
+
+			BlockListHash& addData(Span<const Byte> inData);
+			BlockListHash& addData(const void *ptr, std::size_t length);
+			template <typename T, std::size_t N>
+			BlockListHash& addData(const T (&array)[N]);
+			template <typename T>
+			BlockListHash& addData(Span<T> inSpan);
+
+		private:
+			// variable length digests (e.g. `SHAKE_128`) only have `toVector()`
+			using InnerResult = typename std::conditional<HasLanes<Inner>::value, typename Inner::ResultArrayType, std::vector<Byte>>::type;
+
+			// digests of `count` whole parts starting at `data`
+			void hashParts(const Byte *data, std::size_t count, InnerResult *results, std::true_type) const;
+			void hashParts(const Byte *data, std::size_t count, InnerResult *results, std::false_type) const;
+			void addParts(const Byte *data, uint64_t count);
+
+			Inner m_innerPrototype;
+			Outer m_outerPrototype;
+			Inner m_part;
+			Outer m_outer;
+			uint64_t m_partSize = 0;
+			uint64_t m_partFill = 0;  // bytes in `m_part`
+			uint64_t m_partCount = 0;
+			unsigned int m_threads = 0;
+	};
+
+	class S3ETag : public BlockListHash<MD5, MD5>
+	{
+		public:
+			static constexpr uint64_t DEFAULT_PART_SIZE = 8 * 1024 * 1024;  // AWS CLI `multipart_chunksize`
+
+			explicit S3ETag(const uint64_t partSize = DEFAULT_PART_SIZE)
+				: BlockListHash(partSize)
+			{
+			}
+	};
+
+	class DropboxContentHash : public BlockListHash<SHA2_256, SHA2_256>
+	{
+		public:
+			static constexpr uint64_t BLOCK_SIZE = 4 * 1024 * 1024;
+
+			DropboxContentHash()
+				: BlockListHash(BLOCK_SIZE)
+			{
+			}
+	};
+
+
+	//
+	template <typename Inner, typename Outer>
+	BlockListHash<Inner, Outer>::BlockListHash(const uint64_t partSize, const Inner &inner, const Outer &outer)
+		: m_innerPrototype(inner)
+		, m_outerPrototype(outer)
+		, m_part(inner)
+		, m_outer(outer)
+		, m_partSize(partSize)
+		, m_threads(std::max(std::thread::hardware_concurrency(), 1u))
+	{
+	}
+
+	template <typename Inner, typename Outer>
+	BlockListHash<Inner, Outer>& BlockListHash<Inner, Outer>::setThreads(const unsigned int threads)
+	{
+		m_threads = std::max(threads, 1u);
+		return (*this);
+	}
+
+	template <typename Inner, typename Outer>
+	bool BlockListHash<Inner, Outer>::isValid() const
+	{
+		return (m_partSize > 0);
+	}
+
+	template <typename Inner, typename Outer>
+	void BlockListHash<Inner, Outer>::reset()
+	{
+		m_part = m_innerPrototype;
+		m_outer = m_outerPrototype;
+		m_partFill = 0;
+		m_partCount = 0;
+	}
+
+	template <typename Inner, typename Outer>
+	BlockListHash<Inner, Outer>& BlockListHash<Inner, Outer>::finalize()
+	{
+		if (m_partFill > 0)
+		{
+			m_outer.addData(m_part.finalize().toVector());
+			++m_partCount;
+			m_partFill = 0;
+		}
+		m_outer.finalize();
+		return (*this);
+	}
+
+	template <typename Inner, typename Outer>
+	uint64_t BlockListHash<Inner, Outer>::partCount() const
+	{
+		return m_partCount;
+	}
+
+	template <typename Inner, typename Outer>
+	std::string BlockListHash<Inner, Outer>::toString() const
+	{
+		return m_outer.toString();
+	}
+
+	template <typename Inner, typename Outer>
+	std::string BlockListHash<Inner, Outer>::toETag() const
+	{
+		if (m_partCount == 0)
+		{
+			// S3 gives an empty object the plain digest of no data, without a part count
+			Inner empty = m_part;
+			empty.reset();
+			return empty.finalize().toString();
+		}
+		return (toString() + '-' + std::to_string(m_partCount));
+	}
+
+	template <typename Inner, typename Outer>
+	std::vector<typename BlockListHash<Inner, Outer>::Byte> BlockListHash<Inner, Outer>::toVector() const
+	{
+		return m_outer.toVector();
+	}
+
+	template <typename Inner, typename Outer>
+	typename BlockListHash<Inner, Outer>::ResultArrayType BlockListHash<Inner, Outer>::toArray() const
+	{
+		return m_outer.toArray();
+	}
+
+	template <typename Inner, typename Outer>
+	BlockListHash<Inner, Outer>& BlockListHash<Inner, Outer>::addData(const Span<const Byte> inData)
+	{
+		assert(isValid());
+
+		const Byte *data = inData.data();
+		uint64_t size = static_cast<uint64_t>(inData.size());
+
+		// top up the pending part first
+		if (m_partFill > 0)
+		{
+			const uint64_t len = std::min((m_partSize - m_partFill), size);
+			m_part.addData(data, static_cast<std::size_t>(len));
+			m_partFill += len;
+			data += len;
+			size -= len;
+
+			if (m_partFill < m_partSize)
+				return (*this);
+
+			m_outer.addData(m_part.finalize().toVector());
+			++m_partCount;
+			m_part = m_innerPrototype;
+			m_partFill = 0;
+		}
+
+		const uint64_t wholeParts = size / m_partSize;
+		addParts(data, wholeParts);
+		data += (wholeParts * m_partSize);
+		size -= (wholeParts * m_partSize);
+
+		if (size > 0)
+		{
+			m_part.addData(data, static_cast<std::size_t>(size));
+			m_partFill = size;
+		}
+		return (*this);
+	}
+
+	template <typename Inner, typename Outer>
+	BlockListHash<Inner, Outer>& BlockListHash<Inner, Outer>::addData(const void *ptr, const std::size_t length)
+	{
+		return addData({static_cast<const Byte*>(ptr), length});
+	}
+
+	template <typename Inner, typename Outer>
+	template <typename T, std::size_t N>
+	BlockListHash<Inner, Outer>& BlockListHash<Inner, Outer>::addData(const T (&array)[N])
+	{
+		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
+	}
+
+	template <typename Inner, typename Outer>
+	template <typename T>
+	BlockListHash<Inner, Outer>& BlockListHash<Inner, Outer>::addData(const Span<T> inSpan)
+	{
+		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
+	}
+
+	template <typename Inner, typename Outer>
+	void BlockListHash<Inner, Outer>::addParts(const Byte *data, const uint64_t count)
+	{
+		if (count == 0)
+			return;
+
+		// a window of parts is hashed in parallel, then the digests go into the outer hasher in order
+		const std::size_t lanes = HasLanes<Inner>::value ? MultiBuffer<Inner>::LANES : 1;
+		const std::size_t window = std::max<std::size_t>((m_threads * lanes * 4), 1);
+		std::vector<InnerResult> results(static_cast<std::size_t>(std::min<uint64_t>(count, window)));
+
+		for (uint64_t done = 0; done < count; )
+		{
+			const auto windowParts = static_cast<std::size_t>(std::min<uint64_t>(window, (count - done)));
+			const Byte *windowData = data + (done * m_partSize);
+
+			// every worker takes `lanes` parts at a time
+			const std::size_t groups = (windowParts + lanes - 1) / lanes;
+			const auto workers = static_cast<unsigned int>(std::min<std::size_t>(m_threads, groups));
+			std::atomic<std::size_t> nextGroup {0};
+			const auto worker = [&]() -> void
+			{
+				for (std::size_t g = nextGroup++; g < groups; g = nextGroup++)
+				{
+					const std::size_t first = g * lanes;
+					const std::size_t n = std::min(lanes, (windowParts - first));
+					hashParts((windowData + (first * m_partSize)), n, (results.data() + first), HasLanes<Inner>());
+				}
+			};
+
+			std::vector<std::thread> pool;
+			for (unsigned int i = 1; i < workers; ++i)
+				pool.emplace_back(worker);
+			worker();
+			for (std::thread &t : pool)
+				t.join();
+
+			for (std::size_t i = 0; i < windowParts; ++i)
+				m_outer.addData(results[i]);
+			m_partCount += windowParts;
+			done += windowParts;
+		}
+	}
+
+	template <typename Inner, typename Outer>
+	void BlockListHash<Inner, Outer>::hashParts(const Byte *data, const std::size_t count, InnerResult *results, std::true_type) const
+	{
+		using MultiHash = MultiBuffer<Inner>;
+		using PartSpan = typename MultiHash::template Span<const Byte>;
+
+		std::vector<PartSpan> messages;
+		messages.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			messages.emplace_back((data + (i * m_partSize)), static_cast<std::size_t>(m_partSize));
+
+		MultiHash::hash(messages, {results, count});
+	}
+
+	template <typename Inner, typename Outer>
+	void BlockListHash<Inner, Outer>::hashParts(const Byte *data, const std::size_t count, InnerResult *results, std::false_type) const
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Inner hasher = m_innerPrototype;
+			results[i] = hasher.addData((data + (i * m_partSize)), static_cast<std::size_t>(m_partSize)).finalize().toVector();
+		}
+	}
+}
+}
+	template <typename Inner, typename Outer = Inner>
+	using BlockListHash = Hash::BlockListHash_NS::BlockListHash<Inner, Outer>;
+	using S3ETag = Hash::BlockListHash_NS::S3ETag;
+	using DropboxContentHash = Hash::BlockListHash_NS::DropboxContentHash;
+}
+
+#endif  // CHOCOBO1_BLOCK_LIST_HASH_H
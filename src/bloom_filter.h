@@ -0,0 +1,959 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_BLOOM_FILTER_H
+#define CHOCOBO1_BLOOM_FILTER_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+#if (defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86)))
+#include <intrin.h>
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// BloomFilter<SipHash>(SipHash(key), expectedItems, falsePositiveRate);
+	// BloomFilter<HighwayHash128>(HighwayHash128(key), blockCount, hashCount);
+	// CountMinSketch<FNV64_1a>(FNV64_1a(), width, depth);
+	// BloomFilter<SipHash>::view(mappedFile, SipHash(key));  // read only, uses the memory in place
+
+	// Every key is hashed once. The digest (at least 8 bytes) is split into two halves `h1`, `h2`,
+	// the i-th index is derived as `h1 + i * h2` (Kirsch & Mitzenmacher, "Less Hashing, Same Performance").
+	// BloomFilter: `h1` picks a 64-byte block (one cache line), all bits of a key are set within it.
+	// `serialize()` writes a 64-byte header followed by the little endian table. `view()` uses such a buffer
+	// in place when it is suitably aligned, e.g. a mapped file (page aligned, so blocks stay on cache lines).
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace BloomFilter_NS
+{
+	using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+	template <typename T, std::size_t Extent = std::dynamic_extent>
+	using Span = std::span<T, Extent>;
+#else
+	template <typename T, std::size_t Extent = gsl::dynamic_extent>
+	using Span = gsl::span<T, Extent>;
+#endif
+
+	static constexpr std::size_t ALIGNMENT = 64;
+	static constexpr std::size_t HEADER_SIZE = 64;
+	static constexpr std::size_t BATCH_SIZE = 16;  // keys hashed & prefetched ahead of the memory accesses
+	static constexpr uint32_t FORMAT_VERSION = 1;
+
+	inline void prefetch(const void *ptr)
+	{
+#if (defined(__GNUC__) || defined(__clang__))
+		__builtin_prefetch(ptr);
+#elif (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+		_mm_prefetch(static_cast<const char *>(ptr), _MM_HINT_T0);
+#else
+		static_cast<void>(ptr);
+#endif
+	}
+
+	inline bool isLittleEndian()
+	{
+		const uint16_t value = 1;
+		Byte bytes[sizeof(value)] = {};
+		std::memcpy(bytes, &value, sizeof(value));
+		return (bytes[0] == 1);
+	}
+
+	template <typename T>
+	void storeLE(Byte *out, const T value)
+	{
+		for (std::size_t i = 0; i < sizeof(T); ++i)
+			out[i] = static_cast<Byte>(static_cast<uint64_t>(value) >> (8 * i));
+	}
+
+	template <typename T>
+	T loadLE(const Byte *in)
+	{
+		uint64_t value = 0;
+		for (std::size_t i = 0; i < sizeof(T); ++i)
+			value |= (static_cast<uint64_t>(in[i]) << (8 * i));
+		return static_cast<T>(value);
+	}
+
+	struct KeyHash
+	{
+		uint64_t h1;
+		uint64_t h2;
+	};
+
+	template <typename H>
+	KeyHash hashKey(H hasher, const void *ptr, const std::size_t length)
+	{
+		const auto digest = hasher.addData(ptr, length).finalize().toArray();
+		constexpr std::size_t size = std::tuple_size<typename std::remove_const<decltype(digest)>::type>::value;
+		static_assert((size >= 8), "The digest should be at least 8 bytes");
+
+		// 128 bits or more: two 64-bit halves, otherwise two 32-bit halves
+		if (size >= 16)
+			return {loadLE<uint64_t>(&digest[0]), loadLE<uint64_t>(&digest[8])};
+		return {loadLE<uint32_t>(&digest[0]), loadLE<uint32_t>(&digest[4])};
+	}
+
+	// containers with 1-byte or wider elements (std::string, std::vector, spans...)
+	template <typename Key>
+	std::size_t keyLength(const Key &key)
+	{
+		return (key.size() * sizeof(*key.data()));
+	}
+
+	template <typename T>
+	class Table
+	{
+		// 64-byte aligned array, either owned or a read only view of memory owned by someone else
+
+		public:
+			Table() = default;
+
+			explicit Table(const std::size_t size)
+				: m_buffer(new T[size + (ALIGNMENT / sizeof(T))]())
+				, m_data(align(m_buffer.get()))
+				, m_size(size)
+			{
+			}
+
+			Table(const T *external, const std::size_t size)
+				: m_data(const_cast<T *>(external))
+				, m_size(size)
+			{
+			}
+
+			Table(const Table &other)
+				: Table(other.m_data, other.m_size)
+			{
+				if (other.m_buffer)
+				{
+					Table copy(other.m_size);
+					std::copy(other.m_data, (other.m_data + other.m_size), copy.m_data);
+					*this = std::move(copy);
+				}
+			}
+
+			Table(Table &&other) noexcept
+				: m_buffer(std::move(other.m_buffer))
+				, m_data(other.m_data)
+				, m_size(other.m_size)
+			{
+				other.m_data = nullptr;
+				other.m_size = 0;
+			}
+
+			Table& operator=(Table other) noexcept
+			{
+				std::swap(m_buffer, other.m_buffer);
+				std::swap(m_data, other.m_data);
+				std::swap(m_size, other.m_size);
+				return (*this);
+			}
+
+			bool isView() const
+			{
+				return (!m_buffer && (m_data != nullptr));
+			}
+
+			std::size_t size() const
+			{
+				return m_size;
+			}
+
+			const T* data() const
+			{
+				return m_data;
+			}
+
+			T* mutableData()
+			{
+				assert(!isView());
+				return m_data;
+			}
+
+		private:
+			static T* align(T *ptr)
+			{
+				const auto offset = static_cast<std::size_t>(reinterpret_cast<uintptr_t>(ptr) % ALIGNMENT);
+				return (offset == 0) ? ptr : reinterpret_cast<T *>(reinterpret_cast<Byte *>(ptr) + (ALIGNMENT - offset));
+			}
+
+			std::unique_ptr<T[]> m_buffer;
+			T *m_data = nullptr;
+			std::size_t m_size = 0;
+	};
+
+	// header: magic[8], version, parameter (u32), columns, entries, item count (u64), entry size (u32), zeros
+	struct Header
+	{
+		uint32_t parameter = 0;
+		uint64_t columns = 0;
+		uint64_t entries = 0;
+		uint64_t items = 0;
+		uint32_t entrySize = 0;
+	};
+
+	template <typename T>
+	std::vector<Byte> serializeTable(const char (&magic)[9], const Header &header, const Table<T> &table)
+	{
+		std::vector<Byte> out(HEADER_SIZE + (table.size() * sizeof(T)), 0);
+		std::copy(magic, (magic + 8), out.begin());
+		storeLE<uint32_t>(&out[8], FORMAT_VERSION);
+		storeLE<uint32_t>(&out[12], header.parameter);
+		storeLE<uint64_t>(&out[16], header.columns);
+		storeLE<uint64_t>(&out[24], header.entries);
+		storeLE<uint64_t>(&out[32], header.items);
+		storeLE<uint32_t>(&out[40], header.entrySize);
+
+		Byte *ptr = out.data() + HEADER_SIZE;
+		for (std::size_t i = 0; i < table.size(); ++i, ptr += sizeof(T))
+			storeLE<T>(ptr, table.data()[i]);
+		return out;
+	}
+
+	template <typename T>
+	bool parseTable(const char (&magic)[9], const Span<const Byte> data, Header &header)
+	{
+		if ((data.size() < HEADER_SIZE) || !std::equal(magic, (magic + 8), data.data())
+			|| (loadLE<uint32_t>(&data[8]) != FORMAT_VERSION))
+			return false;
+
+		header.parameter = loadLE<uint32_t>(&data[12]);
+		header.columns = loadLE<uint64_t>(&data[16]);
+		header.entries = loadLE<uint64_t>(&data[24]);
+		header.items = loadLE<uint64_t>(&data[32]);
+		header.entrySize = loadLE<uint32_t>(&data[40]);
+		return ((header.entrySize == sizeof(T))
+			&& (header.entries <= ((data.size() - HEADER_SIZE) / sizeof(T)))
+			&& (static_cast<std::size_t>(data.size()) == (HEADER_SIZE + (header.entries * sizeof(T)))));
+	}
+
+	template <typename T>
+	Table<T> loadTable(const Span<const Byte> data, const std::size_t size, const bool inPlace)
+	{
+		const Byte *ptr = data.data() + HEADER_SIZE;
+		if (inPlace)
+		{
+			// the file is little endian already & used as is
+			if (!isLittleEndian() || ((reinterpret_cast<uintptr_t>(ptr) % alignof(T)) != 0))
+				return {};
+			return {reinterpret_cast<const T *>(ptr), size};
+		}
+
+		Table<T> table(size);
+		for (std::size_t i = 0; i < size; ++i, ptr += sizeof(T))
+			table.mutableData()[i] = loadLE<T>(ptr);
+		return table;
+	}
+
+
+	template <typename H>
+	class BloomFilter
+	{
+		// Blocked Bloom filter (Putze, Sanders & Singler, "Cache-, Hash- and Space-Efficient Bloom Filters"):
+		// each key sets `hashCount` bits within a single 512-bit block, so a lookup touches one cache line.
+		// The bit positions are `(h2 + i * step) % 512` with an odd step taken from `h2`, they never repeat.
+
+		public:
+			using Byte = BloomFilter_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename U, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<U, Extent>;
+#else
+			template <typename U, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<U, Extent>;
+#endif
+
+			static constexpr std::size_t BLOCK_WORDS = 8;  // 512 bits
+			static constexpr int MAX_HASH_COUNT = 16;
+
+			// sized for `expectedItems` at the given false positive rate, blocking costs ~1 extra bit per key
+			BloomFilter(const H &prototype, std::size_t expectedItems, double falsePositiveRate);
+			BloomFilter(const H &prototype, std::size_t blockCount, int hashCount);
+
+			// `data` from `serialize()`, the hasher (and key) must be the one the filter was built with
+			static BloomFilter load(Span<const Byte> data, const H &prototype);  // copies the table
+			static BloomFilter view(Span<const Byte> data, const H &prototype);  // read only, `data` must outlive the filter
+
+			bool isValid() const;  // `false` for bad parameters or data
+			bool isView() const;
+
+			BloomFilter& clear();
+			BloomFilter& insert(const void *ptr, std::size_t length);
+			template <typename Key>
+			BloomFilter& insert(const Key &key);
+			template <typename Keys>
+			BloomFilter& insertAll(const Keys &keys);
+
+			bool contains(const void *ptr, std::size_t length) const;
+			template <typename Key>
+			bool contains(const Key &key) const;
+			template <typename Keys>
+			std::size_t containsAll(const Keys &keys, Span<bool> results) const;  // returns the number of hits
+
+			bool merge(const BloomFilter &other);  // union, both must have the same parameters
+
+			std::size_t blockCount() const;
+			int hashCount() const;
+			uint64_t itemCount() const;  // insertions so far, duplicates included
+			std::size_t sizeBytes() const;
+
+			std::vector<Byte> serialize() const;
+
+		private:
+			static constexpr char MAGIC[9] = "CHOBLOOM";
+
+			BloomFilter(const H &prototype, Table<uint64_t> &&table, int hashCount, uint64_t items);
+
+			const uint64_t* block(const KeyHash &hash) const;
+			void makeMask(const KeyHash &hash, uint64_t (&mask)[BLOCK_WORDS]) const;
+			void insertHash(const KeyHash &hash);
+			bool containsHash(const KeyHash &hash) const;
+
+			H m_prototype;
+			Table<uint64_t> m_table;
+			int m_hashCount = 0;
+			uint64_t m_items = 0;
+	};
+
+
+	template <typename H, typename Counter = uint32_t>
+	class CountMinSketch
+	{
+		// Count-min sketch (Cormode & Muthukrishnan): `depth` rows of `width` saturating counters,
+		// row i counts the key at column `(h1 + i * h2) % width`. `estimate()` never underestimates,
+		// with `width = e / epsilon` & `depth = ln(1 / delta)` it overestimates by more than
+		// `epsilon * total()` with probability at most `delta`.
+
+		public:
+			using Byte = BloomFilter_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename U, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<U, Extent>;
+#else
+			template <typename U, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<U, Extent>;
+#endif
+
+			static_assert((std::is_integral<Counter>::value && std::is_unsigned<Counter>::value), "Counter should be an unsigned integer");
+
+			CountMinSketch(const H &prototype, std::size_t width, int depth);
+			CountMinSketch(const H &prototype, double epsilon, double delta);
+
+			static CountMinSketch load(Span<const Byte> data, const H &prototype);
+			static CountMinSketch view(Span<const Byte> data, const H &prototype);
+
+			bool isValid() const;
+			bool isView() const;
+
+			CountMinSketch& clear();
+			CountMinSketch& add(const void *ptr, std::size_t length, Counter count = 1);
+			template <typename Key>
+			CountMinSketch& add(const Key &key, Counter count = 1);
+			template <typename Keys>
+			CountMinSketch& addAll(const Keys &keys);
+
+			Counter estimate(const void *ptr, std::size_t length) const;
+			template <typename Key>
+			Counter estimate(const Key &key) const;
+			template <typename Keys>
+			void estimateAll(const Keys &keys, Span<Counter> results) const;
+
+			bool merge(const CountMinSketch &other);  // sum, both must have the same parameters
+
+			std::size_t width() const;
+			int depth() const;
+			uint64_t total() const;  // sum of all added counts
+			std::size_t sizeBytes() const;
+
+			std::vector<Byte> serialize() const;
+
+		private:
+			static constexpr char MAGIC[9] = "CHOCMSKT";
+
+			CountMinSketch(const H &prototype, Table<Counter> &&table, std::size_t width, int depth, uint64_t total);
+
+			std::size_t column(const KeyHash &hash, int row) const;
+			void prefetchHash(const KeyHash &hash) const;
+			void addHash(const KeyHash &hash, Counter count);
+			Counter estimateHash(const KeyHash &hash) const;
+
+			H m_prototype;
+			Table<Counter> m_table;
+			std::size_t m_width = 0;
+			int m_depth = 0;
+			uint64_t m_total = 0;
+	};
+
+
+	//
+	template <typename H>
+	constexpr char BloomFilter<H>::MAGIC[9];
+
+	template <typename H>
+	BloomFilter<H>::BloomFilter(const H &prototype, const std::size_t expectedItems, const double falsePositiveRate)
+		: m_prototype(prototype)
+	{
+		if ((expectedItems == 0) || !(falsePositiveRate > 0) || !(falsePositiveRate < 1))
+			return;
+
+		const double ln2 = std::log(2.0);
+		const double bitsPerItem = (-std::log(falsePositiveRate) / (ln2 * ln2)) + 1;
+		const double hashCount = std::round((bitsPerItem - 1) * ln2);
+		const double bits = std::ceil(bitsPerItem * static_cast<double>(expectedItems));
+
+		m_hashCount = static_cast<int>(std::max(1.0, std::min(hashCount, static_cast<double>(MAX_HASH_COUNT))));
+		m_table = Table<uint64_t>(static_cast<std::size_t>(std::ceil(bits / 512)) * BLOCK_WORDS);
+	}
+
+	template <typename H>
+	BloomFilter<H>::BloomFilter(const H &prototype, const std::size_t blockCount, const int hashCount)
+		: m_prototype(prototype)
+	{
+		if ((blockCount == 0) || (hashCount < 1) || (hashCount > MAX_HASH_COUNT))
+			return;
+
+		m_hashCount = hashCount;
+		m_table = Table<uint64_t>(blockCount * BLOCK_WORDS);
+	}
+
+	template <typename H>
+	BloomFilter<H>::BloomFilter(const H &prototype, Table<uint64_t> &&table, const int hashCount, const uint64_t items)
+		: m_prototype(prototype)
+		, m_table(std::move(table))
+		, m_hashCount((m_table.data() != nullptr) ? hashCount : 0)
+		, m_items(items)
+	{
+	}
+
+	template <typename H>
+	BloomFilter<H> BloomFilter<H>::load(const Span<const Byte> data, const H &prototype)
+	{
+		Header header;
+		if (!parseTable<uint64_t>(MAGIC, data, header) || (header.parameter < 1) || (header.parameter > MAX_HASH_COUNT)
+			|| (header.columns == 0) || (header.entries != (header.columns * BLOCK_WORDS)))
+			return {prototype, Table<uint64_t>(), 0, 0};
+		return {prototype, loadTable<uint64_t>(data, static_cast<std::size_t>(header.entries), false), static_cast<int>(header.parameter), header.items};
+	}
+
+	template <typename H>
+	BloomFilter<H> BloomFilter<H>::view(const Span<const Byte> data, const H &prototype)
+	{
+		Header header;
+		if (!parseTable<uint64_t>(MAGIC, data, header) || (header.parameter < 1) || (header.parameter > MAX_HASH_COUNT)
+			|| (header.columns == 0) || (header.entries != (header.columns * BLOCK_WORDS)))
+			return {prototype, Table<uint64_t>(), 0, 0};
+		return {prototype, loadTable<uint64_t>(data, static_cast<std::size_t>(header.entries), true), static_cast<int>(header.parameter), header.items};
+	}
+
+	template <typename H>
+	bool BloomFilter<H>::isValid() const
+	{
+		return (m_hashCount > 0);
+	}
+
+	template <typename H>
+	bool BloomFilter<H>::isView() const
+	{
+		return m_table.isView();
+	}
+
+	template <typename H>
+	BloomFilter<H>& BloomFilter<H>::clear()
+	{
+		assert(isValid());
+		std::fill(m_table.mutableData(), (m_table.mutableData() + m_table.size()), uint64_t(0));
+		m_items = 0;
+		return (*this);
+	}
+
+	template <typename H>
+	const uint64_t* BloomFilter<H>::block(const KeyHash &hash) const
+	{
+		return (m_table.data() + ((hash.h1 % blockCount()) * BLOCK_WORDS));
+	}
+
+	template <typename H>
+	void BloomFilter<H>::makeMask(const KeyHash &hash, uint64_t (&mask)[BLOCK_WORDS]) const
+	{
+		const auto start = static_cast<uint32_t>(hash.h2 & 0xFFFF);
+		const auto step = static_cast<uint32_t>((hash.h2 >> 16) & 0xFFFF) | 1;
+
+		std::fill(std::begin(mask), std::end(mask), uint64_t(0));
+		for (int i = 0; i < m_hashCount; ++i)
+		{
+			const uint32_t bit = (start + (static_cast<uint32_t>(i) * step)) % 512;
+			mask[bit / 64] |= (uint64_t(1) << (bit % 64));
+		}
+	}
+
+	template <typename H>
+	void BloomFilter<H>::insertHash(const KeyHash &hash)
+	{
+		uint64_t mask[BLOCK_WORDS];
+		makeMask(hash, mask);
+
+		uint64_t *words = m_table.mutableData() + (block(hash) - m_table.data());
+		for (std::size_t i = 0; i < BLOCK_WORDS; ++i)
+			words[i] |= mask[i];
+		++m_items;
+	}
+
+	template <typename H>
+	bool BloomFilter<H>::containsHash(const KeyHash &hash) const
+	{
+		uint64_t mask[BLOCK_WORDS];
+		makeMask(hash, mask);
+
+		// whole block at once, no early exit: the compiler turns this into vector and-not/or
+		const uint64_t *words = block(hash);
+		uint64_t missing = 0;
+		for (std::size_t i = 0; i < BLOCK_WORDS; ++i)
+			missing |= (mask[i] & ~words[i]);
+		return (missing == 0);
+	}
+
+	template <typename H>
+	BloomFilter<H>& BloomFilter<H>::insert(const void *ptr, const std::size_t length)
+	{
+		assert(isValid());
+		insertHash(hashKey(m_prototype, ptr, length));
+		return (*this);
+	}
+
+	template <typename H>
+	template <typename Key>
+	BloomFilter<H>& BloomFilter<H>::insert(const Key &key)
+	{
+		return insert(key.data(), keyLength(key));
+	}
+
+	template <typename H>
+	template <typename Keys>
+	BloomFilter<H>& BloomFilter<H>::insertAll(const Keys &keys)
+	{
+		assert(isValid());
+
+		KeyHash hashes[BATCH_SIZE];
+		std::size_t size = 0;
+		for (const auto &key : keys)
+		{
+			hashes[size] = hashKey(m_prototype, key.data(), keyLength(key));
+			prefetch(block(hashes[size]));
+			if (++size == BATCH_SIZE)
+			{
+				for (std::size_t i = 0; i < size; ++i)
+					insertHash(hashes[i]);
+				size = 0;
+			}
+		}
+		for (std::size_t i = 0; i < size; ++i)
+			insertHash(hashes[i]);
+		return (*this);
+	}
+
+	template <typename H>
+	bool BloomFilter<H>::contains(const void *ptr, const std::size_t length) const
+	{
+		assert(isValid());
+		return containsHash(hashKey(m_prototype, ptr, length));
+	}
+
+	template <typename H>
+	template <typename Key>
+	bool BloomFilter<H>::contains(const Key &key) const
+	{
+		return contains(key.data(), keyLength(key));
+	}
+
+	template <typename H>
+	template <typename Keys>
+	std::size_t BloomFilter<H>::containsAll(const Keys &keys, const Span<bool> results) const
+	{
+		assert(isValid());
+
+		KeyHash hashes[BATCH_SIZE];
+		std::size_t size = 0;
+		std::size_t index = 0;
+		std::size_t hits = 0;
+		const auto flush = [&]() -> void
+		{
+			for (std::size_t i = 0; i < size; ++i, ++index)
+			{
+				const bool found = containsHash(hashes[i]);
+				results[index] = found;
+				hits += (found ? 1 : 0);
+			}
+			size = 0;
+		};
+
+		for (const auto &key : keys)
+		{
+			assert((index + size) < static_cast<std::size_t>(results.size()));
+			hashes[size] = hashKey(m_prototype, key.data(), keyLength(key));
+			prefetch(block(hashes[size]));
+			if (++size == BATCH_SIZE)
+				flush();
+		}
+		flush();
+		return hits;
+	}
+
+	template <typename H>
+	bool BloomFilter<H>::merge(const BloomFilter &other)
+	{
+		if (!isValid() || isView() || (other.m_hashCount != m_hashCount) || (other.m_table.size() != m_table.size()))
+			return false;
+
+		uint64_t *words = m_table.mutableData();
+		for (std::size_t i = 0; i < m_table.size(); ++i)
+			words[i] |= other.m_table.data()[i];
+		m_items += other.m_items;
+		return true;
+	}
+
+	template <typename H>
+	std::size_t BloomFilter<H>::blockCount() const
+	{
+		return (m_table.size() / BLOCK_WORDS);
+	}
+
+	template <typename H>
+	int BloomFilter<H>::hashCount() const
+	{
+		return m_hashCount;
+	}
+
+	template <typename H>
+	uint64_t BloomFilter<H>::itemCount() const
+	{
+		return m_items;
+	}
+
+	template <typename H>
+	std::size_t BloomFilter<H>::sizeBytes() const
+	{
+		return (m_table.size() * sizeof(uint64_t));
+	}
+
+	template <typename H>
+	std::vector<Byte> BloomFilter<H>::serialize() const
+	{
+		assert(isValid());
+
+		Header header;
+		header.parameter = static_cast<uint32_t>(m_hashCount);
+		header.columns = blockCount();
+		header.entries = m_table.size();
+		header.items = m_items;
+		header.entrySize = sizeof(uint64_t);
+		return serializeTable(MAGIC, header, m_table);
+	}
+
+
+	//
+	template <typename H, typename Counter>
+	constexpr char CountMinSketch<H, Counter>::MAGIC[9];
+
+	template <typename H, typename Counter>
+	CountMinSketch<H, Counter>::CountMinSketch(const H &prototype, const std::size_t width, const int depth)
+		: m_prototype(prototype)
+	{
+		if ((width == 0) || (depth < 1) || (depth > 64))
+			return;
+
+		m_width = width;
+		m_depth = depth;
+		m_table = Table<Counter>(width * static_cast<std::size_t>(depth));
+	}
+
+	template <typename H, typename Counter>
+	CountMinSketch<H, Counter>::CountMinSketch(const H &prototype, const double epsilon, const double delta)
+		: CountMinSketch(prototype
+			, (((epsilon > 0) && (epsilon < 1)) ? static_cast<std::size_t>(std::ceil(std::exp(1.0) / epsilon)) : 0)
+			, (((delta > 0) && (delta < 1)) ? static_cast<int>(std::ceil(std::log(1 / delta))) : 0))
+	{
+	}
+
+	template <typename H, typename Counter>
+	CountMinSketch<H, Counter>::CountMinSketch(const H &prototype, Table<Counter> &&table, const std::size_t width, const int depth, const uint64_t total)
+		: m_prototype(prototype)
+		, m_table(std::move(table))
+		, m_width((m_table.data() != nullptr) ? width : 0)
+		, m_depth((m_table.data() != nullptr) ? depth : 0)
+		, m_total(total)
+	{
+	}
+
+	template <typename H, typename Counter>
+	CountMinSketch<H, Counter> CountMinSketch<H, Counter>::load(const Span<const Byte> data, const H &prototype)
+	{
+		Header header;
+		if (!parseTable<Counter>(MAGIC, data, header) || (header.parameter < 1) || (header.parameter > 64)
+			|| (header.columns == 0) || (header.entries != (header.columns * header.parameter)))
+			return {prototype, Table<Counter>(), 0, 0, 0};
+		return {prototype, loadTable<Counter>(data, static_cast<std::size_t>(header.entries), false)
+			, static_cast<std::size_t>(header.columns), static_cast<int>(header.parameter), header.items};
+	}
+
+	template <typename H, typename Counter>
+	CountMinSketch<H, Counter> CountMinSketch<H, Counter>::view(const Span<const Byte> data, const H &prototype)
+	{
+		Header header;
+		if (!parseTable<Counter>(MAGIC, data, header) || (header.parameter < 1) || (header.parameter > 64)
+			|| (header.columns == 0) || (header.entries != (header.columns * header.parameter)))
+			return {prototype, Table<Counter>(), 0, 0, 0};
+		return {prototype, loadTable<Counter>(data, static_cast<std::size_t>(header.entries), true)
+			, static_cast<std::size_t>(header.columns), static_cast<int>(header.parameter), header.items};
+	}
+
+	template <typename H, typename Counter>
+	bool CountMinSketch<H, Counter>::isValid() const
+	{
+		return (m_depth > 0);
+	}
+
+	template <typename H, typename Counter>
+	bool CountMinSketch<H, Counter>::isView() const
+	{
+		return m_table.isView();
+	}
+
+	template <typename H, typename Counter>
+	CountMinSketch<H, Counter>& CountMinSketch<H, Counter>::clear()
+	{
+		assert(isValid());
+		std::fill(m_table.mutableData(), (m_table.mutableData() + m_table.size()), Counter(0));
+		m_total = 0;
+		return (*this);
+	}
+
+	template <typename H, typename Counter>
+	std::size_t CountMinSketch<H, Counter>::column(const KeyHash &hash, const int row) const
+	{
+		return static_cast<std::size_t>((hash.h1 + (static_cast<uint64_t>(row) * hash.h2)) % m_width);
+	}
+
+	template <typename H, typename Counter>
+	void CountMinSketch<H, Counter>::prefetchHash(const KeyHash &hash) const
+	{
+		for (int row = 0; row < m_depth; ++row)
+			prefetch(m_table.data() + ((static_cast<std::size_t>(row) * m_width) + column(hash, row)));
+	}
+
+	template <typename H, typename Counter>
+	void CountMinSketch<H, Counter>::addHash(const KeyHash &hash, const Counter count)
+	{
+		Counter *counters = m_table.mutableData();
+		for (int row = 0; row < m_depth; ++row)
+		{
+			Counter &counter = counters[(static_cast<std::size_t>(row) * m_width) + column(hash, row)];
+			counter = (counter > (std::numeric_limits<Counter>::max() - count))
+				? std::numeric_limits<Counter>::max()
+				: static_cast<Counter>(counter + count);
+		}
+		m_total += count;
+	}
+
+	template <typename H, typename Counter>
+	Counter CountMinSketch<H, Counter>::estimateHash(const KeyHash &hash) const
+	{
+		Counter result = std::numeric_limits<Counter>::max();
+		for (int row = 0; row < m_depth; ++row)
+			result = std::min(result, m_table.data()[(static_cast<std::size_t>(row) * m_width) + column(hash, row)]);
+		return result;
+	}
+
+	template <typename H, typename Counter>
+	CountMinSketch<H, Counter>& CountMinSketch<H, Counter>::add(const void *ptr, const std::size_t length, const Counter count)
+	{
+		assert(isValid());
+		addHash(hashKey(m_prototype, ptr, length), count);
+		return (*this);
+	}
+
+	template <typename H, typename Counter>
+	template <typename Key>
+	CountMinSketch<H, Counter>& CountMinSketch<H, Counter>::add(const Key &key, const Counter count)
+	{
+		return add(key.data(), keyLength(key), count);
+	}
+
+	template <typename H, typename Counter>
+	template <typename Keys>
+	CountMinSketch<H, Counter>& CountMinSketch<H, Counter>::addAll(const Keys &keys)
+	{
+		assert(isValid());
+
+		KeyHash hashes[BATCH_SIZE];
+		std::size_t size = 0;
+		for (const auto &key : keys)
+		{
+			hashes[size] = hashKey(m_prototype, key.data(), keyLength(key));
+			prefetchHash(hashes[size]);
+			if (++size == BATCH_SIZE)
+			{
+				for (std::size_t i = 0; i < size; ++i)
+					addHash(hashes[i], 1);
+				size = 0;
+			}
+		}
+		for (std::size_t i = 0; i < size; ++i)
+			addHash(hashes[i], 1);
+		return (*this);
+	}
+
+	template <typename H, typename Counter>
+	Counter CountMinSketch<H, Counter>::estimate(const void *ptr, const std::size_t length) const
+	{
+		assert(isValid());
+		return estimateHash(hashKey(m_prototype, ptr, length));
+	}
+
+	template <typename H, typename Counter>
+	template <typename Key>
+	Counter CountMinSketch<H, Counter>::estimate(const Key &key) const
+	{
+		return estimate(key.data(), keyLength(key));
+	}
+
+	template <typename H, typename Counter>
+	template <typename Keys>
+	void CountMinSketch<H, Counter>::estimateAll(const Keys &keys, const Span<Counter> results) const
+	{
+		assert(isValid());
+
+		KeyHash hashes[BATCH_SIZE];
+		std::size_t size = 0;
+		std::size_t index = 0;
+		const auto flush = [&]() -> void
+		{
+			for (std::size_t i = 0; i < size; ++i, ++index)
+				results[index] = estimateHash(hashes[i]);
+			size = 0;
+		};
+
+		for (const auto &key : keys)
+		{
+			assert((index + size) < static_cast<std::size_t>(results.size()));
+			hashes[size] = hashKey(m_prototype, key.data(), keyLength(key));
+			prefetchHash(hashes[size]);
+			if (++size == BATCH_SIZE)
+				flush();
+		}
+		flush();
+	}
+
+	template <typename H, typename Counter>
+	bool CountMinSketch<H, Counter>::merge(const CountMinSketch &other)
+	{
+		if (!isValid() || isView() || (other.m_width != m_width) || (other.m_depth != m_depth))
+			return false;
+
+		Counter *counters = m_table.mutableData();
+		for (std::size_t i = 0; i < m_table.size(); ++i)
+		{
+			const Counter count = other.m_table.data()[i];
+			counters[i] = (counters[i] > (std::numeric_limits<Counter>::max() - count))
+				? std::numeric_limits<Counter>::max()
+				: static_cast<Counter>(counters[i] + count);
+		}
+		m_total += other.m_total;
+		return true;
+	}
+
+	template <typename H, typename Counter>
+	std::size_t CountMinSketch<H, Counter>::width() const
+	{
+		return m_width;
+	}
+
+	template <typename H, typename Counter>
+	int CountMinSketch<H, Counter>::depth() const
+	{
+		return m_depth;
+	}
+
+	template <typename H, typename Counter>
+	uint64_t CountMinSketch<H, Counter>::total() const
+	{
+		return m_total;
+	}
+
+	template <typename H, typename Counter>
+	std::size_t CountMinSketch<H, Counter>::sizeBytes() const
+	{
+		return (m_table.size() * sizeof(Counter));
+	}
+
+	template <typename H, typename Counter>
+	std::vector<Byte> CountMinSketch<H, Counter>::serialize() const
+	{
+		assert(isValid());
+
+		Header header;
+		header.parameter = static_cast<uint32_t>(m_depth);
+		header.columns = m_width;
+		header.entries = m_table.size();
+		header.items = m_total;
+		header.entrySize = sizeof(Counter);
+		return serializeTable(MAGIC, header, m_table);
+	}
+}
+}
+	template <typename H>
+	using BloomFilter = Hash::BloomFilter_NS::BloomFilter<H>;
+	template <typename H, typename Counter = uint32_t>
+	using CountMinSketch = Hash::BloomFilter_NS::CountMinSketch<H, Counter>;
+}
+
+#endif  // CHOCOBO1_BLOOM_FILTER_H
@@ -0,0 +1,718 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_CRC_H
+#define CHOCOBO1_CRC_H
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
+// carry-less multiplication folding for reflected 64-bit CRCs, chosen at run time when the CPU supports it
+// define `USE_X86_CLMUL_CHOCOBO1_HASH` to 0 to always use the tables
+#ifndef USE_X86_CLMUL_CHOCOBO1_HASH
+#if (defined(__x86_64__) || defined(_M_X64))
+#if defined(__has_builtin)
+#if (__has_builtin(__builtin_is_constant_evaluated) && __has_builtin(__builtin_cpu_supports))
+#define USE_X86_CLMUL_CHOCOBO1_HASH 1
+#endif
+#elif (defined(_MSC_VER) && (_MSC_VER >= 1925))
+#define USE_X86_CLMUL_CHOCOBO1_HASH 1
+#endif
+#endif
+#endif
+#ifndef USE_X86_CLMUL_CHOCOBO1_HASH
+#define USE_X86_CLMUL_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_X86_CLMUL_CHOCOBO1_HASH == 1)
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_CLMUL_CHOCOBO1_HASH
+#else
+#define TARGET_CLMUL_CHOCOBO1_HASH __attribute__((target("pclmul,sse2")))
+#endif
+#include <immintrin.h>
+#endif
+
+// with the prebuilt library, kernels are defined there only
+#ifndef INLINE_KERNEL_CHOCOBO1_HASH
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+#define INLINE_KERNEL_CHOCOBO1_HASH
+#else
+#define INLINE_KERNEL_CHOCOBO1_HASH inline
+#endif
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices = 8>();  // parameters as in the "Catalogue of parametrised CRC algorithms"
+
+	// CRC_8_SMBUS();  CRC_8_MAXIM_DOW();  CRC_8_AUTOSAR();  CRC_8_BLUETOOTH();
+	// CRC_16_ARC();  CRC_16_KERMIT();  CRC_16_IBM_3740();  CRC_16_XMODEM();  CRC_16_IBM_SDLC();  CRC_16_MODBUS();  CRC_16_USB();
+	// CRC_24_OPENPGP();
+	// CRC_32_ISO_HDLC();  CRC_32_ISCSI();  CRC_32_BZIP2();  CRC_32_MPEG_2();  CRC_32_CKSUM();
+	// CRC_64_ECMA_182();  CRC_64_XZ();  CRC_64_GO_ISO();  CRC_64_NVME();
+
+	// CRC_64_XZ::combine(crcA, crcB, lengthB);  // merge CRCs of adjacent segments, e.g. computed in parallel
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+#ifndef CONSTEXPR_CPP17_CHOCOBO1_HASH
+#if __cplusplus >= 201703L
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH constexpr
+#else
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH
+#endif
+#endif
+
+#ifndef CHOCOBO1_HASH_ROR_IMPL
+#define CHOCOBO1_HASH_ROR_IMPL
+	template <typename R, typename T>
+	constexpr R ror(const T x, const unsigned int s)
+	{
+		static_assert(std::is_unsigned<R>::value, "");
+		static_assert(std::is_unsigned<T>::value, "");
+		return static_cast<R>(x >> s);
+	}
+#endif
+
+
+namespace CRC_NS
+{
+	// smallest unsigned type holding `Width` bits, at least a byte so the tables can be indexed by byte
+	template <int Width>
+	using RegisterType = typename std::conditional<(Width <= 8), uint8_t,
+		typename std::conditional<(Width <= 16), uint16_t,
+		typename std::conditional<(Width <= 32), uint32_t, uint64_t>::type>::type>::type;
+
+	template <typename T>
+	constexpr T reflect(T value, const int width)
+	{
+		T ret = 0;
+		for (int i = 0; i < width; ++i)
+		{
+			ret = static_cast<T>((ret << 1) | (value & 1));
+			value = static_cast<T>(value >> 1);
+		}
+		return ret;
+	}
+
+	template <typename T, int Slices>
+	struct LookupTable
+	{
+		T data[Slices][256];
+	};
+
+	template <int Width, uint64_t Poly, bool Reflected, int Slices>
+	constexpr LookupTable<RegisterType<Width>, Slices> generateTable()
+	{
+		// reflected: register is right aligned & shifted towards LSB
+		// otherwise: register is left aligned (`Width` may be shorter than `T`) & shifted towards MSB
+		// `data[s][i]`: register after feeding byte `i` followed by `s` zero bytes into a zero register
+		using T = RegisterType<Width>;
+		constexpr int BITS = (sizeof(T) * 8);
+
+		LookupTable<T, Slices> table {};
+		if (Reflected)
+		{
+			const T poly = reflect(static_cast<T>(Poly), Width);
+			for (int i = 0; i < 256; ++i)
+			{
+				T crc = static_cast<T>(i);
+				for (int j = 0; j < 8; ++j)
+					crc = static_cast<T>((crc >> 1) ^ ((crc & 1) ? poly : 0));
+				table.data[0][i] = crc;
+			}
+			for (int s = 1; s < Slices; ++s)
+			{
+				for (int i = 0; i < 256; ++i)
+				{
+					const T prev = table.data[s - 1][i];
+					table.data[s][i] = static_cast<T>(ror<T>(prev, 8) ^ table.data[0][prev & 0xFF]);
+				}
+			}
+		}
+		else
+		{
+			const T poly = static_cast<T>(static_cast<T>(Poly) << (BITS - Width));
+			const T topBit = static_cast<T>(static_cast<T>(1) << (BITS - 1));
+			for (int i = 0; i < 256; ++i)
+			{
+				T crc = static_cast<T>(static_cast<T>(i) << (BITS - 8));
+				for (int j = 0; j < 8; ++j)
+					crc = static_cast<T>((crc << 1) ^ ((crc & topBit) ? poly : 0));
+				table.data[0][i] = crc;
+			}
+			for (int s = 1; s < Slices; ++s)
+			{
+				for (int i = 0; i < 256; ++i)
+				{
+					const T prev = table.data[s - 1][i];
+					table.data[s][i] = static_cast<T>((prev << 8) ^ table.data[0][ror<uint8_t>(prev, (BITS - 8))]);
+				}
+			}
+		}
+		return table;
+	}
+
+	template <int Width, uint64_t Poly, bool Reflected, int Slices>
+	struct Tables
+	{
+		// tables are generated at compile time & shared by every instance with the same parameters
+		static constexpr LookupTable<RegisterType<Width>, Slices> lut = generateTable<Width, Poly, Reflected, Slices>();
+	};
+
+	template <int Width, uint64_t Poly, bool Reflected, int Slices>
+	constexpr LookupTable<RegisterType<Width>, Slices> Tables<Width, Poly, Reflected, Slices>::lut;
+
+
+	template <int Width, uint64_t Poly>
+	constexpr uint64_t polyMulMod(const uint64_t a, const uint64_t b)
+	{
+		// `a * b mod P` over GF(2), polynomials of degree < `Width` with bit `i` being the coefficient of x^i
+		const uint64_t topBit = static_cast<uint64_t>(1) << (Width - 1);
+		const uint64_t mask = ~static_cast<uint64_t>(0) >> (64 - Width);
+
+		uint64_t ret = 0;
+		for (int i = (Width - 1); i >= 0; --i)
+		{
+			ret = ((ret & topBit) ? ((ret << 1) ^ Poly) : (ret << 1)) & mask;
+			if ((b >> i) & 1)
+				ret ^= a;
+		}
+		return ret;
+	}
+
+	template <int Width, uint64_t Poly>
+	constexpr uint64_t polyPowMod(uint64_t n)
+	{
+		// `x^n mod P`, by squaring
+		uint64_t ret = 1;
+		uint64_t base = 2;  // x
+		for (; n > 0; n >>= 1)
+		{
+			if (n & 1)
+				ret = polyMulMod<Width, Poly>(ret, base);
+			base = polyMulMod<Width, Poly>(base, base);
+		}
+		return ret;
+	}
+
+#if (USE_X86_CLMUL_CHOCOBO1_HASH == 1)
+	template <uint64_t Poly>
+	constexpr uint64_t clmulConstant(const uint64_t exponent)
+	{
+		return reflect(polyPowMod<64, Poly>(exponent), 64);
+	}
+
+	template <uint64_t Poly>
+	struct ClmulConstants
+	{
+		// Multipliers for folding a 128-bit block forward by `D` bits: x^(D + 63) for its high-degree half &
+		// x^(D - 1) for its low-degree half, both mod P & reflected.
+		// The exponents are one short because a reflected carry-less product comes out multiplied by x.
+		static constexpr uint64_t fold128[2] = {clmulConstant<Poly>(128 + 63), clmulConstant<Poly>(128 - 1)};
+		static constexpr uint64_t fold256[2] = {clmulConstant<Poly>(256 + 63), clmulConstant<Poly>(256 - 1)};
+		static constexpr uint64_t fold384[2] = {clmulConstant<Poly>(384 + 63), clmulConstant<Poly>(384 - 1)};
+		static constexpr uint64_t fold512[2] = {clmulConstant<Poly>(512 + 63), clmulConstant<Poly>(512 - 1)};
+	};
+
+	template <uint64_t Poly>
+	constexpr uint64_t ClmulConstants<Poly>::fold128[2];
+	template <uint64_t Poly>
+	constexpr uint64_t ClmulConstants<Poly>::fold256[2];
+	template <uint64_t Poly>
+	constexpr uint64_t ClmulConstants<Poly>::fold384[2];
+	template <uint64_t Poly>
+	constexpr uint64_t ClmulConstants<Poly>::fold512[2];
+
+#if ((USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1) && !defined(BUILD_LIBRARY_CHOCOBO1_HASH))
+	bool hasClmul();
+#else
+	INLINE_KERNEL_CHOCOBO1_HASH bool hasClmul()
+	{
+		static const bool ret = []() -> bool
+		{
+#ifdef _MSC_VER
+			int info[4] = {};
+			__cpuid(info, 1);
+			return ((info[2] & (1 << 1)) != 0);
+#else
+			__builtin_cpu_init();
+			return (__builtin_cpu_supports("pclmul") != 0);
+#endif
+		}();
+		return ret;
+	}
+#endif
+
+	TARGET_CLMUL_CHOCOBO1_HASH
+	inline __m128i clmulFold(const __m128i block, const uint64_t (&k)[2])
+	{
+		const __m128i multiplier = _mm_set_epi64x(static_cast<long long>(k[1]), static_cast<long long>(k[0]));
+		return _mm_xor_si128(_mm_clmulepi64_si128(block, multiplier, 0x00), _mm_clmulepi64_si128(block, multiplier, 0x11));
+	}
+
+	template <uint64_t Poly>
+	TARGET_CLMUL_CHOCOBO1_HASH
+	void clmulReflected64(const uint64_t crc, const uint8_t *&ptr, std::size_t &remaining, uint8_t (&folded)[16])
+	{
+		// Folds `remaining` (at least 64) bytes into a single 128-bit block that leaves the same
+		// remainder, 4 independent lanes in the main loop to hide the multiplier latency.
+		// `ptr` & `remaining` are advanced past the consumed input, under 16 bytes are left for the tables.
+		// Computing the CRC of `folded` with a zero register gives the register for the consumed input.
+		using Constants = ClmulConstants<Poly>;
+
+		const auto load = [](const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); };
+
+		__m128i x0 = _mm_xor_si128(load(ptr), _mm_cvtsi64_si128(static_cast<long long>(crc)));
+		__m128i x1 = load(ptr + 16);
+		__m128i x2 = load(ptr + 32);
+		__m128i x3 = load(ptr + 48);
+		ptr += 64;
+		remaining -= 64;
+
+		for (; remaining >= 64; remaining -= 64, ptr += 64)
+		{
+			x0 = _mm_xor_si128(clmulFold(x0, Constants::fold512), load(ptr));
+			x1 = _mm_xor_si128(clmulFold(x1, Constants::fold512), load(ptr + 16));
+			x2 = _mm_xor_si128(clmulFold(x2, Constants::fold512), load(ptr + 32));
+			x3 = _mm_xor_si128(clmulFold(x3, Constants::fold512), load(ptr + 48));
+		}
+
+		__m128i x = _mm_xor_si128(
+			_mm_xor_si128(clmulFold(x0, Constants::fold384), clmulFold(x1, Constants::fold256)),
+			_mm_xor_si128(clmulFold(x2, Constants::fold128), x3));
+
+		for (; remaining >= 16; remaining -= 16, ptr += 16)
+			x = _mm_xor_si128(clmulFold(x, Constants::fold128), load(ptr));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(folded), x);
+	}
+#endif
+
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices = 8>
+	class Crc : private Tables<Width, Poly, RefIn, Slices>
+	{
+		// "Slicing-by-N" from: http://create.stephan-brumme.com/crc32/
+		// parameters: https://reveng.sourceforge.io/crc-catalogue/all.htm
+
+		public:
+			using Byte = uint8_t;
+			using ValueType = RegisterType<Width>;
+			using ResultArrayType = std::array<Byte, ((Width + 7) / 8)>;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+
+			constexpr Crc();
+
+			constexpr void reset();
+			constexpr Crc& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toString()`, `toValue()`, `toVector()` are available
+
+			std::string toString() const;
+			std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP17_CHOCOBO1_HASH ResultArrayType toArray() const;
+			constexpr ValueType toValue() const;
+			template <typename T>
+			CONSTEXPR_CPP17_CHOCOBO1_HASH operator T() const noexcept;
+
+			constexpr Crc& addData(Span<const Byte> inData);
+			constexpr Crc& addData(const void *ptr, std::size_t length);
+			template <std::size_t N>
+			constexpr Crc& addData(const Byte (&array)[N]);
+			template <typename T, std::size_t N>
+			Crc& addData(const T (&array)[N]);
+			template <typename T>
+			Crc& addData(Span<T> inSpan);
+
+			// value of the concatenation, from the finalized values of both parts & the length of the second part
+			static constexpr ValueType combine(ValueType crcA, ValueType crcB, uint64_t lengthB);
+
+			friend constexpr bool operator==(const Crc &left, const Crc &right)
+			{
+				return (left.m_crc == right.m_crc);
+			}
+			friend constexpr bool operator!=(const Crc &left, const Crc &right)
+			{
+				return !(left == right);
+			}
+
+		private:
+			using Tables<Width, Poly, RefIn, Slices>::lut;
+
+			constexpr void addDataImpl(Span<const Byte> data);
+			constexpr void addDataTables(const Byte *ptr, std::size_t remaining);
+			void addDataClmul(const Byte *&ptr, std::size_t &remaining, std::true_type);
+			void addDataClmul(const Byte *&ptr, std::size_t &remaining, std::false_type);
+			template <int I>
+			static constexpr Byte registerByte(uint64_t reg);
+			template <std::size_t... I>
+			static constexpr ValueType sliceBlock(const Byte *ptr, uint64_t reg, std::index_sequence<I...>);
+
+			static constexpr int BITS = (sizeof(ValueType) * 8);
+			static constexpr int REGISTER_BYTES = sizeof(ValueType);
+			static constexpr ValueType MASK = static_cast<ValueType>(~static_cast<uint64_t>(0) >> (64 - Width));
+
+			ValueType m_crc = 0;  // the register before `finalize()`, the result after
+	};
+
+
+	//
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::Crc()
+	{
+		static_assert(((Width >= 8) && (Width <= 64)), "Template parameter value invalid: Width");
+		static_assert(((Slices >= 1) && (Slices <= 16)), "Template parameter value invalid: Slices");
+		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(Crc) < (sizeof(m_crc) + alignof(Crc))), "Constant tables should not be stored in each instance");
+
+		reset();
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr void Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::reset()
+	{
+		const ValueType init = static_cast<ValueType>(Init & MASK);
+		m_crc = RefIn
+			? reflect(init, Width)
+			: static_cast<ValueType>(init << (BITS - Width));
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>& Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::finalize()
+	{
+		ValueType value = RefIn ? m_crc : static_cast<ValueType>(m_crc >> (BITS - Width));
+		if (RefIn != RefOut)
+			value = reflect(value, Width);
+		m_crc = static_cast<ValueType>((value ^ XorOut) & MASK);
+		return (*this);
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	std::string Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::toString() const
+	{
+		const auto digest = toArray();
+		std::string ret;
+		ret.resize(2 * digest.size());
+
+		auto *retPtr = &ret.front();
+		for (const auto c : digest)
+		{
+			const Byte upper = ror<Byte>(c, 4);
+			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
+
+			const Byte lower = c & 0xf;
+			*(retPtr++) = static_cast<char>((lower < 10) ? (lower + '0') : (lower - 10 + 'a'));
+		}
+
+		return ret;
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	std::vector<typename Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::Byte> Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::toVector() const
+	{
+		const auto digest = toArray();
+		return {digest.begin(), digest.end()};
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH typename Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::ResultArrayType Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::toArray() const
+	{
+		// big endian, same as `CRC_32`
+		const int dataSize = static_cast<int>(std::tuple_size<ResultArrayType>::value);
+
+		ResultArrayType ret {};
+		auto *retPtr = ret.data();
+		for (int j = (dataSize - 1); j >= 0; --j)
+			*(retPtr++) = ror<Byte>(m_crc, static_cast<unsigned int>(j * 8));
+
+		return ret;
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr typename Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::ValueType Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::toValue() const
+	{
+		return m_crc;
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	template <typename T>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::operator T() const noexcept
+	{
+		static_assert(std::is_unsigned<T>::value, "");
+
+		const auto digest = toArray();
+		T ret = 0;
+		for (int i = 0, iMax = static_cast<int>(std::min(sizeof(T), digest.size())); i < iMax; ++i)
+		{
+			ret <<= 8;
+			ret |= digest[i];
+		}
+		return ret;
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>& Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addData(const Span<const Byte> inData)
+	{
+		addDataImpl(inData);
+		return (*this);
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>& Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addData(const void *ptr, const std::size_t length)
+	{
+		// Span::size_type = std::size_t
+		return addData({static_cast<const Byte*>(ptr), length});
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	template <std::size_t N>
+	constexpr Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>& Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addData(const Byte (&array)[N])
+	{
+		return addData({array, N});
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	template <typename T, std::size_t N>
+	Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>& Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addData(const T (&array)[N])
+	{
+		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	template <typename T>
+	Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>& Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addData(const Span<T> inSpan)
+	{
+		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	template <int I>
+	constexpr typename Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::Byte Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::registerByte(const uint64_t reg)
+	{
+		// the byte of the register that lines up with byte `I` of the input
+		if (I >= REGISTER_BYTES)
+			return 0;
+		return RefIn
+			? ror<Byte>(reg, static_cast<unsigned int>(8 * I))
+			: ror<Byte>(reg, static_cast<unsigned int>(BITS - 8 - (8 * I)));
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	template <std::size_t... I>
+	constexpr typename Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::ValueType Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::sliceBlock(const Byte *ptr, const uint64_t reg, std::index_sequence<I...>)
+	{
+		// expanded at compile time, compilers don't reliably unroll a loop this long
+		ValueType ret = 0;
+		const int expand[] = {((ret ^= lut.data[Slices - 1 - static_cast<int>(I)][ptr[I] ^ registerByte<static_cast<int>(I)>(reg)]), 0)...};
+		static_cast<void>(expand);
+		return ret;
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr void Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addDataImpl(const Span<const Byte> data)
+	{
+		const Byte *ptr = data.data();
+		std::size_t remaining = static_cast<std::size_t>(data.size());
+
+#if (USE_X86_CLMUL_CHOCOBO1_HASH == 1)
+		if (!__builtin_is_constant_evaluated() && (remaining >= 128))
+			addDataClmul(ptr, remaining, std::integral_constant<bool, ((Width == 64) && RefIn)>());
+#endif
+
+		addDataTables(ptr, remaining);
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr void Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addDataTables(const Byte *ptr, std::size_t remaining)
+	{
+		// `Slices` bytes at a time, the register overlaps the first `REGISTER_BYTES` of them
+		for (; remaining >= Slices; remaining -= Slices, ptr += Slices)
+		{
+			const uint64_t wide = m_crc;  // shifting by `BITS` is fine on a wider type
+
+			ValueType crc = sliceBlock(ptr, wide, std::make_index_sequence<Slices>());
+			if (Slices < REGISTER_BYTES)
+				crc ^= RefIn ? ror<ValueType>(wide, (8 * Slices)) : static_cast<ValueType>(wide << (8 * Slices));
+			m_crc = crc;
+		}
+
+		// remaining bytes use "standard algorithm"
+		for (; remaining > 0; --remaining, ++ptr)
+		{
+			const uint64_t wide = m_crc;
+			if (RefIn)
+				m_crc = static_cast<ValueType>(ror<ValueType>(wide, 8) ^ lut.data[0][ror<Byte>(wide, 0) ^ *ptr]);
+			else
+				m_crc = static_cast<ValueType>(static_cast<ValueType>(wide << 8) ^ lut.data[0][ror<Byte>(wide, (BITS - 8)) ^ *ptr]);
+		}
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	void Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addDataClmul(const Byte *&ptr, std::size_t &remaining, std::true_type)
+	{
+#if (USE_X86_CLMUL_CHOCOBO1_HASH == 1)
+		if (!hasClmul())
+			return;
+
+		Byte folded[16] = {};
+		clmulReflected64<Poly>(m_crc, ptr, remaining, folded);
+		m_crc = 0;
+		addDataTables(folded, sizeof(folded));
+#else
+		static_cast<void>(ptr);
+		static_cast<void>(remaining);
+#endif
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	void Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::addDataClmul(const Byte *&, std::size_t &, std::false_type)
+	{
+		// only reflected 64-bit CRCs have a folding kernel, the rest stay on the tables
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	constexpr typename Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::ValueType Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>::combine(const ValueType crcA, const ValueType crcB, const uint64_t lengthB)
+	{
+		// crc(A || B) = crc(B) ^ ((crc(A) ^ XorOut ^ Init) * x^(8 * lengthB) mod P), in O(log(lengthB))
+		// the values are in `RefOut` bit order, so the product is taken on reflected operands
+		const uint64_t init = RefOut ? reflect<uint64_t>((Init & MASK), Width) : (Init & MASK);
+		uint64_t value = (crcA ^ XorOut ^ init) & MASK;
+		if (RefOut)
+			value = reflect(value, Width);
+
+		const uint64_t shift = polyPowMod<Width, Poly>(8 * lengthB);
+		uint64_t shifted = polyMulMod<Width, Poly>(value, shift);
+		if (RefOut)
+			shifted = reflect(shifted, Width);
+		return static_cast<ValueType>((shifted ^ crcB) & MASK);
+	}
+}
+}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices = 8>
+	using Crc = Hash::CRC_NS::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>;
+
+	using CRC_8_SMBUS = Crc<8, 0x07, 0x00, false, false, 0x00>;
+	using CRC_8_MAXIM_DOW = Crc<8, 0x31, 0x00, true, true, 0x00>;  // aka Dallas 1-Wire
+	using CRC_8_AUTOSAR = Crc<8, 0x2F, 0xFF, false, false, 0xFF>;
+	using CRC_8_BLUETOOTH = Crc<8, 0xA7, 0x00, true, true, 0x00>;
+
+	using CRC_16_ARC = Crc<16, 0x8005, 0x0000, true, true, 0x0000>;
+	using CRC_16_KERMIT = Crc<16, 0x1021, 0x0000, true, true, 0x0000>;  // aka CRC-16/CCITT
+	using CRC_16_IBM_3740 = Crc<16, 0x1021, 0xFFFF, false, false, 0x0000>;  // aka CRC-16/CCITT-FALSE
+	using CRC_16_XMODEM = Crc<16, 0x1021, 0x0000, false, false, 0x0000>;
+	using CRC_16_IBM_SDLC = Crc<16, 0x1021, 0xFFFF, true, true, 0xFFFF>;  // aka CRC-16/X-25, HDLC framing
+	using CRC_16_MODBUS = Crc<16, 0x8005, 0xFFFF, true, true, 0x0000>;
+	using CRC_16_USB = Crc<16, 0x8005, 0xFFFF, true, true, 0xFFFF>;
+
+	using CRC_24_OPENPGP = Crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>;
+
+	using CRC_32_ISO_HDLC = Crc<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 16>;  // same as `CRC_32`
+	using CRC_32_ISCSI = Crc<32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 16>;  // aka CRC-32C (Castagnoli)
+	using CRC_32_BZIP2 = Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, 16>;
+	using CRC_32_MPEG_2 = Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000, 16>;
+	using CRC_32_CKSUM = Crc<32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF, 16>;  // POSIX `cksum`, without the length suffix
+
+	using CRC_64_ECMA_182 = Crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000, 16>;
+	using CRC_64_XZ = Crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+	using CRC_64_GO_ISO = Crc<64, 0x000000000000001B, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+	using CRC_64_NVME = Crc<64, 0xAD93D23594C93659, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::CRC_NS::Crc<8, 0x07, 0x00, false, false, 0x00>;
+	extern template class Hash::CRC_NS::Crc<8, 0x31, 0x00, true, true, 0x00>;
+	extern template class Hash::CRC_NS::Crc<8, 0x2F, 0xFF, false, false, 0xFF>;
+	extern template class Hash::CRC_NS::Crc<8, 0xA7, 0x00, true, true, 0x00>;
+	extern template class Hash::CRC_NS::Crc<16, 0x8005, 0x0000, true, true, 0x0000>;
+	extern template class Hash::CRC_NS::Crc<16, 0x1021, 0x0000, true, true, 0x0000>;
+	extern template class Hash::CRC_NS::Crc<16, 0x1021, 0xFFFF, false, false, 0x0000>;
+	extern template class Hash::CRC_NS::Crc<16, 0x1021, 0x0000, false, false, 0x0000>;
+	extern template class Hash::CRC_NS::Crc<16, 0x1021, 0xFFFF, true, true, 0xFFFF>;
+	extern template class Hash::CRC_NS::Crc<16, 0x8005, 0xFFFF, true, true, 0x0000>;
+	extern template class Hash::CRC_NS::Crc<16, 0x8005, 0xFFFF, true, true, 0xFFFF>;
+	extern template class Hash::CRC_NS::Crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>;
+	extern template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 16>;
+	extern template class Hash::CRC_NS::Crc<32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 16>;
+	extern template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, 16>;
+	extern template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000, 16>;
+	extern template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF, 16>;
+	extern template class Hash::CRC_NS::Crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000, 16>;
+	extern template class Hash::CRC_NS::Crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+	extern template class Hash::CRC_NS::Crc<64, 0x000000000000001B, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+	extern template class Hash::CRC_NS::Crc<64, 0xAD93D23594C93659, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+#if (USE_X86_CLMUL_CHOCOBO1_HASH == 1)
+	extern template void Hash::CRC_NS::clmulReflected64<0x42F0E1EBA9EA3693>(uint64_t, const uint8_t *&, std::size_t &, uint8_t (&)[16]);
+	extern template void Hash::CRC_NS::clmulReflected64<0x000000000000001B>(uint64_t, const uint8_t *&, std::size_t &, uint8_t (&)[16]);
+	extern template void Hash::CRC_NS::clmulReflected64<0xAD93D23594C93659>(uint64_t, const uint8_t *&, std::size_t &, uint8_t (&)[16]);
+#endif
+#endif
+}
+
+namespace std
+{
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut, int Slices>
+	struct hash<Chocobo1::Hash::CRC_NS::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices>>
+	{
+		CONSTEXPR_CPP17_CHOCOBO1_HASH size_t operator()(const Chocobo1::Hash::CRC_NS::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, Slices> &hash) const noexcept
+		{
+			return hash;
+		}
+	};
+}
+
+#endif  // CHOCOBO1_CRC_H
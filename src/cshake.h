@@ -15,9 +15,7 @@
 #include "sha3.h"
 
 #include <climits>
-#include <cmath>
 #include <cstdint>
-#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,6 +37,11 @@
 #include "gsl/span"
 #endif
 
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
 
 namespace Chocobo1
 {
@@ -84,18 +87,14 @@ namespace CShake_NS
 #endif
 
 
-			explicit constexpr CShake(int digestLength, const std::string &name = {}, const std::string &customize = {});
-			constexpr CShake(const CShake &other);
-			constexpr CShake(CShake &&other) noexcept;
-			constexpr CShake& operator=(const CShake &other);
-			constexpr CShake& operator=(CShake &&other) noexcept;
-			~CShake() = default;
+			explicit CONSTEXPR_CPP20_CHOCOBO1_HASH CShake(int digestLength, const std::string &name = {}, const std::string &customize = {});
 
 			constexpr void reset();
-			constexpr CShake& finalize();  // after this, only `operator T()`, `reset()`, `toString()`, `toVector()` are available
+			constexpr CShake& finalize();  // after this, only `operator T()`, `reset()`, `toSpan()`, `toString()`, `toVector()` are available
 
 			std::string toString() const;
-			std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP20_CHOCOBO1_HASH std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP17_CHOCOBO1_HASH void toSpan(Span<Byte> output) const;  // writes the first `output.size()` bytes of output
 			template <typename T>
 			operator T() const noexcept;
 
@@ -112,7 +111,7 @@ namespace CShake_NS
 			{
 				if (left.m_customized != right.m_customized)
 					return false;
-				return left.m_customized ? (*(left.m_keccak) == *(right.m_keccak)) : (*(left.m_shake) == *(right.m_shake));
+				return left.m_customized ? (left.m_state.keccak == right.m_state.keccak) : (left.m_state.shake == right.m_state.shake);
 			}
 			friend constexpr bool operator!=(const CShake &left, const CShake &right)
 			{
@@ -122,48 +121,61 @@ namespace CShake_NS
 		private:
 			constexpr void addDataImpl(Span<const Byte> data);
 
-			bool m_customized = false;
+			// only one of them is alive, both are trivially copyable so the union can be copied as is
+			union State
+			{
+				explicit constexpr State(const S &s) : shake(s) {}
+				explicit constexpr State(const K &k) : keccak(k) {}
+
+				S shake;
+				K keccak;
+			};
 
-			std::unique_ptr<S> m_shake;
-			std::unique_ptr<K> m_keccak;
+			State m_state;
+			bool m_customized = false;
 	};
 
 
 	// helpers
-	const auto leftEncode = [](const uint64_t value) -> Buffer<uint8_t, sizeof(value)>
+	inline CONSTEXPR_CPP17_CHOCOBO1_HASH Buffer<uint8_t, (sizeof(uint64_t) + 1)> leftEncode(const uint64_t value)
 	{
-		const uint8_t n = (value == 0) ? 1 : static_cast<uint8_t>(std::lround((std::log2(value) / 8) + 0.5));
+		// number of bytes needed to represent `value`, at least 1
+		uint8_t n = 1;
+		while ((n < sizeof(value)) && ((value >> (8 * n)) != 0))
+			++n;
 
-		Buffer<uint8_t, sizeof(value)> ret = {n};
+		Buffer<uint8_t, (sizeof(value) + 1)> ret;
+		ret.fill(n);
 		for (int i = (n - 1); i >= 0; --i)
-			ret.fill(ror<uint8_t>(value, (8 * i)));
+			ret.fill(ror<uint8_t>(value, static_cast<unsigned int>(8 * i)));
 
 		return ret;
-	};
+	}
 
 
 	//
 	template <typename S, typename K, int P>
-	constexpr CShake<S, K, P>::CShake(const int digestLength, const std::string &name, const std::string &customize)
-		: m_customized(!(name.empty() && customize.empty()))
+	CONSTEXPR_CPP20_CHOCOBO1_HASH CShake<S, K, P>::CShake(const int digestLength, const std::string &name, const std::string &customize)
+		: m_state((name.empty() && customize.empty()) ? State(S(digestLength)) : State(K(digestLength)))
+		, m_customized(!(name.empty() && customize.empty()))
 	{
 		static_assert((P >= 0), "Template parameter value invalid: P");
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((std::is_trivially_copyable<S>::value && std::is_trivially_copyable<K>::value), "");
 
 		if (!m_customized)
-		{
-			m_shake = std::make_unique<S>(digestLength);
 			return;
-		}
-
-		m_keccak = std::make_unique<K>(digestLength);
 
 		const auto processString = [this](const std::string &str, size_t &length) -> void
 		{
 			const auto encodedStr = leftEncode(str.size() * 8);
 			addData({encodedStr.data(), encodedStr.size()});
 			length += encodedStr.size();
-			addData(str.data(), str.size());
+			for (const char c : str)  // byte by byte, `reinterpret_cast` isn't allowed in constant expressions
+			{
+				const Byte b[] = {static_cast<Byte>(c)};
+				addData(b);
+			}
 			length += str.size();
 		};
 		const auto bytepadCount = [](const size_t length, const size_t target) -> size_t
@@ -186,88 +198,49 @@ namespace CShake_NS
 	}
 
 	template <typename S, typename K, int P>
-	constexpr CShake<S, K, P>::CShake(const CShake<S, K, P> &other)
-		: m_customized(other.m_customized)
-	{
-		if (!m_customized)
-			m_shake = std::make_unique<S>(*other.m_shake);
-		else
-			m_keccak = std::make_unique<K>(*other.m_keccak);
-	}
-
-	template <typename S, typename K, int P>
-	constexpr CShake<S, K, P>::CShake(CShake<S, K, P> &&other) noexcept
+	constexpr void CShake<S, K, P>::reset()
 	{
-		std::swap(m_customized, other.m_customized);
 		if (!m_customized)
-			std::swap(m_shake, other.m_shake);
+			m_state.shake.reset();
 		else
-			std::swap(m_keccak, other.m_keccak);
+			m_state.keccak.reset();
 	}
 
 	template <typename S, typename K, int P>
-	constexpr CShake<S, K, P>& CShake<S, K, P>::operator=(const CShake<S, K, P> &other)
-	{
-		if (this != &other)
-		{
-			m_customized = other.m_customized;
-			if (!m_customized)
-				*m_shake = *other.m_shake;
-			else
-				*m_keccak = *other.m_keccak;
-		}
-		return *this;
-	}
-
-	template <typename S, typename K, int P>
-	constexpr CShake<S, K, P>& CShake<S, K, P>::operator=(CShake<S, K, P> &&other) noexcept
-	{
-		if (this != &other)
-		{
-			std::swap(m_customized, other.m_customized);
-			if (!m_customized)
-				std::swap(m_shake, other.m_shake);
-			else
-				std::swap(m_keccak, other.m_keccak);
-		}
-		return *this;
-	}
-
-	template <typename S, typename K, int P>
-	constexpr void CShake<S, K, P>::reset()
+	constexpr CShake<S, K, P>& CShake<S, K, P>::finalize()
 	{
 		if (!m_customized)
-			m_shake->reset();
+			m_state.shake.finalize();
 		else
-			m_keccak->reset();
+			m_state.keccak.finalize();
+		return (*this);
 	}
 
 	template <typename S, typename K, int P>
-	constexpr CShake<S, K, P>& CShake<S, K, P>::finalize()
+	std::string CShake<S, K, P>::toString() const
 	{
 		if (!m_customized)
-			m_shake->finalize();
+			return m_state.shake.toString();
 		else
-			m_keccak->finalize();
-		return (*this);
+			return m_state.keccak.toString();
 	}
 
 	template <typename S, typename K, int P>
-	std::string CShake<S, K, P>::toString() const
+	CONSTEXPR_CPP20_CHOCOBO1_HASH std::vector<typename CShake<S, K, P>::Byte> CShake<S, K, P>::toVector() const
 	{
 		if (!m_customized)
-			return m_shake->toString();
+			return m_state.shake.toVector();
 		else
-			return m_keccak->toString();
+			return m_state.keccak.toVector();
 	}
 
 	template <typename S, typename K, int P>
-	std::vector<typename CShake<S, K, P>::Byte> CShake<S, K, P>::toVector() const
+	CONSTEXPR_CPP17_CHOCOBO1_HASH void CShake<S, K, P>::toSpan(const Span<Byte> output) const
 	{
 		if (!m_customized)
-			return m_shake->toVector();
+			m_state.shake.toSpan(output);
 		else
-			return m_keccak->toVector();
+			m_state.keccak.toSpan(output);
 	}
 
 	template <typename S, typename K, int P>
@@ -325,9 +298,9 @@ namespace CShake_NS
 	constexpr void CShake<S, K, P>::addDataImpl(const Span<const Byte> data)
 	{
 		if (!m_customized)
-			m_shake->addData(data);
+			m_state.shake.addData(data);
 		else
-			m_keccak->addData(data);
+			m_state.keccak.addData(data);
 	}
 }
 }
@@ -336,7 +309,7 @@ namespace CShake_NS
 	struct CSHAKEAlias : Base
 	{
 		using BaseType = Base;
-		explicit constexpr CSHAKEAlias(const int l, const std::string &n = {}, const std::string &c = {}) : Base(l, n, c) {}
+		explicit CONSTEXPR_CPP20_CHOCOBO1_HASH CSHAKEAlias(const int l, const std::string &n = {}, const std::string &c = {}) : Base(l, n, c) {}
 		CSHAKEAlias(const Base &other) : Base(other) {}
 		CSHAKEAlias(Base &&other) noexcept : Base(std::move(other)) {}
 		CSHAKEAlias& operator=(const Base &other) { if (this != &other) { Base::operator=(other); } return *this; }
@@ -344,6 +317,14 @@ namespace CShake_NS
 	};
 	using CSHAKE_128 = CSHAKEAlias<Hash::CShake_NS::CShake<SHAKE_128, Hash::SHA3_NS::Keccak<(1344 / 8), 0x04>, (1344 / 8)>>;
 	using CSHAKE_256 = CSHAKEAlias<Hash::CShake_NS::CShake<SHAKE_256, Hash::SHA3_NS::Keccak<(1088 / 8), 0x04>, (1088 / 8)>>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::SHA3_NS::Keccak<(1344 / 8), 0x04>;
+	extern template class Hash::SHA3_NS::Keccak<(1088 / 8), 0x04>;
+	extern template class Hash::CShake_NS::CShake<SHAKE_128, Hash::SHA3_NS::Keccak<(1344 / 8), 0x04>, (1344 / 8)>;
+	extern template class Hash::CShake_NS::CShake<SHAKE_256, Hash::SHA3_NS::Keccak<(1088 / 8), 0x04>, (1088 / 8)>;
+#endif
 }
 
 namespace std
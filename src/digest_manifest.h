@@ -0,0 +1,637 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_DIGEST_MANIFEST_H
+#define CHOCOBO1_DIGEST_MANIFEST_H
+
+#include "fnv.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// DigestManifestBuilder("sha2-256", 32).addSumText(text);  .add(path, digest);  .serialize();
+	// DigestManifest::view(mappedFile.data());  // read only, uses the memory in place
+	// manifest.find(path);  manifest.findDigest(digest);  manifest.record(index);
+
+	// A binary replacement for `sha256sum` style text manifests, lookups need no parsing.
+	// Little endian, every section starts on 8 bytes:
+	//   64-byte header: magic, version, digest size, record count, string pool size, index slots, algorithm name
+	//   records: path offset (u64), path length (u32), flags (u32), digest padded to 8 bytes
+	//   string pool: the paths, back to back
+	//   path index & digest index: open addressing tables of `slots` (a power of 2) u64 entries,
+	//     a 32-bit tag of the key hash in the upper half, record number + 1 in the lower half (0 = empty), linear probing
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace DigestManifest_NS
+{
+	using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+	template <typename T, std::size_t Extent = std::dynamic_extent>
+	using Span = std::span<T, Extent>;
+#else
+	template <typename T, std::size_t Extent = gsl::dynamic_extent>
+	using Span = gsl::span<T, Extent>;
+#endif
+
+	static constexpr char MAGIC[9] = "CHODGMAN";
+	static constexpr uint32_t FORMAT_VERSION = 1;
+	static constexpr std::size_t HEADER_SIZE = 64;
+	static constexpr std::size_t MAX_ALGORITHM_LENGTH = 23;  // zero terminated within the header
+	static constexpr std::size_t MAX_DIGEST_SIZE = 1024;
+	static constexpr uint64_t MAX_RECORDS = UINT32_MAX - 1;
+	static constexpr uint32_t FLAG_BINARY = 1;  // `*` before the path in the text form
+
+	template <typename T>
+	void storeLE(Byte *out, const T value)
+	{
+		for (std::size_t i = 0; i < sizeof(T); ++i)
+			out[i] = static_cast<Byte>(static_cast<uint64_t>(value) >> (8 * i));
+	}
+
+	template <typename T>
+	T loadLE(const Byte *in)
+	{
+		uint64_t value = 0;
+		for (std::size_t i = 0; i < sizeof(T); ++i)
+			value |= (static_cast<uint64_t>(in[i]) << (8 * i));
+		return static_cast<T>(value);
+	}
+
+	inline uint64_t align8(const uint64_t size)
+	{
+		return ((size + 7) & ~static_cast<uint64_t>(7));
+	}
+
+	inline uint64_t mix(uint64_t x)
+	{
+		// MurmurHash3 finalizer, the table index comes from the low bits
+		x ^= (x >> 33);
+		x *= 0xff51afd7ed558ccd;
+		x ^= (x >> 33);
+		x *= 0xc4ceb9fe1a85ec53;
+		x ^= (x >> 33);
+		return x;
+	}
+
+	inline uint64_t pathHash(const char *path, const std::size_t length)
+	{
+		return mix(Chocobo1::FNV64_1a().addData(path, length).finalize());
+	}
+
+	inline uint64_t digestHash(const Byte *digest, const std::size_t size)
+	{
+		// digests are uniform already, 8 bytes of them are plenty
+		Byte bytes[8] = {};
+		std::copy(digest, (digest + std::min<std::size_t>(size, 8)), bytes);
+		return mix(loadLE<uint64_t>(bytes) ^ size);
+	}
+
+	inline uint64_t slotCount(const uint64_t records)
+	{
+		// at most half full
+		uint64_t slots = 1;
+		while (slots < (records * 2))
+			slots *= 2;
+		return slots;
+	}
+
+	inline int hexValue(const char c)
+	{
+		if ((c >= '0') && (c <= '9'))
+			return (c - '0');
+		if ((c >= 'a') && (c <= 'f'))
+			return (c - 'a' + 10);
+		if ((c >= 'A') && (c <= 'F'))
+			return (c - 'A' + 10);
+		return -1;
+	}
+
+	struct Layout
+	{
+		explicit Layout(const std::size_t digestSize, const uint64_t records, const uint64_t poolSize)
+			: recordSize(16 + align8(digestSize))
+			, slots(slotCount(records))
+			, recordsOffset(HEADER_SIZE)
+			, poolOffset(recordsOffset + (records * recordSize))
+			, pathIndexOffset(align8(poolOffset + poolSize))
+			, digestIndexOffset(pathIndexOffset + (slots * 8))
+			, totalSize(digestIndexOffset + (slots * 8))
+		{
+		}
+
+		uint64_t recordSize;
+		uint64_t slots;
+		uint64_t recordsOffset;
+		uint64_t poolOffset;
+		uint64_t pathIndexOffset;
+		uint64_t digestIndexOffset;
+		uint64_t totalSize;
+	};
+
+
+	template <typename T = void>
+	struct Constants
+	{
+		static constexpr std::size_t NOT_FOUND = std::numeric_limits<std::size_t>::max();
+	};
+
+	template <typename T>
+	constexpr std::size_t Constants<T>::NOT_FOUND;
+
+
+	class DigestManifestBuilder
+	{
+		// Collects records in memory, `serialize()` lays out the file & builds both indexes.
+		// Repeated paths are kept, lookups return the first one.
+
+		public:
+			using Byte = DigestManifest_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			// `algorithm` is recorded for the reader, e.g. the `AnyHasher` name
+			explicit DigestManifestBuilder(const std::string &algorithm = "sha2-256", std::size_t digestSize = 32);
+
+			bool isValid() const;  // algorithm name up to 23 characters, digest size 1 to 1024 bytes
+
+			bool add(const std::string &path, Span<const Byte> digest, bool binary = false);  // `false` for a wrong digest size
+			std::size_t addSumText(Span<const char> text);  // `sha256sum` output format, returns the number of malformed lines
+
+			std::size_t size() const;
+			std::vector<Byte> serialize() const;  // empty when invalid
+
+		private:
+			struct Entry
+			{
+				uint64_t pathOffset;
+				uint32_t pathLength;
+				uint32_t flags;
+			};
+
+			std::string m_algorithm;
+			std::size_t m_digestSize = 0;
+			std::vector<Entry> m_entries;
+			std::vector<Byte> m_digests;
+			std::string m_pool;
+			bool m_valid = false;
+	};
+
+	class DigestManifest : public Constants<>
+	{
+		// A read only view of `DigestManifestBuilder::serialize()` output, e.g. a mapped file.
+		// Only the header is checked up front, records are bounds checked as they are accessed.
+
+		public:
+			using Byte = DigestManifest_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			struct Record
+			{
+				Span<const Byte> digest;
+				const char *path = nullptr;  // not zero terminated
+				std::size_t pathLength = 0;
+				bool binary = false;
+
+				std::string pathString() const;
+			};
+
+			// `NOT_FOUND` from lookups
+
+			DigestManifest() = default;
+			static DigestManifest view(Span<const Byte> data);  // `data` must outlive the manifest
+
+			bool isValid() const;  // `false` for bad data
+
+			std::size_t size() const;
+			std::size_t digestSize() const;
+			std::string algorithm() const;
+
+			Record record(std::size_t index) const;  // a record with empty digest for bad indexes or data
+			std::size_t find(const char *path, std::size_t length) const;  // `NOT_FOUND` if absent
+			std::size_t find(const std::string &path) const;
+			std::size_t findDigest(Span<const Byte> digest) const;  // the first record with this digest
+			std::vector<std::size_t> findAllDigest(Span<const Byte> digest) const;  // in insertion order
+
+			std::string toSumText() const;  // `sha256sum` output format
+
+		private:
+			template <typename Visit>
+			void probe(uint64_t indexOffset, uint64_t hash, const Visit &visit) const;
+			bool digestEquals(std::size_t index, Span<const Byte> digest) const;
+
+			Span<const Byte> m_data;
+			std::size_t m_digestSize = 0;
+			uint64_t m_records = 0;
+			uint64_t m_poolSize = 0;
+			uint64_t m_recordSize = 0;
+			uint64_t m_slots = 0;
+			uint64_t m_poolOffset = 0;
+			uint64_t m_pathIndexOffset = 0;
+			uint64_t m_digestIndexOffset = 0;
+			bool m_valid = false;
+	};
+
+
+	//
+	inline DigestManifestBuilder::DigestManifestBuilder(const std::string &algorithm, const std::size_t digestSize)
+		: m_algorithm(algorithm)
+		, m_digestSize(digestSize)
+		, m_valid((algorithm.size() <= MAX_ALGORITHM_LENGTH) && (algorithm.find('\0') == std::string::npos)
+			&& (digestSize >= 1) && (digestSize <= MAX_DIGEST_SIZE))
+	{
+	}
+
+	inline bool DigestManifestBuilder::isValid() const
+	{
+		return m_valid;
+	}
+
+	inline bool DigestManifestBuilder::add(const std::string &path, const Span<const Byte> digest, const bool binary)
+	{
+		if (!m_valid || (digest.size() != m_digestSize) || (m_entries.size() >= MAX_RECORDS) || (path.size() > UINT32_MAX))
+			return false;
+
+		m_entries.push_back({m_pool.size(), static_cast<uint32_t>(path.size()), (binary ? FLAG_BINARY : 0)});
+		m_pool += path;
+		m_digests.insert(m_digests.end(), digest.begin(), digest.end());
+		return true;
+	}
+
+	inline std::size_t DigestManifestBuilder::addSumText(const Span<const char> text)
+	{
+		// "<hex digest> <space or *><path>" per line, a leading backslash means `\\`, `\n` & `\r` in the path are escaped
+		std::size_t malformed = 0;
+		std::vector<Byte> digest(m_digestSize);
+		std::string path;
+
+		const char *pos = text.data();
+		const char *end = text.data() + text.size();
+		while (pos < end)
+		{
+			const char *lineEnd = std::find(pos, end, '\n');
+			const char *p = pos;
+			pos = (lineEnd < end) ? (lineEnd + 1) : end;
+			if (p == lineEnd)
+				continue;
+
+			const bool escaped = (*p == '\\');
+			if (escaped)
+				++p;
+
+			bool ok = (static_cast<std::size_t>(lineEnd - p) > ((m_digestSize * 2) + 1));
+			for (std::size_t i = 0; ok && (i < m_digestSize); ++i)
+			{
+				const int hi = hexValue(p[i * 2]);
+				const int lo = hexValue(p[(i * 2) + 1]);
+				ok = ((hi >= 0) && (lo >= 0));
+				digest[i] = static_cast<Byte>((hi << 4) | lo);
+			}
+			p += (m_digestSize * 2);
+			ok = ok && (p[0] == ' ') && ((p[1] == ' ') || (p[1] == '*'));
+			if (!ok)
+			{
+				++malformed;
+				continue;
+			}
+			const bool binary = (p[1] == '*');
+			p += 2;
+
+			path.assign(p, lineEnd);
+			if (escaped)
+			{
+				std::string unescaped;
+				for (std::size_t i = 0; i < path.size(); ++i)
+				{
+					if ((path[i] == '\\') && ((i + 1) < path.size()))
+					{
+						++i;
+						unescaped += (path[i] == 'n') ? '\n' : ((path[i] == 'r') ? '\r' : path[i]);
+					}
+					else
+					{
+						unescaped += path[i];
+					}
+				}
+				path = unescaped;
+			}
+
+			if (!add(path, digest, binary))
+				++malformed;
+		}
+		return malformed;
+	}
+
+	inline std::size_t DigestManifestBuilder::size() const
+	{
+		return m_entries.size();
+	}
+
+	inline std::vector<DigestManifestBuilder::Byte> DigestManifestBuilder::serialize() const
+	{
+		if (!m_valid)
+			return {};
+
+		const Layout layout {m_digestSize, m_entries.size(), m_pool.size()};
+		std::vector<Byte> out(static_cast<std::size_t>(layout.totalSize), 0);
+
+		std::copy(MAGIC, (MAGIC + 8), out.data());
+		storeLE<uint32_t>(&out[8], FORMAT_VERSION);
+		storeLE<uint32_t>(&out[12], static_cast<uint32_t>(m_digestSize));
+		storeLE<uint64_t>(&out[16], m_entries.size());
+		storeLE<uint64_t>(&out[24], m_pool.size());
+		storeLE<uint64_t>(&out[32], layout.slots);
+		std::copy(m_algorithm.begin(), m_algorithm.end(), &out[40]);
+
+		const uint64_t mask = layout.slots - 1;
+		const auto insert = [&out, mask](const uint64_t indexOffset, const uint64_t hash, const std::size_t index) -> void
+		{
+			for (uint64_t slot = hash & mask; ; slot = ((slot + 1) & mask))
+			{
+				Byte *entry = &out[static_cast<std::size_t>(indexOffset + (slot * 8))];
+				if (loadLE<uint64_t>(entry) == 0)
+				{
+					storeLE<uint64_t>(entry, ((hash & 0xFFFFFFFF00000000) | (index + 1)));
+					return;
+				}
+			}
+		};
+
+		for (std::size_t i = 0; i < m_entries.size(); ++i)
+		{
+			const Entry &entry = m_entries[i];
+			const Byte *digest = &m_digests[i * m_digestSize];
+
+			Byte *record = &out[static_cast<std::size_t>(layout.recordsOffset + (i * layout.recordSize))];
+			storeLE<uint64_t>(record, entry.pathOffset);
+			storeLE<uint32_t>((record + 8), entry.pathLength);
+			storeLE<uint32_t>((record + 12), entry.flags);
+			std::copy(digest, (digest + m_digestSize), (record + 16));
+
+			insert(layout.pathIndexOffset, pathHash((m_pool.data() + entry.pathOffset), entry.pathLength), i);
+			insert(layout.digestIndexOffset, digestHash(digest, m_digestSize), i);
+		}
+		std::copy(m_pool.begin(), m_pool.end(), &out[static_cast<std::size_t>(layout.poolOffset)]);
+
+		return out;
+	}
+
+	inline std::string DigestManifest::Record::pathString() const
+	{
+		return {path, pathLength};
+	}
+
+	inline DigestManifest DigestManifest::view(const Span<const Byte> data)
+	{
+		DigestManifest ret;
+		if ((data.size() < HEADER_SIZE) || !std::equal(MAGIC, (MAGIC + 8), data.data())
+			|| (loadLE<uint32_t>(&data[8]) != FORMAT_VERSION) || (data[40 + MAX_ALGORITHM_LENGTH] != 0))
+			return ret;
+
+		const uint32_t digestSize = loadLE<uint32_t>(&data[12]);
+		const uint64_t records = loadLE<uint64_t>(&data[16]);
+		const uint64_t poolSize = loadLE<uint64_t>(&data[24]);
+		const uint64_t slots = loadLE<uint64_t>(&data[32]);
+		if ((digestSize < 1) || (digestSize > MAX_DIGEST_SIZE) || (records > MAX_RECORDS)
+			|| (poolSize > static_cast<uint64_t>(data.size())))
+			return ret;
+
+		const Layout layout {digestSize, records, poolSize};
+		if ((slots != layout.slots) || (layout.totalSize != static_cast<uint64_t>(data.size())))
+			return ret;
+
+		ret.m_data = data;
+		ret.m_digestSize = digestSize;
+		ret.m_records = records;
+		ret.m_poolSize = poolSize;
+		ret.m_recordSize = layout.recordSize;
+		ret.m_slots = layout.slots;
+		ret.m_poolOffset = layout.poolOffset;
+		ret.m_pathIndexOffset = layout.pathIndexOffset;
+		ret.m_digestIndexOffset = layout.digestIndexOffset;
+		ret.m_valid = true;
+		return ret;
+	}
+
+	inline bool DigestManifest::isValid() const
+	{
+		return m_valid;
+	}
+
+	inline std::size_t DigestManifest::size() const
+	{
+		return static_cast<std::size_t>(m_records);
+	}
+
+	inline std::size_t DigestManifest::digestSize() const
+	{
+		return m_digestSize;
+	}
+
+	inline std::string DigestManifest::algorithm() const
+	{
+		if (!m_valid)
+			return {};
+		return reinterpret_cast<const char *>(&m_data[40]);
+	}
+
+	inline DigestManifest::Record DigestManifest::record(const std::size_t index) const
+	{
+		if (!m_valid || (index >= m_records))
+			return {};
+
+		const Byte *record = &m_data[static_cast<std::size_t>(HEADER_SIZE + (index * m_recordSize))];
+		const uint64_t pathOffset = loadLE<uint64_t>(record);
+		const uint32_t pathLength = loadLE<uint32_t>(record + 8);
+		if ((pathOffset > m_poolSize) || (pathLength > (m_poolSize - pathOffset)))
+			return {};
+
+		Record ret;
+		ret.digest = {(record + 16), m_digestSize};
+		ret.path = reinterpret_cast<const char *>(&m_data[static_cast<std::size_t>(m_poolOffset + pathOffset)]);
+		ret.pathLength = pathLength;
+		ret.binary = ((loadLE<uint32_t>(record + 12) & FLAG_BINARY) != 0);
+		return ret;
+	}
+
+	template <typename Visit>
+	void DigestManifest::probe(const uint64_t indexOffset, const uint64_t hash, const Visit &visit) const
+	{
+		// calls `visit(index)` for the records with a matching tag until it returns `true` or an empty slot is reached,
+		// records with the same key come in insertion order
+		if (!m_valid)
+			return;
+
+		const uint64_t mask = m_slots - 1;
+		const uint64_t tag = hash & 0xFFFFFFFF00000000;
+		for (uint64_t slot = hash & mask, n = 0; n < m_slots; slot = ((slot + 1) & mask), ++n)
+		{
+			const uint64_t entry = loadLE<uint64_t>(&m_data[static_cast<std::size_t>(indexOffset + (slot * 8))]);
+			if (entry == 0)
+				return;
+
+			const uint64_t index = (entry & 0xFFFFFFFF) - 1;
+			if (((entry & 0xFFFFFFFF00000000) == tag) && (index < m_records) && visit(static_cast<std::size_t>(index)))
+				return;
+		}
+	}
+
+	inline bool DigestManifest::digestEquals(const std::size_t index, const Span<const Byte> digest) const
+	{
+		const Byte *stored = &m_data[static_cast<std::size_t>(HEADER_SIZE + (index * m_recordSize) + 16)];
+		return std::equal(digest.begin(), digest.end(), stored);
+	}
+
+	inline std::size_t DigestManifest::find(const char *path, const std::size_t length) const
+	{
+		std::size_t ret = NOT_FOUND;
+		probe(m_pathIndexOffset, pathHash(path, length), [this, path, length, &ret](const std::size_t index) -> bool
+		{
+			const Record r = record(index);
+			if (r.digest.empty() || (r.pathLength != length) || !std::equal(path, (path + length), r.path))
+				return false;
+			ret = index;
+			return true;
+		});
+		return ret;
+	}
+
+	inline std::size_t DigestManifest::find(const std::string &path) const
+	{
+		return find(path.data(), path.size());
+	}
+
+	inline std::size_t DigestManifest::findDigest(const Span<const Byte> digest) const
+	{
+		std::size_t ret = NOT_FOUND;
+		if (digest.size() != m_digestSize)
+			return ret;
+
+		probe(m_digestIndexOffset, digestHash(digest.data(), m_digestSize), [this, digest, &ret](const std::size_t index) -> bool
+		{
+			if (!digestEquals(index, digest))
+				return false;
+			ret = index;
+			return true;
+		});
+		return ret;
+	}
+
+	inline std::vector<std::size_t> DigestManifest::findAllDigest(const Span<const Byte> digest) const
+	{
+		std::vector<std::size_t> ret;
+		if (digest.size() != m_digestSize)
+			return ret;
+
+		probe(m_digestIndexOffset, digestHash(digest.data(), m_digestSize), [this, digest, &ret](const std::size_t index) -> bool
+		{
+			if (digestEquals(index, digest))
+				ret.push_back(index);
+			return false;
+		});
+		return ret;
+	}
+
+	inline std::string DigestManifest::toSumText() const
+	{
+		std::string ret;
+		for (std::size_t i = 0; i < m_records; ++i)
+		{
+			const Record r = record(i);
+			if (r.digest.empty())
+				continue;
+
+			const bool escape = std::any_of(r.path, (r.path + r.pathLength), [](const char c) { return ((c == '\\') || (c == '\n') || (c == '\r')); });
+			if (escape)
+				ret += '\\';
+			for (const Byte c : r.digest)
+			{
+				const char digits[] = "0123456789abcdef";
+				ret += digits[c >> 4];
+				ret += digits[c & 0xf];
+			}
+			ret += (r.binary ? " *" : "  ");
+			if (escape)
+			{
+				for (std::size_t j = 0; j < r.pathLength; ++j)
+				{
+					const char c = r.path[j];
+					if (c == '\\')
+						ret += "\\\\";
+					else if (c == '\n')
+						ret += "\\n";
+					else if (c == '\r')
+						ret += "\\r";
+					else
+						ret += c;
+				}
+			}
+			else
+			{
+				ret.append(r.path, r.pathLength);
+			}
+			ret += '\n';
+		}
+		return ret;
+	}
+}
+}
+	using DigestManifestBuilder = Hash::DigestManifest_NS::DigestManifestBuilder;
+	using DigestManifest = Hash::DigestManifest_NS::DigestManifest;
+}
+
+#endif  // CHOCOBO1_DIGEST_MANIFEST_H
@@ -0,0 +1,816 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_FLETCHER_H
+#define CHOCOBO1_FLETCHER_H
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
+// SSE2/SSSE3 & AVX2 kernels, chosen at run time when the CPU supports them
+// define `USE_X86_SIMD_CHOCOBO1_HASH` to 0 to always use the portable code
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#if (defined(__x86_64__) || defined(_M_X64))
+#if defined(__has_builtin)
+#if (__has_builtin(__builtin_is_constant_evaluated) && __has_builtin(__builtin_cpu_supports))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#elif (defined(_MSC_VER) && (_MSC_VER >= 1925))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#endif
+#endif
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#define USE_X86_SIMD_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_SSSE3_CHOCOBO1_HASH
+#define TARGET_AVX2_CHOCOBO1_HASH
+#else
+#define TARGET_SSSE3_CHOCOBO1_HASH __attribute__((target("ssse3")))
+#define TARGET_AVX2_CHOCOBO1_HASH __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+#endif
+
+// with the prebuilt library, kernels are defined there only
+#ifndef INLINE_KERNEL_CHOCOBO1_HASH
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+#define INLINE_KERNEL_CHOCOBO1_HASH
+#else
+#define INLINE_KERNEL_CHOCOBO1_HASH inline
+#endif
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// Fletcher16();
+	// Fletcher32();
+	// Fletcher64();
+
+	// Fletcher32::combine(valueA, valueB, lengthB);  // merge checksums of adjacent segments, `lengthA` must be a multiple of the word size
+
+	// "abc"_fletcher32;  // C++20, digest as `Fletcher32::ResultArrayType` computed at compile time
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+#ifndef CONSTEXPR_CPP17_CHOCOBO1_HASH
+#if __cplusplus >= 201703L
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH constexpr
+#else
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH
+#endif
+#endif
+
+#ifndef CHOCOBO1_HASH_ROR_IMPL
+#define CHOCOBO1_HASH_ROR_IMPL
+	template <typename R, typename T>
+	constexpr R ror(const T x, const unsigned int s)
+	{
+		static_assert(std::is_unsigned<R>::value, "");
+		static_assert(std::is_unsigned<T>::value, "");
+		return static_cast<R>(x >> s);
+	}
+#endif
+
+
+namespace FLETCHER_NS
+{
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+	// Each kernel consumes whole 32-byte blocks & leaves the rest to the portable code, `a` & `b` are reduced on return.
+	// Per block of `n` words: `a` gains the word sum, `b` gains n * (`a` before the block) plus the words weighted n, n - 1, ..., 1.
+	// As in Adler-32, the n * `a` terms are collected in `prevSums` & added once per run of blocks, which is also when the modulo happens.
+	// A run is as long as `b` provably fits the accumulator: the lane sums may wrap, their total can't.
+	constexpr std::size_t SIMD_BLOCKS_16 = 181;  // 5792 bytes, largest for 32-bit `b` with a, b < 255 on entry
+	constexpr std::size_t SIMD_BLOCKS_32 = 22;  // 352 words, largest for 32-bit `b` with a, b < 65535 on entry
+	constexpr std::size_t SIMD_BLOCKS_64 = 4096;  // 32768 words, well below the 64-bit `b` limit
+
+	struct CpuFeatures
+	{
+		bool ssse3 = false;
+		bool avx2 = false;
+	};
+
+#if ((USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1) && !defined(BUILD_LIBRARY_CHOCOBO1_HASH))
+	const CpuFeatures& cpuFeatures();
+	TARGET_SSSE3_CHOCOBO1_HASH
+	void blocks16Ssse3(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining);
+	TARGET_AVX2_CHOCOBO1_HASH
+	void blocks16Avx2(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining);
+	void blocks32Sse2(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining);
+	TARGET_AVX2_CHOCOBO1_HASH
+	void blocks32Avx2(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining);
+	void blocks64Sse2(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining);
+	TARGET_AVX2_CHOCOBO1_HASH
+	void blocks64Avx2(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining);
+#else
+	INLINE_KERNEL_CHOCOBO1_HASH const CpuFeatures& cpuFeatures()
+	{
+		static const CpuFeatures ret = []() -> CpuFeatures
+		{
+			CpuFeatures features;
+#ifdef _MSC_VER
+			int info[4] = {};
+			__cpuid(info, 1);
+			features.ssse3 = ((info[2] & (1 << 9)) != 0);
+			const bool osAvx = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 0x6) == 0x6);
+			__cpuidex(info, 7, 0);
+			features.avx2 = osAvx && ((info[1] & (1 << 5)) != 0);
+#else
+			__builtin_cpu_init();
+			features.ssse3 = (__builtin_cpu_supports("ssse3") != 0);
+			features.avx2 = (__builtin_cpu_supports("avx2") != 0);
+#endif
+			return features;
+		}();
+		return ret;
+	}
+
+	// Fletcher-16: the Adler-32 kernels with modulo 255, bytes are summed with `psadbw` & weighted 32..1 with `pmaddubsw`
+
+	TARGET_SSSE3_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void blocks16Ssse3(uint64_t &a64, uint64_t &b64, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m128i tapsHigh = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+		const __m128i tapsLow = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+		const __m128i ones = _mm_set1_epi16(1);
+		const __m128i zero = _mm_setzero_si128();
+
+		uint32_t a = static_cast<uint32_t>(a64 % 255);
+		uint32_t b = static_cast<uint32_t>(b64 % 255);
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min((remaining / 32), SIMD_BLOCKS_16);
+			remaining -= (blocks * 32);
+
+			__m128i prevSums = _mm_cvtsi32_si128(static_cast<int>(a * blocks));
+			__m128i sumA = zero;
+			__m128i sumB = _mm_cvtsi32_si128(static_cast<int>(b));
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m128i bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+				const __m128i bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 16));
+
+				prevSums = _mm_add_epi32(prevSums, sumA);
+				sumA = _mm_add_epi32(sumA, _mm_add_epi32(_mm_sad_epu8(bytes1, zero), _mm_sad_epu8(bytes2, zero)));
+				sumB = _mm_add_epi32(sumB, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tapsHigh), ones));
+				sumB = _mm_add_epi32(sumB, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tapsLow), ones));
+			}
+			sumB = _mm_add_epi32(sumB, _mm_slli_epi32(prevSums, 5));
+
+			sumA = _mm_add_epi32(sumA, _mm_shuffle_epi32(sumA, _MM_SHUFFLE(1, 0, 3, 2)));
+			sumB = _mm_add_epi32(sumB, _mm_shuffle_epi32(sumB, _MM_SHUFFLE(2, 3, 0, 1)));
+			sumB = _mm_add_epi32(sumB, _mm_shuffle_epi32(sumB, _MM_SHUFFLE(1, 0, 3, 2)));
+			a = (a + static_cast<uint32_t>(_mm_cvtsi128_si32(sumA))) % 255;
+			b = static_cast<uint32_t>(_mm_cvtsi128_si32(sumB)) % 255;
+		}
+		a64 = a;
+		b64 = b;
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void blocks16Avx2(uint64_t &a64, uint64_t &b64, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m256i taps = _mm256_setr_epi8(
+			32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+			16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+		const __m256i ones = _mm256_set1_epi16(1);
+		const __m256i zero = _mm256_setzero_si256();
+
+		uint32_t a = static_cast<uint32_t>(a64 % 255);
+		uint32_t b = static_cast<uint32_t>(b64 % 255);
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min((remaining / 32), SIMD_BLOCKS_16);
+			remaining -= (blocks * 32);
+
+			__m256i prevSums = _mm256_setr_epi32(static_cast<int>(a * blocks), 0, 0, 0, 0, 0, 0, 0);
+			__m256i sumA = zero;
+			__m256i sumB = _mm256_setr_epi32(static_cast<int>(b), 0, 0, 0, 0, 0, 0, 0);
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+
+				prevSums = _mm256_add_epi32(prevSums, sumA);
+				sumA = _mm256_add_epi32(sumA, _mm256_sad_epu8(bytes, zero));
+				sumB = _mm256_add_epi32(sumB, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, taps), ones));
+			}
+			sumB = _mm256_add_epi32(sumB, _mm256_slli_epi32(prevSums, 5));
+
+			__m128i sumA128 = _mm_add_epi32(_mm256_castsi256_si128(sumA), _mm256_extracti128_si256(sumA, 1));
+			__m128i sumB128 = _mm_add_epi32(_mm256_castsi256_si128(sumB), _mm256_extracti128_si256(sumB, 1));
+			sumA128 = _mm_add_epi32(sumA128, _mm_shuffle_epi32(sumA128, _MM_SHUFFLE(1, 0, 3, 2)));
+			sumB128 = _mm_add_epi32(sumB128, _mm_shuffle_epi32(sumB128, _MM_SHUFFLE(2, 3, 0, 1)));
+			sumB128 = _mm_add_epi32(sumB128, _mm_shuffle_epi32(sumB128, _MM_SHUFFLE(1, 0, 3, 2)));
+			a = (a + static_cast<uint32_t>(_mm_cvtsi128_si32(sumA128))) % 255;
+			b = static_cast<uint32_t>(_mm_cvtsi128_si32(sumB128)) % 255;
+		}
+		a64 = a;
+		b64 = b;
+	}
+
+	// Fletcher-32: 16 words per block weighted 16..1 with `pmaddwd`. It multiplies signed words, so the words
+	// are biased by -32768 (top bit flipped) & the bias comes back per block: 16 * 32768 in `a`, (16 + 15 + ... + 1) * 32768 in `b`
+
+	inline uint32_t horizontalSum32(const __m128i v)
+	{
+		const __m128i sum = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+		return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)))));
+	}
+
+	inline void fold32(uint32_t &a, uint32_t &b, const std::size_t blocks, const uint32_t sumA, const uint32_t prevSums, const uint32_t sumB)
+	{
+		// unsigned arithmetic wraps, the true values fit in 32 bits
+		const uint32_t n = static_cast<uint32_t>(blocks);
+		const uint32_t biasA = 16 * 32768;
+		const uint32_t biasB = 136 * 32768;
+		b = (b + (16 * ((a * n) + prevSums + (biasA * ((n * (n - 1)) / 2)))) + sumB + (biasB * n)) % 65535;
+		a = (a + sumA + (biasA * n)) % 65535;
+	}
+
+	INLINE_KERNEL_CHOCOBO1_HASH void blocks32Sse2(uint64_t &a64, uint64_t &b64, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m128i tapsHigh = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+		const __m128i tapsLow = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+		const __m128i ones = _mm_set1_epi16(1);
+		const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+
+		uint32_t a = static_cast<uint32_t>(a64 % 65535);
+		uint32_t b = static_cast<uint32_t>(b64 % 65535);
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min((remaining / 32), SIMD_BLOCKS_32);
+			remaining -= (blocks * 32);
+
+			__m128i prevSums = _mm_setzero_si128();
+			__m128i sumA = _mm_setzero_si128();
+			__m128i sumB = _mm_setzero_si128();
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m128i words1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)), bias);
+				const __m128i words2 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 16)), bias);
+
+				prevSums = _mm_add_epi32(prevSums, sumA);
+				sumA = _mm_add_epi32(sumA, _mm_add_epi32(_mm_madd_epi16(words1, ones), _mm_madd_epi16(words2, ones)));
+				sumB = _mm_add_epi32(sumB, _mm_add_epi32(_mm_madd_epi16(words1, tapsHigh), _mm_madd_epi16(words2, tapsLow)));
+			}
+			fold32(a, b, blocks, horizontalSum32(sumA), horizontalSum32(prevSums), horizontalSum32(sumB));
+		}
+		a64 = a;
+		b64 = b;
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void blocks32Avx2(uint64_t &a64, uint64_t &b64, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m256i taps = _mm256_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+		const __m256i ones = _mm256_set1_epi16(1);
+		const __m256i bias = _mm256_set1_epi16(static_cast<short>(0x8000));
+
+		uint32_t a = static_cast<uint32_t>(a64 % 65535);
+		uint32_t b = static_cast<uint32_t>(b64 % 65535);
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min((remaining / 32), SIMD_BLOCKS_32);
+			remaining -= (blocks * 32);
+
+			__m256i prevSums = _mm256_setzero_si256();
+			__m256i sumA = _mm256_setzero_si256();
+			__m256i sumB = _mm256_setzero_si256();
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m256i words = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)), bias);
+
+				prevSums = _mm256_add_epi32(prevSums, sumA);
+				sumA = _mm256_add_epi32(sumA, _mm256_madd_epi16(words, ones));
+				sumB = _mm256_add_epi32(sumB, _mm256_madd_epi16(words, taps));
+			}
+
+			const __m128i sumA128 = _mm_add_epi32(_mm256_castsi256_si128(sumA), _mm256_extracti128_si256(sumA, 1));
+			const __m128i prevSums128 = _mm_add_epi32(_mm256_castsi256_si128(prevSums), _mm256_extracti128_si256(prevSums, 1));
+			const __m128i sumB128 = _mm_add_epi32(_mm256_castsi256_si128(sumB), _mm256_extracti128_si256(sumB, 1));
+			fold32(a, b, blocks, horizontalSum32(sumA128), horizontalSum32(prevSums128), horizontalSum32(sumB128));
+		}
+		a64 = a;
+		b64 = b;
+	}
+
+	// Fletcher-64: 8 words per block in 64-bit lanes, weighted 8..1 with `pmuludq`
+
+	inline uint64_t horizontalSum64(const __m128i v)
+	{
+		const __m128i sum = _mm_add_epi64(v, _mm_unpackhi_epi64(v, v));
+		return static_cast<uint64_t>(_mm_cvtsi128_si64(sum));
+	}
+
+	INLINE_KERNEL_CHOCOBO1_HASH void blocks64Sse2(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m128i taps[4] = {_mm_set_epi64x(7, 8), _mm_set_epi64x(5, 6), _mm_set_epi64x(3, 4), _mm_set_epi64x(1, 2)};
+		const __m128i zero = _mm_setzero_si128();
+		const uint64_t mod = 0xFFFFFFFF;
+
+		a %= mod;
+		b %= mod;
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min((remaining / 32), SIMD_BLOCKS_64);
+			remaining -= (blocks * 32);
+
+			__m128i prevSums = zero;
+			__m128i sumA = zero;
+			__m128i sumB = zero;
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m128i words1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+				const __m128i words2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 16));
+				const __m128i w0 = _mm_unpacklo_epi32(words1, zero);
+				const __m128i w1 = _mm_unpackhi_epi32(words1, zero);
+				const __m128i w2 = _mm_unpacklo_epi32(words2, zero);
+				const __m128i w3 = _mm_unpackhi_epi32(words2, zero);
+
+				prevSums = _mm_add_epi64(prevSums, sumA);
+				sumA = _mm_add_epi64(sumA, _mm_add_epi64(_mm_add_epi64(w0, w1), _mm_add_epi64(w2, w3)));
+				sumB = _mm_add_epi64(sumB, _mm_add_epi64(_mm_mul_epu32(w0, taps[0]), _mm_mul_epu32(w1, taps[1])));
+				sumB = _mm_add_epi64(sumB, _mm_add_epi64(_mm_mul_epu32(w2, taps[2]), _mm_mul_epu32(w3, taps[3])));
+			}
+
+			b = (b + (8 * ((a * blocks) + horizontalSum64(prevSums))) + horizontalSum64(sumB)) % mod;
+			a = (a + horizontalSum64(sumA)) % mod;
+		}
+	}
+
+	TARGET_AVX2_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void blocks64Avx2(uint64_t &a, uint64_t &b, const uint8_t *&ptr, std::size_t &remaining)
+	{
+		const __m256i tapsHigh = _mm256_setr_epi64x(8, 7, 6, 5);
+		const __m256i tapsLow = _mm256_setr_epi64x(4, 3, 2, 1);
+		const uint64_t mod = 0xFFFFFFFF;
+
+		a %= mod;
+		b %= mod;
+		while (remaining >= 32)
+		{
+			const std::size_t blocks = std::min((remaining / 32), SIMD_BLOCKS_64);
+			remaining -= (blocks * 32);
+
+			__m256i prevSums = _mm256_setzero_si256();
+			__m256i sumA = _mm256_setzero_si256();
+			__m256i sumB = _mm256_setzero_si256();
+			for (std::size_t i = 0; i < blocks; ++i, ptr += 32)
+			{
+				const __m256i words1 = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+				const __m256i words2 = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 16)));
+
+				prevSums = _mm256_add_epi64(prevSums, sumA);
+				sumA = _mm256_add_epi64(sumA, _mm256_add_epi64(words1, words2));
+				sumB = _mm256_add_epi64(sumB, _mm256_add_epi64(_mm256_mul_epu32(words1, tapsHigh), _mm256_mul_epu32(words2, tapsLow)));
+			}
+
+			const __m128i sumA128 = _mm_add_epi64(_mm256_castsi256_si128(sumA), _mm256_extracti128_si256(sumA, 1));
+			const __m128i prevSums128 = _mm_add_epi64(_mm256_castsi256_si128(prevSums), _mm256_extracti128_si256(prevSums, 1));
+			const __m128i sumB128 = _mm_add_epi64(_mm256_castsi256_si128(sumB), _mm256_extracti128_si256(sumB, 1));
+			b = (b + (8 * ((a * blocks) + horizontalSum64(prevSums128))) + horizontalSum64(sumB128)) % mod;
+			a = (a + horizontalSum64(sumA128)) % mod;
+		}
+	}
+#endif
+#endif
+
+
+	template <int Width>
+	class Fletcher
+	{
+		// https://en.wikipedia.org/wiki/Fletcher%27s_checksum
+		// sums of (Width / 2)-bit little endian words modulo 2^(Width / 2) - 1, a trailing partial word is zero padded
+
+		public:
+			using Byte = uint8_t;
+			using ValueType = typename std::conditional<(Width == 16), uint16_t,
+				typename std::conditional<(Width == 32), uint32_t, uint64_t>::type>::type;
+			using ResultArrayType = std::array<Byte, (Width / 8)>;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+
+			constexpr Fletcher();
+
+			constexpr void reset();
+			constexpr Fletcher& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toString()`, `toValue()`, `toVector()` are available
+
+			std::string toString() const;
+			std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP17_CHOCOBO1_HASH ResultArrayType toArray() const;
+			constexpr ValueType toValue() const;
+			template <typename T>
+			CONSTEXPR_CPP17_CHOCOBO1_HASH operator T() const noexcept;
+
+			constexpr Fletcher& addData(Span<const Byte> inData);
+			constexpr Fletcher& addData(const void *ptr, std::size_t length);
+			template <std::size_t N>
+			constexpr Fletcher& addData(const Byte (&array)[N]);
+			template <typename T, std::size_t N>
+			Fletcher& addData(const T (&array)[N]);
+			template <typename T>
+			Fletcher& addData(Span<T> inSpan);
+
+			// value of the concatenation, from the values of both parts & the length of the second part
+			static constexpr ValueType combine(ValueType valueA, ValueType valueB, uint64_t lengthB);
+
+			friend constexpr bool operator==(const Fletcher &left, const Fletcher &right)
+			{
+				return (left.toValue() == right.toValue());
+			}
+			friend constexpr bool operator!=(const Fletcher &left, const Fletcher &right)
+			{
+				return !(left == right);
+			}
+
+		private:
+			constexpr void addDataImpl(Span<const Byte> data);
+			void addDataSimd(const Byte *&ptr, std::size_t &remaining);
+			static constexpr uint64_t readWord(const Byte *ptr);
+
+			static constexpr int WORD_BYTES = (Width / 16);
+			static constexpr int HALF_BITS = (Width / 2);
+			static constexpr uint64_t MOD = (~static_cast<uint64_t>(0) >> (64 - HALF_BITS));
+			// words summed before the modulo, `m_b` grows quadratically & must stay below 2^64
+			static constexpr std::size_t BLOCK_WORDS = (Width == 64) ? (1 << 15) : (1 << 20);
+
+			uint64_t m_a = 0;
+			uint64_t m_b = 0;
+			Byte m_partial[WORD_BYTES] = {};
+			uint8_t m_partialSize = 0;
+	};
+
+
+	//
+	template <int Width>
+	constexpr Fletcher<Width>::Fletcher()
+	{
+		static_assert(((Width == 16) || (Width == 32) || (Width == 64)), "Template parameter value invalid: Width");
+		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+
+		reset();
+	}
+
+	template <int Width>
+	constexpr void Fletcher<Width>::reset()
+	{
+		m_a = 0;
+		m_b = 0;
+		m_partialSize = 0;
+	}
+
+	template <int Width>
+	constexpr Fletcher<Width>& Fletcher<Width>::finalize()
+	{
+		if (m_partialSize > 0)
+		{
+			for (int i = m_partialSize; i < WORD_BYTES; ++i)
+				m_partial[i] = 0;
+			m_a += readWord(m_partial);
+			m_b += m_a;
+			m_partialSize = 0;
+		}
+		m_a %= MOD;
+		m_b %= MOD;
+		return (*this);
+	}
+
+	template <int Width>
+	std::string Fletcher<Width>::toString() const
+	{
+		const auto digest = toArray();
+		std::string ret;
+		ret.resize(2 * digest.size());
+
+		auto *retPtr = &ret.front();
+		for (const auto c : digest)
+		{
+			const Byte upper = ror<Byte>(c, 4);
+			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
+
+			const Byte lower = c & 0xf;
+			*(retPtr++) = static_cast<char>((lower < 10) ? (lower + '0') : (lower - 10 + 'a'));
+		}
+
+		return ret;
+	}
+
+	template <int Width>
+	std::vector<typename Fletcher<Width>::Byte> Fletcher<Width>::toVector() const
+	{
+		const auto digest = toArray();
+		return {digest.begin(), digest.end()};
+	}
+
+	template <int Width>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH typename Fletcher<Width>::ResultArrayType Fletcher<Width>::toArray() const
+	{
+		// big endian, same as `toValue()` printed in hex
+		const ValueType value = toValue();
+		const int dataSize = static_cast<int>(std::tuple_size<ResultArrayType>::value);
+
+		ResultArrayType ret {};
+		auto *retPtr = ret.data();
+		for (int j = (dataSize - 1); j >= 0; --j)
+			*(retPtr++) = ror<Byte>(value, static_cast<unsigned int>(j * 8));
+
+		return ret;
+	}
+
+	template <int Width>
+	constexpr typename Fletcher<Width>::ValueType Fletcher<Width>::toValue() const
+	{
+		return static_cast<ValueType>(((m_b % MOD) << HALF_BITS) | (m_a % MOD));
+	}
+
+	template <int Width>
+	template <typename T>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH Fletcher<Width>::operator T() const noexcept
+	{
+		static_assert(std::is_unsigned<T>::value, "");
+
+		const auto digest = toArray();
+		T ret = 0;
+		for (int i = 0, iMax = static_cast<int>(std::min(sizeof(T), digest.size())); i < iMax; ++i)
+		{
+			ret <<= 8;
+			ret |= digest[i];
+		}
+		return ret;
+	}
+
+	template <int Width>
+	constexpr Fletcher<Width>& Fletcher<Width>::addData(const Span<const Byte> inData)
+	{
+		addDataImpl(inData);
+		return (*this);
+	}
+
+	template <int Width>
+	constexpr Fletcher<Width>& Fletcher<Width>::addData(const void *ptr, const std::size_t length)
+	{
+		// Span::size_type = std::size_t
+		return addData({static_cast<const Byte*>(ptr), length});
+	}
+
+	template <int Width>
+	template <std::size_t N>
+	constexpr Fletcher<Width>& Fletcher<Width>::addData(const Byte (&array)[N])
+	{
+		return addData({array, N});
+	}
+
+	template <int Width>
+	template <typename T, std::size_t N>
+	Fletcher<Width>& Fletcher<Width>::addData(const T (&array)[N])
+	{
+		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
+	}
+
+	template <int Width>
+	template <typename T>
+	Fletcher<Width>& Fletcher<Width>::addData(const Span<T> inSpan)
+	{
+		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
+	}
+
+	template <int Width>
+	constexpr typename Fletcher<Width>::ValueType Fletcher<Width>::combine(const ValueType valueA, const ValueType valueB, const uint64_t lengthB)
+	{
+		// a = aA + aB, b = bA + bB + n * aA, `n` being the number of (padded) words in B
+		const uint64_t mask = MOD;
+		const uint64_t n = ((lengthB + WORD_BYTES - 1) / WORD_BYTES) % MOD;
+		const uint64_t aA = valueA & mask;
+		const uint64_t bA = static_cast<uint64_t>(valueA) >> HALF_BITS;
+		const uint64_t aB = valueB & mask;
+		const uint64_t bB = static_cast<uint64_t>(valueB) >> HALF_BITS;
+
+		// `n * aA` may not fit in 64 bits for Fletcher-64, multiply by doubling instead
+		uint64_t product = 0;
+		uint64_t addend = aA % MOD;
+		for (uint64_t i = n; i > 0; i >>= 1)
+		{
+			if (i & 1)
+				product = (product + addend) % MOD;
+			addend = (addend + addend) % MOD;
+		}
+
+		const uint64_t a = ((aA % MOD) + (aB % MOD)) % MOD;
+		const uint64_t b = (((bA % MOD) + (bB % MOD)) % MOD + product) % MOD;
+		return static_cast<ValueType>((b << HALF_BITS) | a);
+	}
+
+	template <int Width>
+	constexpr uint64_t Fletcher<Width>::readWord(const Byte *ptr)
+	{
+		uint64_t ret = 0;
+		for (int i = (WORD_BYTES - 1); i >= 0; --i)
+			ret = (ret << 8) | ptr[i];
+		return ret;
+	}
+
+	template <int Width>
+	constexpr void Fletcher<Width>::addDataImpl(const Span<const Byte> data)
+	{
+		const Byte *ptr = data.data();
+		std::size_t remaining = static_cast<std::size_t>(data.size());
+
+		if (m_partialSize > 0)
+		{
+			for (; (m_partialSize < WORD_BYTES) && (remaining > 0); --remaining)
+				m_partial[m_partialSize++] = *(ptr++);
+			if (m_partialSize < WORD_BYTES)
+				return;
+
+			m_a += readWord(m_partial);
+			m_b += m_a;
+			m_partialSize = 0;
+		}
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+		if (!__builtin_is_constant_evaluated() && (remaining >= 64))
+			addDataSimd(ptr, remaining);
+#endif
+
+		uint64_t a = m_a;
+		uint64_t b = m_b;
+		for (std::size_t words = (remaining / WORD_BYTES); words > 0;)
+		{
+			const std::size_t size = (words < BLOCK_WORDS) ? words : BLOCK_WORDS;  // `std::min()` would odr-use it
+			words -= size;
+
+			for (std::size_t i = 0; i < size; ++i, ptr += WORD_BYTES)
+			{
+				a += readWord(ptr);
+				b += a;
+			}
+
+			a %= MOD;
+			b %= MOD;
+		}
+		m_a = a;
+		m_b = b;
+
+		for (remaining %= WORD_BYTES; remaining > 0; --remaining)
+			m_partial[m_partialSize++] = *(ptr++);
+	}
+
+	template <int Width>
+	void Fletcher<Width>::addDataSimd(const Byte *&ptr, std::size_t &remaining)
+	{
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+		const CpuFeatures &features = cpuFeatures();
+		if (Width == 16)
+		{
+			if (features.avx2)
+				blocks16Avx2(m_a, m_b, ptr, remaining);
+			else if (features.ssse3)
+				blocks16Ssse3(m_a, m_b, ptr, remaining);
+		}
+		else if (Width == 32)
+		{
+			if (features.avx2)
+				blocks32Avx2(m_a, m_b, ptr, remaining);
+			else
+				blocks32Sse2(m_a, m_b, ptr, remaining);
+		}
+		else
+		{
+			if (features.avx2)
+				blocks64Avx2(m_a, m_b, ptr, remaining);
+			else
+				blocks64Sse2(m_a, m_b, ptr, remaining);
+		}
+#else
+		static_cast<void>(ptr);
+		static_cast<void>(remaining);
+#endif
+	}
+}
+}
+
+	using Fletcher16 = Hash::FLETCHER_NS::Fletcher<16>;
+	using Fletcher32 = Hash::FLETCHER_NS::Fletcher<32>;
+	using Fletcher64 = Hash::FLETCHER_NS::Fletcher<64>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::FLETCHER_NS::Fletcher<16>;
+	extern template class Hash::FLETCHER_NS::Fletcher<32>;
+	extern template class Hash::FLETCHER_NS::Fletcher<64>;
+#endif
+}
+
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval Fletcher16::ResultArrayType operator""_fletcher16(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Fletcher16>(str, length);
+	}
+
+	consteval Fletcher32::ResultArrayType operator""_fletcher32(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Fletcher32>(str, length);
+	}
+
+	consteval Fletcher64::ResultArrayType operator""_fletcher64(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Fletcher64>(str, length);
+	}
+}
+}
+#endif
+
+namespace std
+{
+	template <int Width>
+	struct hash<Chocobo1::Hash::FLETCHER_NS::Fletcher<Width>>
+	{
+		CONSTEXPR_CPP17_CHOCOBO1_HASH size_t operator()(const Chocobo1::Hash::FLETCHER_NS::Fletcher<Width> &hash) const noexcept
+		{
+			return hash;
+		}
+	};
+}
+
+#endif  // CHOCOBO1_FLETCHER_H
@@ -39,6 +39,11 @@
 #include "gsl/span"
 #endif
 
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
 
 namespace Chocobo1
 {
@@ -49,6 +54,8 @@ namespace Chocobo1
 	// FNV64_0();
 	// FNV64_1();
 	// FNV64_1a();
+
+	// "abc"_fnv64_1a;  // C++20, digest as `FNV64_1a::ResultArrayType` computed at compile time
 }
 
 
@@ -322,8 +329,78 @@ namespace FNVHASH_NS
 	using FNV64_0 = Hash::FNVHASH_NS::FNVHash<uint64_t, 0>;
 	using FNV64_1 = Hash::FNVHASH_NS::FNVHash<uint64_t, 1>;
 	using FNV64_1a = Hash::FNVHASH_NS::FNVHash<uint64_t, 2>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::FNVHASH_NS::FNVHash<uint32_t, 0>;
+	extern template class Hash::FNVHASH_NS::FNVHash<uint32_t, 1>;
+	extern template class Hash::FNVHASH_NS::FNVHash<uint32_t, 2>;
+	extern template class Hash::FNVHASH_NS::FNVHash<uint64_t, 0>;
+	extern template class Hash::FNVHASH_NS::FNVHash<uint64_t, 1>;
+	extern template class Hash::FNVHASH_NS::FNVHash<uint64_t, 2>;
+#endif
+}
+
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
 }
 
+inline namespace Literals
+{
+	consteval FNV32_0::ResultArrayType operator""_fnv32_0(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<FNV32_0>(str, length);
+	}
+
+	consteval FNV32_1::ResultArrayType operator""_fnv32_1(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<FNV32_1>(str, length);
+	}
+
+	consteval FNV32_1a::ResultArrayType operator""_fnv32_1a(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<FNV32_1a>(str, length);
+	}
+
+	consteval FNV64_0::ResultArrayType operator""_fnv64_0(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<FNV64_0>(str, length);
+	}
+
+	consteval FNV64_1::ResultArrayType operator""_fnv64_1(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<FNV64_1>(str, length);
+	}
+
+	consteval FNV64_1a::ResultArrayType operator""_fnv64_1a(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<FNV64_1a>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <typename DigestType, int Variant>
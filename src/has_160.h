@@ -45,6 +45,8 @@ namespace Chocobo1
 {
 	// Use these!!
 	// HAS_160();
+
+	// "abc"_has_160;  // C++20, digest as `HAS_160::ResultArrayType` computed at compile time
 }
 
 
@@ -158,8 +160,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -189,7 +195,23 @@ namespace Hash
 
 namespace HAS160_NS
 {
-	class HAS_160
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr unsigned int lTable[80] =
+		{
+			18,  0, 1,  2,  3, 19,  4,  5, 6,  7, 16,  8,  9, 10, 11, 17, 12, 13, 14, 15,
+			18,  3, 6,  9, 12, 19, 15,  2, 5,  8, 16, 11, 14,  1,  4, 17,  7, 10, 13,  0,
+			18, 12, 5, 14,  7, 19,  0,  9, 2, 11, 16,  4, 13,  6, 15, 17,  8,  1, 10,  3,
+			18,  7, 2, 13,  8, 19,  3, 14, 9,  4, 16, 15, 10,  5,  0, 17, 11,  6,  1, 12
+		};
+	};
+
+	template <typename T>
+	constexpr unsigned int Tables<T>::lTable[80];
+
+
+	class HAS_160 : private Tables<>
 	{
 		// https://www.tta.or.kr/eng/new/standardization/eng_ttastddesc.jsp?stdno=TTAS.KO-12.0011/R2
 
@@ -209,7 +231,7 @@ namespace HAS160_NS
 			constexpr HAS_160();
 
 			constexpr void reset();
-			HAS_160& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toString()`, `toVector()` are available
+			CONSTEXPR_CPP17_CHOCOBO1_HASH HAS_160& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toString()`, `toVector()` are available
 
 			std::string toString() const;
 			std::vector<Byte> toVector() const;
@@ -217,10 +239,10 @@ namespace HAS160_NS
 			template <typename T>
 			CONSTEXPR_CPP17_CHOCOBO1_HASH operator T() const noexcept;
 
-			HAS_160& addData(Span<const Byte> inData);
-			HAS_160& addData(const void *ptr, std::size_t length);
+			CONSTEXPR_CPP17_CHOCOBO1_HASH HAS_160& addData(Span<const Byte> inData);
+			CONSTEXPR_CPP17_CHOCOBO1_HASH HAS_160& addData(const void *ptr, std::size_t length);
 			template <std::size_t N>
-			HAS_160& addData(const Byte (&array)[N]);
+			CONSTEXPR_CPP17_CHOCOBO1_HASH HAS_160& addData(const Byte (&array)[N]);
 			template <typename T, std::size_t N>
 			HAS_160& addData(const T (&array)[N]);
 			template <typename T>
@@ -241,14 +263,13 @@ namespace HAS160_NS
 			}
 
 		private:
-			void addDataImpl(Span<const Byte> data);
+			CONSTEXPR_CPP17_CHOCOBO1_HASH void addDataImpl(Span<const Byte> data);
 
 			static constexpr int BLOCK_SIZE = 64;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
 			uint64_t m_sizeCounter = 0;
-
 			uint32_t m_h[5] = {};
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 	};
 
 
@@ -284,6 +305,7 @@ namespace HAS160_NS
 	constexpr HAS_160::HAS_160()
 	{
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(HAS_160) < (sizeof(m_buffer) + sizeof(m_sizeCounter) + sizeof(m_h) + alignof(HAS_160))), "Constant tables should not be stored in each instance");
 		reset();
 	}
 
@@ -299,21 +321,25 @@ namespace HAS160_NS
 		m_h[4] = 0xC3D2E1F0;
 	}
 
-	inline HAS_160& HAS_160::finalize()
+	CONSTEXPR_CPP17_CHOCOBO1_HASH inline HAS_160& HAS_160::finalize()
 	{
-		m_sizeCounter += m_buffer.size();
+		const uint64_t sizeCounterBits = ((m_sizeCounter + m_buffer.size()) * 8);
+		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
+		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 
 		// append 1 bit
 		m_buffer.fill(1 << 7);
 
-		// append paddings
-		const auto len = static_cast<int>(((2 * BLOCK_SIZE) - (m_buffer.size() + 8)) % BLOCK_SIZE);
-		m_buffer.fill(0, (len + 8));
+		// append paddings, the size field must fit in the last block
+		if (m_buffer.size() > (BLOCK_SIZE - 8))
+		{
+			m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
+			addDataImpl({m_buffer.data(), m_buffer.size()});
+			m_buffer.clear();
+		}
+		m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
 
 		// append size in bits
-		const uint64_t sizeCounterBits = m_sizeCounter * 8;
-		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
-		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 		for (int i = 0; i < 4; ++i)
 		{
 			m_buffer[m_buffer.size() - 8 + i] = ror<Byte>(sizeCounterBitsL, (8 * i));
@@ -382,7 +408,7 @@ namespace HAS160_NS
 		return ret;
 	}
 
-	inline HAS_160& HAS_160::addData(const Span<const Byte> inData)
+	CONSTEXPR_CPP17_CHOCOBO1_HASH inline HAS_160& HAS_160::addData(const Span<const Byte> inData)
 	{
 		Span<const Byte> data = inData;
 
@@ -416,14 +442,14 @@ namespace HAS160_NS
 		return (*this);
 	}
 
-	inline HAS_160& HAS_160::addData(const void *ptr, const std::size_t length)
+	CONSTEXPR_CPP17_CHOCOBO1_HASH inline HAS_160& HAS_160::addData(const void *ptr, const std::size_t length)
 	{
 		// Span::size_type = std::size_t
 		return addData({static_cast<const Byte*>(ptr), length});
 	}
 
 	template <std::size_t N>
-	HAS_160& HAS_160::addData(const Byte (&array)[N])
+	CONSTEXPR_CPP17_CHOCOBO1_HASH HAS_160& HAS_160::addData(const Byte (&array)[N])
 	{
 		return addData({array, N});
 	}
@@ -440,7 +466,7 @@ namespace HAS160_NS
 		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
 	}
 
-	inline void HAS_160::addDataImpl(const Span<const Byte> data)
+	CONSTEXPR_CPP17_CHOCOBO1_HASH inline void HAS_160::addDataImpl(const Span<const Byte> data)
 	{
 		assert((data.size() % BLOCK_SIZE) == 0);
 
@@ -450,15 +476,7 @@ namespace HAS160_NS
 		{
 			const Loader<uint32_t> x(static_cast<const Byte *>(data.data() + (i * BLOCK_SIZE)));
 
-			static const unsigned int lTable[80] =
-			{
-				18,  0, 1,  2,  3, 19,  4,  5, 6,  7, 16,  8,  9, 10, 11, 17, 12, 13, 14, 15,
-				18,  3, 6,  9, 12, 19, 15,  2, 5,  8, 16, 11, 14,  1,  4, 17,  7, 10, 13,  0,
-				18, 12, 5, 14,  7, 19,  0,  9, 2, 11, 16,  4, 13,  6, 15, 17,  8,  1, 10,  3,
-				18,  7, 2, 13,  8, 19,  3, 14, 9,  4, 16, 15, 10,  5,  0, 17, 11,  6,  1, 12
-			};
-
-			uint32_t xTable[20];
+			uint32_t xTable[20] = {};
 			for (int j = 0; j < 16; ++j)
 				xTable[j] = x[j];
 
@@ -601,6 +619,41 @@ namespace HAS160_NS
 	using HAS_160 = Hash::HAS160_NS::HAS_160;
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval HAS_160::ResultArrayType operator""_has_160(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<HAS_160>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <>
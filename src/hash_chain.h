@@ -0,0 +1,388 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_HASH_CHAIN_H
+#define CHOCOBO1_HASH_CHAIN_H
+
+#include "multi_buffer.h"
+#include "sha3.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// HashChain<SHA2_256>(publicSeed, n, tweakLength, stepOffset).run(values, tweaks, starts, steps);
+	// HashChain<SHAKE_256>(...);
+
+	// Iterates the tweakable hash of WOTS+ chains (SPHINCS+ "simple" `F`):
+	//   x[i + 1] = first n bytes of H(prefix || tweak || x[i])
+	// `tweak` is given per chain, the step number `i` is written into it big endian at `stepOffset`
+	// (the "hash address" of an ADRS), a negative `stepOffset` leaves the tweak as is.
+	// SHA2_256: the prefix is zero padded to a 64-byte block & its midstate is computed once,
+	//           `tweak` + `x` must fit in the one remaining block (at most 55 bytes).
+	// SHAKE_128, SHAKE_256: the prefix is used as is, `prefix` + `tweak` + `x` must fit in one block (rate - 1 bytes).
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace HashChain_NS
+{
+	using Byte = uint8_t;
+
+	// Each kernel hashes one prepared single-block message per lane, all lanes in lockstep.
+	// Message blocks already hold the constant parts (prefix, paddings, length) so a step only copies in the tweak & value.
+	template <typename Alg, int Lanes>
+	struct ChainKernel;
+
+	template <int Lanes>
+	struct ChainKernel<SHA2_256, Lanes>
+	{
+		static constexpr int BLOCK_SIZE = 64;
+		static constexpr int MAX_VALUE_SIZE = 32;
+
+		using Compressor = MultiBuffer_NS::Kernel<SHA2_256, Lanes>;
+		using MidstateCompressor = MultiBuffer_NS::Kernel<SHA2_256, 1>;
+
+		uint32_t midstate[8] = {};
+		int prefixSize = 0;  // bytes of the prefix within the block, always 0
+
+		explicit ChainKernel(const Byte *prefix, const std::size_t prefixLength)
+		{
+			assert(prefixLength <= BLOCK_SIZE);
+
+			Byte block[BLOCK_SIZE] = {};
+			std::copy(prefix, (prefix + prefixLength), block);
+
+			uint32_t state[8][1] = {};
+			MidstateCompressor::init(state, 0);
+			const Byte *const blocks[1] = {block};
+			MidstateCompressor::compress(state, blocks);
+			for (int i = 0; i < 8; ++i)
+				midstate[i] = state[i][0];
+		}
+
+		static bool fits(const std::size_t prefixLength, const std::size_t messageLength)
+		{
+			return ((prefixLength <= BLOCK_SIZE) && ((messageLength + 1 + 8) <= BLOCK_SIZE));
+		}
+
+		void prepare(Byte (&block)[BLOCK_SIZE], const std::size_t messageLength) const
+		{
+			// padding for the whole message: prefix block + this block
+			std::fill(std::begin(block), std::end(block), Byte(0));
+			block[messageLength] = (1 << 7);
+			const uint64_t sizeCounterBits = (static_cast<uint64_t>(BLOCK_SIZE) + messageLength) * 8;
+			for (int i = 0; i < 8; ++i)
+				block[BLOCK_SIZE - 1 - i] = ror<Byte>(sizeCounterBits, (8 * i));
+		}
+
+		void hash(const Byte *const (&blocks)[Lanes], Byte *const (&outputs)[Lanes], const int outputSize) const
+		{
+			uint32_t state[8][Lanes];
+			for (int i = 0; i < 8; ++i)
+				std::fill(std::begin(state[i]), std::end(state[i]), midstate[i]);
+
+			Compressor::compress(state, blocks);
+
+			for (int l = 0; l < Lanes; ++l)
+			{
+				for (int i = 0; i < outputSize; ++i)
+					outputs[l][i] = ror<Byte>(state[i / 4][l], (8 * (3 - (i % 4))));
+			}
+		}
+	};
+
+	template <int R, int Lanes>
+	struct ChainKernel<SHAKEAlias<SHA3_NS::Keccak<R, 0x1F>>, Lanes>
+	{
+		static constexpr int BLOCK_SIZE = R;
+		static constexpr int MAX_VALUE_SIZE = R;
+
+		std::vector<Byte> prefix;
+		int prefixSize = 0;  // bytes of the prefix within the block
+
+		explicit ChainKernel(const Byte *prefixPtr, const std::size_t prefixLength)
+			: prefix(prefixPtr, (prefixPtr + prefixLength))
+			, prefixSize(static_cast<int>(prefixLength))
+		{
+		}
+
+		static bool fits(const std::size_t prefixLength, const std::size_t messageLength)
+		{
+			return ((prefixLength + messageLength + 1) <= BLOCK_SIZE);
+		}
+
+		void prepare(Byte (&block)[BLOCK_SIZE], const std::size_t messageLength) const
+		{
+			std::fill(std::begin(block), std::end(block), Byte(0));
+			std::copy(prefix.begin(), prefix.end(), block);
+			block[prefix.size() + messageLength] = 0x1F;
+			block[BLOCK_SIZE - 1] |= (1 << 7);
+		}
+
+		void hash(const Byte *const (&blocks)[Lanes], Byte *const (&outputs)[Lanes], const int outputSize) const
+		{
+			// structure-of-arrays Keccak-f[1600], `a[x + 5 * y][lane]`
+			uint64_t a[25][Lanes] = {};
+			for (int i = 0; i < (BLOCK_SIZE / 8); ++i)
+			{
+				for (int l = 0; l < Lanes; ++l)
+				{
+					const Byte *ptr = blocks[l] + (8 * i);
+					uint64_t value = 0;
+					for (int j = 7; j >= 0; --j)
+						value = (value << 8) | ptr[j];
+					a[i][l] = value;
+				}
+			}
+
+			static constexpr int rotations[25] =
+			{
+				0, 1, 62, 28, 27,
+				36, 44, 6, 55, 20,
+				3, 10, 43, 25, 39,
+				41, 45, 15, 21, 8,
+				18, 2, 61, 56, 14
+			};
+
+			for (int round = 0; round < 24; ++round)
+			{
+				uint64_t c[5][Lanes];
+				for (int x = 0; x < 5; ++x)
+				{
+					for (int l = 0; l < Lanes; ++l)
+						c[x][l] = a[x][l] ^ a[x + 5][l] ^ a[x + 10][l] ^ a[x + 15][l] ^ a[x + 20][l];
+				}
+				for (int x = 0; x < 5; ++x)
+				{
+					for (int l = 0; l < Lanes; ++l)
+					{
+						const uint64_t d = c[(x + 4) % 5][l] ^ rotl(c[(x + 1) % 5][l], 1);
+						for (int y = 0; y < 25; y += 5)
+							a[x + y][l] ^= d;
+					}
+				}
+
+				// rho & pi
+				uint64_t b[25][Lanes];
+				for (int x = 0; x < 5; ++x)
+				{
+					for (int y = 0; y < 5; ++y)
+					{
+						const int from = x + (5 * y);
+						const int to = y + (5 * (((2 * x) + (3 * y)) % 5));
+						for (int l = 0; l < Lanes; ++l)
+							b[to][l] = rotl(a[from][l], static_cast<unsigned int>(rotations[from]));
+					}
+				}
+
+				// chi & iota
+				for (int y = 0; y < 25; y += 5)
+				{
+					for (int x = 0; x < 5; ++x)
+					{
+						for (int l = 0; l < Lanes; ++l)
+							a[x + y][l] = b[x + y][l] ^ ((~b[((x + 1) % 5) + y][l]) & b[((x + 2) % 5) + y][l]);
+					}
+				}
+				for (int l = 0; l < Lanes; ++l)
+					a[0][l] ^= SHA3_NS::Tables<>::roundConstantTable[round];
+			}
+
+			for (int l = 0; l < Lanes; ++l)
+			{
+				for (int i = 0; i < outputSize; ++i)
+					outputs[l][i] = ror<Byte>(a[i / 8][l], (8 * (i % 8)));
+			}
+		}
+	};
+
+
+	template <typename Alg, int Lanes = 8>
+	class HashChain
+	{
+		// Many independent chains, one chain per lane, a lane picks up the next chain when its chain is done.
+		// Hash-based signatures (WOTS+, XMSS, SPHINCS+) spend nearly all their time in these short fixed-length hashes.
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			static constexpr int LANES = Lanes;
+
+			HashChain(Span<const Byte> prefix, int n, int tweakLength, int stepOffset);
+
+			// Chain `c` owns `values[c * n, (c + 1) * n)` & `tweaks[c * tweakLength, (c + 1) * tweakLength)`,
+			// its value is advanced in place from step `starts[c]` by `steps[c]` steps.
+			void run(Span<Byte> values, Span<const Byte> tweaks, Span<const uint32_t> starts, Span<const uint32_t> steps) const;
+
+			// one step of one chain, for reference
+			void step(Span<Byte> value, Span<const Byte> tweak, uint32_t index) const;
+
+		private:
+			using KernelType = ChainKernel<Alg, Lanes>;
+			static constexpr int BLOCK_SIZE = KernelType::BLOCK_SIZE;
+
+			void setStep(Byte *tweakPtr, uint32_t index) const;
+
+			KernelType m_kernel;
+			int m_n = 0;
+			int m_tweakLength = 0;
+			int m_stepOffset = -1;
+	};
+
+
+	//
+	template <typename Alg, int Lanes>
+	HashChain<Alg, Lanes>::HashChain(const Span<const Byte> prefix, const int n, const int tweakLength, const int stepOffset)
+		: m_kernel(prefix.data(), prefix.size())
+		, m_n(n)
+		, m_tweakLength(tweakLength)
+		, m_stepOffset(stepOffset)
+	{
+		static_assert((Lanes > 0), "Template parameter value invalid: Lanes");
+		assert((n > 0) && (n <= KernelType::MAX_VALUE_SIZE));
+		assert(tweakLength >= 0);
+		assert((stepOffset < 0) || ((stepOffset + 4) <= tweakLength));
+		assert(KernelType::fits(prefix.size(), static_cast<std::size_t>(tweakLength + n)));
+	}
+
+	template <typename Alg, int Lanes>
+	void HashChain<Alg, Lanes>::setStep(Byte *tweakPtr, const uint32_t index) const
+	{
+		if (m_stepOffset < 0)
+			return;
+		for (int i = 0; i < 4; ++i)
+			tweakPtr[m_stepOffset + i] = ror<Byte>(index, (8 * (3 - i)));
+	}
+
+	template <typename Alg, int Lanes>
+	void HashChain<Alg, Lanes>::run(const Span<Byte> values, const Span<const Byte> tweaks, const Span<const uint32_t> starts, const Span<const uint32_t> steps) const
+	{
+		const std::size_t chains = starts.size();
+		assert(steps.size() == chains);
+		assert(values.size() >= (chains * static_cast<std::size_t>(m_n)));
+		assert(tweaks.size() >= (chains * static_cast<std::size_t>(m_tweakLength)));
+
+		const std::size_t messageLength = static_cast<std::size_t>(m_tweakLength + m_n);
+
+		struct Lane
+		{
+			bool active = false;
+			std::size_t chain = 0;
+			uint32_t index = 0;
+			uint32_t end = 0;
+			Byte block[BLOCK_SIZE] = {};
+		};
+		Lane lanes[Lanes];
+
+		// the constant parts of the message block are written once per lane
+		for (Lane &lane : lanes)
+			m_kernel.prepare(lane.block, messageLength);
+
+		std::size_t nextChain = 0;
+		const auto loadLane = [&](Lane &lane) -> void
+		{
+			while ((nextChain < chains) && (steps[nextChain] == 0))
+				++nextChain;
+			if (nextChain >= chains)
+			{
+				lane.active = false;
+				return;
+			}
+
+			lane.active = true;
+			lane.chain = nextChain;
+			lane.index = starts[nextChain];
+			lane.end = starts[nextChain] + steps[nextChain];
+
+			Byte *message = lane.block + m_kernel.prefixSize;
+			std::copy_n((tweaks.data() + (nextChain * static_cast<std::size_t>(m_tweakLength))), m_tweakLength, message);
+			std::copy_n((values.data() + (nextChain * static_cast<std::size_t>(m_n))), m_n, (message + m_tweakLength));
+			++nextChain;
+		};
+
+		for (Lane &lane : lanes)
+			loadLane(lane);
+
+		while (true)
+		{
+			const Byte *blocks[Lanes] = {};
+			Byte *outputs[Lanes] = {};
+			bool anyActive = false;
+			for (int l = 0; l < Lanes; ++l)
+			{
+				Lane &lane = lanes[l];
+				Byte *message = lane.block + m_kernel.prefixSize;
+				if (lane.active)
+				{
+					anyActive = true;
+					setStep(message, lane.index);
+				}
+
+				// idle lanes hash their stale block, the result is thrown away
+				blocks[l] = lane.block;
+				outputs[l] = message + m_tweakLength;  // the output is the next input
+			}
+			if (!anyActive)
+				break;
+
+			m_kernel.hash(blocks, outputs, m_n);
+
+			for (Lane &lane : lanes)
+			{
+				if (!lane.active)
+					continue;
+
+				++lane.index;
+				if (lane.index < lane.end)
+					continue;
+
+				const Byte *message = lane.block + m_kernel.prefixSize;
+				std::copy_n((message + m_tweakLength), m_n, (values.data() + (lane.chain * static_cast<std::size_t>(m_n))));
+				loadLane(lane);
+			}
+		}
+	}
+
+	template <typename Alg, int Lanes>
+	void HashChain<Alg, Lanes>::step(const Span<Byte> value, const Span<const Byte> tweak, const uint32_t index) const
+	{
+		const uint32_t start[1] = {index};
+		const uint32_t count[1] = {1};
+		run(value, tweak, start, count);
+	}
+}
+}
+	template <typename Alg, int Lanes = 8>
+	using HashChain = Hash::HashChain_NS::HashChain<Alg, Lanes>;
+}
+
+#endif  // CHOCOBO1_HASH_CHAIN_H
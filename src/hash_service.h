@@ -0,0 +1,569 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_HASH_SERVICE_H
+#define CHOCOBO1_HASH_SERVICE_H
+
+#include "multi_buffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// HashService service; service.submit<SHA2_256>(data).get();
+	// auto session = service.openSession<Blake2>(); session.addData(data); session.finalize().get();
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace HashService_NS
+{
+	struct HashServiceOptions
+	{
+		unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u);
+		std::size_t queueCapacity = 1024;  // `submit()` blocks while this many jobs are waiting
+		bool pinThreads = false;  // pin worker `i` to core `i % cores`, only effective on Linux
+	};
+
+
+	struct Job
+	{
+		// Jobs with the same non-null `batch` may be run together, `run` is used otherwise
+		void (*batch)(Job *jobs, std::size_t count) = nullptr;
+		std::function<void ()> run;
+		std::shared_ptr<void> state;
+	};
+
+
+	class JobQueue
+	{
+		// Bounded multi-producer multi-consumer queue
+
+		public:
+			explicit JobQueue(std::size_t capacity);
+
+			void push(Job &&job);  // blocks while full
+			bool pop(std::vector<Job> &jobs, std::size_t maxBatch);  // returns false once closed & drained
+			void close();
+
+		private:
+			std::mutex m_mutex;
+			std::condition_variable m_notEmpty;
+			std::condition_variable m_notFull;
+			std::deque<Job> m_jobs;
+			std::size_t m_capacity = 0;
+			bool m_closed = false;
+	};
+
+	inline JobQueue::JobQueue(const std::size_t capacity)
+		: m_capacity(std::max<std::size_t>(capacity, 1))
+	{
+	}
+
+	inline void JobQueue::push(Job &&job)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_notFull.wait(lock, [this]() { return (m_jobs.size() < m_capacity); });
+			m_jobs.emplace_back(std::move(job));
+		}
+		m_notEmpty.notify_one();
+	}
+
+	inline bool JobQueue::pop(std::vector<Job> &jobs, const std::size_t maxBatch)
+	{
+		jobs.clear();
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_notEmpty.wait(lock, [this]() { return (m_closed || !m_jobs.empty()); });
+			if (m_jobs.empty())
+				return false;
+
+			jobs.emplace_back(std::move(m_jobs.front()));
+			m_jobs.pop_front();
+
+			// gather other queued jobs of the same algorithm
+			const auto batch = jobs.front().batch;
+			if (batch != nullptr)
+			{
+				for (auto iter = m_jobs.begin(); (iter != m_jobs.end()) && (jobs.size() < maxBatch);)
+				{
+					if (iter->batch != batch)
+					{
+						++iter;
+						continue;
+					}
+					jobs.emplace_back(std::move(*iter));
+					iter = m_jobs.erase(iter);
+				}
+			}
+		}
+		m_notFull.notify_all();
+		return true;
+	}
+
+	inline void JobQueue::close()
+	{
+		{
+			const std::lock_guard<std::mutex> lock(m_mutex);
+			m_closed = true;
+		}
+		m_notEmpty.notify_all();
+	}
+
+
+	template <typename Alg>
+	struct IsMultiBufferCapable : std::false_type {};
+	template <>
+	struct IsMultiBufferCapable<MD5> : std::true_type {};
+	template <>
+	struct IsMultiBufferCapable<SHA1> : std::true_type {};
+	template <>
+	struct IsMultiBufferCapable<SHA2_256> : std::true_type {};
+
+	template <typename Alg>
+	struct OneShotState
+	{
+		using ResultArrayType = typename Alg::ResultArrayType;
+		using Span = typename Alg::template Span<const typename Alg::Byte>;
+
+		std::promise<ResultArrayType> promise;
+		Span data;
+		std::vector<typename Alg::Byte> storage;  // when the service owns the data
+	};
+
+	template <typename Alg>
+	void runMultiBuffer(Job *jobs, const std::size_t count)
+	{
+		using State = OneShotState<Alg>;
+		using MultiHash = MultiBuffer<Alg>;
+
+		if (count == 1)
+		{
+			State &state = *static_cast<State *>(jobs[0].state.get());
+			try
+			{
+				state.promise.set_value(Alg().addData(state.data).finalize().toArray());
+			}
+			catch (...)
+			{
+				state.promise.set_exception(std::current_exception());
+			}
+			return;
+		}
+
+		std::vector<typename MultiHash::ResultArrayType> results;
+		try
+		{
+			std::vector<typename MultiHash::template Span<const typename MultiHash::Byte>> messages;
+			messages.reserve(count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const State &state = *static_cast<const State *>(jobs[i].state.get());
+				messages.emplace_back(state.data.data(), state.data.size());
+			}
+			results = MultiHash::hash(messages);
+		}
+		catch (...)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				static_cast<State *>(jobs[i].state.get())->promise.set_exception(std::current_exception());
+			return;
+		}
+
+		for (std::size_t i = 0; i < count; ++i)
+			static_cast<State *>(jobs[i].state.get())->promise.set_value(results[i]);
+	}
+
+
+	template <typename Alg>
+	class HashSession;
+
+	class HashService
+	{
+		// Fixed worker pool hashing submitted buffers, results are delivered through futures.
+		// Queued MD5 / SHA-1 / SHA2-256 jobs are picked up together and hashed with `MultiBuffer`.
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			explicit HashService(HashServiceOptions options = {});
+			HashService(const HashService &) = delete;
+			HashService& operator=(const HashService &) = delete;
+			~HashService();  // finishes all queued jobs
+
+			// `data` must stay valid until the future is ready
+			template <typename Alg>
+			std::future<typename Alg::ResultArrayType> submit(Span<const Byte> data);
+			// the service keeps `data` alive
+			template <typename Alg>
+			std::future<typename Alg::ResultArrayType> submit(std::vector<Byte> &&data);
+			// `data` is added to `hasher`, which may hold a key or prior input, such jobs are never batched
+			template <typename Alg>
+			std::future<typename Alg::ResultArrayType> submit(Span<const Byte> data, Alg hasher);
+			template <typename Alg>
+			std::future<typename Alg::ResultArrayType> submit(std::vector<Byte> &&data, Alg hasher);
+
+			template <typename Alg>
+			HashSession<Alg> openSession(Alg hasher = Alg());
+
+			void post(std::function<void ()> func);  // run arbitrary work on the pool, exceptions thrown by `func` are discarded
+
+		private:
+			template <typename Alg>
+			std::future<typename Alg::ResultArrayType> submitImpl(std::shared_ptr<OneShotState<Alg>> state, std::true_type);
+			template <typename Alg>
+			std::future<typename Alg::ResultArrayType> submitImpl(std::shared_ptr<OneShotState<Alg>> state, std::false_type);
+			template <typename Alg>
+			std::future<typename Alg::ResultArrayType> submitImpl(std::shared_ptr<OneShotState<Alg>> state, Alg &&hasher);
+
+			void run(unsigned int index, bool pin);
+
+			JobQueue m_queue;
+			std::vector<std::thread> m_workers;
+	};
+
+
+	template <typename Alg>
+	class HashSession
+	{
+		// Streaming input to one hash on the service. Chunks are processed in order on the pool,
+		// `addData()` copies the data and returns immediately.
+
+		public:
+			using Byte = uint8_t;
+			using ResultArrayType = typename Alg::ResultArrayType;
+			using Span = typename Alg::template Span<const Byte>;
+
+			HashSession& addData(Span inData);
+			HashSession& addData(const void *ptr, std::size_t length);
+			std::future<ResultArrayType> finalize();  // no more `addData()` after this, the future rethrows what `Alg` threw
+
+		private:
+			friend class HashService;
+
+			struct State
+			{
+				std::mutex mutex;
+				Alg hasher;
+				std::deque<std::vector<Byte>> chunks;
+				bool running = false;
+				bool finalizing = false;
+				std::exception_ptr error;  // thrown by `hasher`, later chunks are dropped
+				std::promise<ResultArrayType> promise;
+
+				explicit State(Alg &&h)
+					: hasher(std::move(h))
+				{
+				}
+			};
+
+			HashSession(HashService *service, Alg &&hasher);
+
+			bool claimDrain();  // `m_state->mutex` must be held, returns true when the caller should `startDrain()`
+			void startDrain();  // `m_state->mutex` must not be held, posting blocks while the queue is full
+			static void drain(const std::shared_ptr<State> &state);
+
+			HashService *m_service = nullptr;
+			std::shared_ptr<State> m_state;
+	};
+
+
+	//
+	inline HashService::HashService(const HashServiceOptions options)
+		: m_queue(options.queueCapacity)
+	{
+		const unsigned int threads = std::max(options.threads, 1u);
+		m_workers.reserve(threads);
+		for (unsigned int i = 0; i < threads; ++i)
+			m_workers.emplace_back(&HashService::run, this, i, options.pinThreads);
+	}
+
+	inline HashService::~HashService()
+	{
+		m_queue.close();
+		for (std::thread &worker : m_workers)
+			worker.join();
+	}
+
+	template <typename Alg>
+	std::future<typename Alg::ResultArrayType> HashService::submit(const Span<const Byte> data)
+	{
+		auto state = std::make_shared<OneShotState<Alg>>();
+		state->data = {data.data(), data.size()};
+		return submitImpl(std::move(state), IsMultiBufferCapable<Alg>());
+	}
+
+	template <typename Alg>
+	std::future<typename Alg::ResultArrayType> HashService::submit(std::vector<Byte> &&data)
+	{
+		auto state = std::make_shared<OneShotState<Alg>>();
+		state->storage = std::move(data);
+		state->data = {state->storage.data(), state->storage.size()};
+		return submitImpl(std::move(state), IsMultiBufferCapable<Alg>());
+	}
+
+	template <typename Alg>
+	std::future<typename Alg::ResultArrayType> HashService::submit(const Span<const Byte> data, Alg hasher)
+	{
+		auto state = std::make_shared<OneShotState<Alg>>();
+		state->data = {data.data(), data.size()};
+		return submitImpl(std::move(state), std::move(hasher));
+	}
+
+	template <typename Alg>
+	std::future<typename Alg::ResultArrayType> HashService::submit(std::vector<Byte> &&data, Alg hasher)
+	{
+		auto state = std::make_shared<OneShotState<Alg>>();
+		state->storage = std::move(data);
+		state->data = {state->storage.data(), state->storage.size()};
+		return submitImpl(std::move(state), std::move(hasher));
+	}
+
+	template <typename Alg>
+	std::future<typename Alg::ResultArrayType> HashService::submitImpl(std::shared_ptr<OneShotState<Alg>> state, std::true_type)
+	{
+		auto future = state->promise.get_future();
+
+		Job job;
+		job.batch = &runMultiBuffer<Alg>;
+		job.state = std::move(state);
+		m_queue.push(std::move(job));
+		return future;
+	}
+
+	template <typename Alg>
+	std::future<typename Alg::ResultArrayType> HashService::submitImpl(std::shared_ptr<OneShotState<Alg>> state, std::false_type)
+	{
+		return submitImpl(std::move(state), Alg());
+	}
+
+	template <typename Alg>
+	std::future<typename Alg::ResultArrayType> HashService::submitImpl(std::shared_ptr<OneShotState<Alg>> state, Alg &&hasher)
+	{
+		auto future = state->promise.get_future();
+
+		Job job;
+		auto sharedHasher = std::make_shared<Alg>(std::move(hasher));
+		job.run = [state, sharedHasher]() -> void
+		{
+			try
+			{
+				state->promise.set_value(sharedHasher->addData(state->data).finalize().toArray());
+			}
+			catch (...)
+			{
+				state->promise.set_exception(std::current_exception());
+			}
+		};
+		m_queue.push(std::move(job));
+		return future;
+	}
+
+	template <typename Alg>
+	HashSession<Alg> HashService::openSession(Alg hasher)
+	{
+		return HashSession<Alg>(this, std::move(hasher));
+	}
+
+	inline void HashService::post(std::function<void ()> func)
+	{
+		Job job;
+		job.run = std::move(func);
+		m_queue.push(std::move(job));
+	}
+
+	inline void HashService::run(const unsigned int index, const bool pin)
+	{
+#if defined(__linux__)
+		if (pin)
+		{
+			const unsigned int cores = std::max(std::thread::hardware_concurrency(), 1u);
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+			CPU_SET((index % cores), &cpuSet);
+			pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+		}
+#else
+		(void) index;
+		(void) pin;
+#endif
+
+		std::vector<Job> jobs;
+		while (m_queue.pop(jobs, MultiBuffer<MD5>::LANES))
+		{
+			// hashing jobs report failures through their promise, an escaping exception would end the process
+			try
+			{
+				if (jobs.front().batch != nullptr)
+					jobs.front().batch(jobs.data(), jobs.size());
+				else
+					jobs.front().run();
+			}
+			catch (...)
+			{
+			}
+		}
+	}
+
+
+	template <typename Alg>
+	HashSession<Alg>::HashSession(HashService *service, Alg &&hasher)
+		: m_service(service)
+		, m_state(std::make_shared<State>(std::move(hasher)))
+	{
+	}
+
+	template <typename Alg>
+	HashSession<Alg>& HashSession<Alg>::addData(const Span inData)
+	{
+		bool start = false;
+		{
+			const std::lock_guard<std::mutex> lock(m_state->mutex);
+			assert(!m_state->finalizing);
+			if (m_state->error)
+				return (*this);
+
+			m_state->chunks.emplace_back(inData.begin(), inData.end());
+			start = claimDrain();
+		}
+		if (start)
+			startDrain();
+		return (*this);
+	}
+
+	template <typename Alg>
+	HashSession<Alg>& HashSession<Alg>::addData(const void *ptr, const std::size_t length)
+	{
+		return addData({static_cast<const Byte *>(ptr), length});
+	}
+
+	template <typename Alg>
+	std::future<typename HashSession<Alg>::ResultArrayType> HashSession<Alg>::finalize()
+	{
+		std::future<ResultArrayType> future;
+		bool start = false;
+		{
+			const std::lock_guard<std::mutex> lock(m_state->mutex);
+			assert(!m_state->finalizing);
+
+			m_state->finalizing = true;
+			future = m_state->promise.get_future();
+			if (m_state->error)
+			{
+				m_state->promise.set_exception(m_state->error);
+				return future;
+			}
+			start = claimDrain();
+		}
+		if (start)
+			startDrain();
+		return future;
+	}
+
+	template <typename Alg>
+	bool HashSession<Alg>::claimDrain()
+	{
+		// at most one drain job per session is in flight, which keeps chunks in order
+		if (m_state->running)
+			return false;
+
+		m_state->running = true;
+		return true;
+	}
+
+	template <typename Alg>
+	void HashSession<Alg>::startDrain()
+	{
+		std::shared_ptr<State> state = m_state;
+		m_service->post([state]() -> void
+		{
+			drain(state);
+		});
+	}
+
+	template <typename Alg>
+	void HashSession<Alg>::drain(const std::shared_ptr<State> &state)
+	{
+		try
+		{
+			while (true)
+			{
+				std::vector<Byte> chunk;
+				{
+					const std::lock_guard<std::mutex> lock(state->mutex);
+					if (state->chunks.empty())
+					{
+						state->running = false;
+						if (state->finalizing)
+							state->promise.set_value(state->hasher.finalize().toArray());
+						return;
+					}
+					chunk = std::move(state->chunks.front());
+					state->chunks.pop_front();
+				}
+				state->hasher.addData(chunk.data(), chunk.size());
+			}
+		}
+		catch (...)
+		{
+			// the session is broken, report it through `finalize()`
+			const std::lock_guard<std::mutex> lock(state->mutex);
+			state->error = std::current_exception();
+			state->chunks.clear();
+			state->running = false;
+			if (state->finalizing)
+				state->promise.set_exception(state->error);
+		}
+	}
+}
+}
+	using HashService = Hash::HashService_NS::HashService;
+	using HashServiceOptions = Hash::HashService_NS::HashServiceOptions;
+	template <typename Alg>
+	using HashSession = Hash::HashService_NS::HashSession<Alg>;
+}
+
+#endif  // CHOCOBO1_HASH_SERVICE_H
@@ -0,0 +1,705 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_HIGHWAYHASH_H
+#define CHOCOBO1_HIGHWAYHASH_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
+// AVX2 kernel, chosen at run time when the CPU supports them
+// define `USE_X86_SIMD_CHOCOBO1_HASH` to 0 to always use the portable code
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#if (defined(__x86_64__) || defined(_M_X64))
+#if defined(__has_builtin)
+#if (__has_builtin(__builtin_is_constant_evaluated) && __has_builtin(__builtin_cpu_supports))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#elif (defined(_MSC_VER) && (_MSC_VER >= 1925))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#endif
+#endif
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#define USE_X86_SIMD_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2_CHOCOBO1_HASH
+#else
+#define TARGET_AVX2_CHOCOBO1_HASH __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+#endif
+
+// with the prebuilt library, kernels are defined there only
+#ifndef INLINE_KERNEL_CHOCOBO1_HASH
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+#define INLINE_KERNEL_CHOCOBO1_HASH
+#else
+#define INLINE_KERNEL_CHOCOBO1_HASH inline
+#endif
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// HighwayHash64(const Span<const Byte> key);  // 32 bytes key
+	// HighwayHash128(const Span<const Byte> key);
+	// HighwayHash256(const Span<const Byte> key);
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+#ifndef CONSTEXPR_CPP17_CHOCOBO1_HASH
+#if __cplusplus >= 201703L
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH constexpr
+#else
+#define CONSTEXPR_CPP17_CHOCOBO1_HASH
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+	using IndexType = std::size_t;
+#else
+	using IndexType = gsl::index;
+#endif
+
+#ifndef CHOCOBO1_HASH_BUFFER_IMPL
+#define CHOCOBO1_HASH_BUFFER_IMPL
+	template <typename T, IndexType N>
+	class Buffer
+	{
+		public:
+			using value_type = T;
+			using index_type = IndexType;
+			using size_type = std::size_t;
+
+			constexpr Buffer() = default;
+
+			CONSTEXPR_CPP17_CHOCOBO1_HASH Buffer(const std::initializer_list<T> initList)
+			{
+#if !defined(NDEBUG)
+				// check if out-of-bounds
+				static_cast<void>(m_array.at(m_dataEndIdx + initList.size() - 1));
+#endif
+
+				for (const auto &i : initList)
+				{
+					m_array[m_dataEndIdx] = i;
+					++m_dataEndIdx;
+				}
+			}
+
+			template <typename InputIt>
+			constexpr Buffer(const InputIt first, const InputIt last)
+			{
+				for (InputIt iter = first; iter != last; ++iter)
+				{
+					this->fill(*iter);
+				}
+			}
+
+			constexpr T& operator[](const index_type pos)
+			{
+				return m_array[pos];
+			}
+
+			constexpr T operator[](const index_type pos) const
+			{
+				return m_array[pos];
+			}
+
+			CONSTEXPR_CPP17_CHOCOBO1_HASH void fill(const T &value, const index_type count = 1)
+			{
+#if !defined(NDEBUG)
+				// check if out-of-bounds
+				static_cast<void>(m_array.at(m_dataEndIdx + count - 1));
+#endif
+
+				for (index_type i = 0; i < count; ++i)
+				{
+					m_array[m_dataEndIdx] = value;
+					++m_dataEndIdx;
+				}
+			}
+
+			template <typename InputIt>
+			constexpr void push_back(const InputIt first, const InputIt last)
+			{
+				for (InputIt iter = first; iter != last; ++iter)
+				{
+					this->fill(*iter);
+				}
+			}
+
+			constexpr void clear()
+			{
+				m_array = {};
+				m_dataEndIdx = 0;
+			}
+
+			constexpr bool empty() const
+			{
+				return (m_dataEndIdx == 0);
+			}
+
+			constexpr size_type size() const
+			{
+				return m_dataEndIdx;
+			}
+
+			constexpr const T* data() const
+			{
+				return m_array.data();
+			}
+
+		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
+			std::array<T, N> m_array {};
+			counter_type m_dataEndIdx = 0;
+	};
+#endif
+
+#ifndef CHOCOBO1_HASH_ROR_IMPL
+#define CHOCOBO1_HASH_ROR_IMPL
+	template <typename R, typename T>
+	constexpr R ror(const T x, const unsigned int s)
+	{
+		static_assert(std::is_unsigned<R>::value, "");
+		static_assert(std::is_unsigned<T>::value, "");
+		return static_cast<R>(x >> s);
+	}
+#endif
+
+#ifndef CHOCOBO1_HASH_ROTL_IMPL
+#define CHOCOBO1_HASH_ROTL_IMPL
+	template <typename T>
+	constexpr T rotl(const T x, const unsigned int s)
+	{
+		static_assert(std::is_unsigned<T>::value, "");
+		if (s == 0)
+			return x;
+		return ((x << s) | (x >> ((sizeof(T) * 8) - s)));
+	}
+#endif
+
+
+namespace HIGHWAYHASH_NS
+{
+	struct State
+	{
+		uint64_t v0[4];
+		uint64_t v1[4];
+		uint64_t mul0[4];
+		uint64_t mul1[4];
+	};
+
+	constexpr uint64_t load64(const uint8_t *ptr)
+	{
+		return  ( (static_cast<uint64_t>(*(ptr + 0)) <<  0)
+				| (static_cast<uint64_t>(*(ptr + 1)) <<  8)
+				| (static_cast<uint64_t>(*(ptr + 2)) << 16)
+				| (static_cast<uint64_t>(*(ptr + 3)) << 24)
+				| (static_cast<uint64_t>(*(ptr + 4)) << 32)
+				| (static_cast<uint64_t>(*(ptr + 5)) << 40)
+				| (static_cast<uint64_t>(*(ptr + 6)) << 48)
+				| (static_cast<uint64_t>(*(ptr + 7)) << 56));
+	}
+
+	constexpr void zipperMergeAndAdd(const uint64_t v1, const uint64_t v0, uint64_t &add1, uint64_t &add0)
+	{
+		// moves the well mixed middle bytes of the products into the lower halves, across both lanes
+		add0 += (((v0 & 0xff000000) | (v1 & 0xff00000000)) >> 24)
+			| (((v0 & 0xff0000000000) | (v1 & 0xff000000000000)) >> 16)
+			| (v0 & 0xff0000) | ((v0 & 0xff00) << 32)
+			| ((v1 & 0xff00000000000000) >> 8) | (v0 << 56);
+		add1 += (((v1 & 0xff000000) | (v0 & 0xff00000000)) >> 24)
+			| (v1 & 0xff0000) | ((v1 & 0xff0000000000) >> 16)
+			| ((v1 & 0xff00) << 24) | ((v0 & 0xff000000000000) >> 8)
+			| ((v1 & 0xff) << 48) | (v0 & 0xff00000000000000);
+	}
+
+	constexpr void update(State &state, const uint64_t (&lanes)[4])
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			state.v1[i] += state.mul0[i] + lanes[i];
+			state.mul0[i] ^= (state.v1[i] & 0xffffffff) * (state.v0[i] >> 32);
+			state.v0[i] += state.mul1[i];
+			state.mul1[i] ^= (state.v0[i] & 0xffffffff) * (state.v1[i] >> 32);
+		}
+		zipperMergeAndAdd(state.v1[1], state.v1[0], state.v0[1], state.v0[0]);
+		zipperMergeAndAdd(state.v1[3], state.v1[2], state.v0[3], state.v0[2]);
+		zipperMergeAndAdd(state.v0[1], state.v0[0], state.v1[1], state.v1[0]);
+		zipperMergeAndAdd(state.v0[3], state.v0[2], state.v1[3], state.v1[2]);
+	}
+
+	constexpr void updatePackets(State &state, const uint8_t *ptr, const std::size_t packets)
+	{
+		for (std::size_t i = 0; i < packets; ++i, ptr += 32)
+		{
+			const uint64_t lanes[4] = {load64(ptr), load64(ptr + 8), load64(ptr + 16), load64(ptr + 24)};
+			update(state, lanes);
+		}
+	}
+
+	constexpr void permuteAndUpdate(State &state)
+	{
+		const uint64_t permuted[4] = {
+			rotl(state.v0[2], 32), rotl(state.v0[3], 32),
+			rotl(state.v0[0], 32), rotl(state.v0[1], 32)};
+		update(state, permuted);
+	}
+
+	constexpr void modularReduction(const uint64_t a3Unmasked, const uint64_t a2, const uint64_t a1, const uint64_t a0, uint64_t &m1, uint64_t &m0)
+	{
+		const uint64_t a3 = a3Unmasked & 0x3FFFFFFFFFFFFFFF;
+		m1 = a1 ^ ((a3 << 1) | (a2 >> 63)) ^ ((a3 << 2) | (a2 >> 62));
+		m0 = a0 ^ (a2 << 1) ^ (a2 << 2);
+	}
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#if ((USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1) && !defined(BUILD_LIBRARY_CHOCOBO1_HASH))
+	bool hasAvx2();
+	TARGET_AVX2_CHOCOBO1_HASH
+	void updatePacketsAvx2(State &state, const uint8_t *ptr, std::size_t packets);
+#else
+	INLINE_KERNEL_CHOCOBO1_HASH bool hasAvx2()
+	{
+		static const bool ret = []() -> bool
+		{
+#ifdef _MSC_VER
+			int info[4] = {};
+			__cpuid(info, 1);
+			const bool osAvx = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 0x6) == 0x6);
+			__cpuidex(info, 7, 0);
+			return osAvx && ((info[1] & (1 << 5)) != 0);
+#else
+			__builtin_cpu_init();
+			return (__builtin_cpu_supports("avx2") != 0);
+#endif
+		}();
+		return ret;
+	}
+
+	// The four lanes of each state vector live in one register, the 32x32 bit products come from
+	// `vpmuludq` & the zipper merge is a single `vpshufb` within each 128-bit half
+	TARGET_AVX2_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void updatePacketsAvx2(State &state, const uint8_t *ptr, const std::size_t packets)
+	{
+		const __m256i zipperMerge = _mm256_set_epi64x(0x070806090D0A040B, 0x000F010E05020C03, 0x070806090D0A040B, 0x000F010E05020C03);
+
+		__m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state.v0));
+		__m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state.v1));
+		__m256i mul0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state.mul0));
+		__m256i mul1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state.mul1));
+
+		for (std::size_t i = 0; i < packets; ++i, ptr += 32)
+		{
+			const __m256i packet = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+
+			v1 = _mm256_add_epi64(v1, _mm256_add_epi64(mul0, packet));
+			mul0 = _mm256_xor_si256(mul0, _mm256_mul_epu32(v1, _mm256_srli_epi64(v0, 32)));
+			v0 = _mm256_add_epi64(v0, mul1);
+			mul1 = _mm256_xor_si256(mul1, _mm256_mul_epu32(v0, _mm256_srli_epi64(v1, 32)));
+			v0 = _mm256_add_epi64(v0, _mm256_shuffle_epi8(v1, zipperMerge));
+			v1 = _mm256_add_epi64(v1, _mm256_shuffle_epi8(v0, zipperMerge));
+		}
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(state.v0), v0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(state.v1), v1);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(state.mul0), mul0);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(state.mul1), mul1);
+	}
+#endif
+#endif
+
+
+	template <int Bits>  // digest size: 64, 128 or 256
+	class HighwayHash
+	{
+		// https://github.com/google/highwayhash
+
+		public:
+			using Byte = uint8_t;
+			using ResultArrayType = std::array<Byte, (Bits / 8)>;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+
+			constexpr HighwayHash(Span<const Byte> key);
+
+			constexpr void reset();
+			CONSTEXPR_CPP17_CHOCOBO1_HASH HighwayHash& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toString()`, `toVector()` are available
+
+			std::string toString() const;
+			std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP17_CHOCOBO1_HASH ResultArrayType toArray() const;
+			template <typename T>
+			CONSTEXPR_CPP17_CHOCOBO1_HASH operator T() const noexcept;
+
+			constexpr HighwayHash& addData(Span<const Byte> inData);
+			constexpr HighwayHash& addData(const void *ptr, std::size_t length);
+			template <std::size_t N>
+			constexpr HighwayHash& addData(const Byte (&array)[N]);
+			template <typename T, std::size_t N>
+			HighwayHash& addData(const T (&array)[N]);
+			template <typename T>
+			HighwayHash& addData(Span<T> inSpan);
+
+			friend constexpr bool operator==(const HighwayHash &left, const HighwayHash &right)
+			{
+				for (int i = 0; i < 4; ++i)
+				{
+					if ((left.m_state.v0[i] != right.m_state.v0[i]) || (left.m_state.v1[i] != right.m_state.v1[i])
+						|| (left.m_state.mul0[i] != right.m_state.mul0[i]) || (left.m_state.mul1[i] != right.m_state.mul1[i]))
+						return false;
+				}
+				for (int i = 0; i < (Bits / 64); ++i)
+				{
+					if (left.m_hash[i] != right.m_hash[i])
+						return false;
+				}
+				return true;
+			}
+			friend constexpr bool operator!=(const HighwayHash &left, const HighwayHash &right)
+			{
+				return !(left == right);
+			}
+
+		private:
+			constexpr void addDataImpl(Span<const Byte> data);
+			CONSTEXPR_CPP17_CHOCOBO1_HASH void addRemainder();
+
+			static constexpr int BLOCK_SIZE = 32;
+
+			State m_state = {};
+			uint64_t m_key[4] = {};
+			uint64_t m_hash[Bits / 64] = {};
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
+	};
+
+
+	//
+	template <int Bits>
+	constexpr HighwayHash<Bits>::HighwayHash(const Span<const Byte> key)
+	{
+		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert(((Bits == 64) || (Bits == 128) || (Bits == 256)), "Unsupported digest size");
+		assert(key.size() == 32);
+
+		for (int i = 0; i < 4; ++i)
+			m_key[i] = load64(key.data() + (i * 8));
+
+		reset();
+	}
+
+	template <int Bits>
+	constexpr void HighwayHash<Bits>::reset()
+	{
+		m_buffer.clear();
+
+		const uint64_t init0[4] = {0xdbe6d5d5fe4cce2f, 0xa4093822299f31d0, 0x13198a2e03707344, 0x243f6a8885a308d3};
+		const uint64_t init1[4] = {0x3bd39e10cb0ef593, 0xc0acf169b5f18a8c, 0xbe5466cf34e90c6c, 0x452821e638d01377};
+		for (int i = 0; i < 4; ++i)
+		{
+			m_state.mul0[i] = init0[i];
+			m_state.mul1[i] = init1[i];
+			m_state.v0[i] = init0[i] ^ m_key[i];
+			m_state.v1[i] = init1[i] ^ rotl(m_key[i], 32);
+		}
+
+		for (uint64_t &h : m_hash)
+			h = 0;
+	}
+
+	template <int Bits>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH HighwayHash<Bits>& HighwayHash<Bits>::finalize()
+	{
+		if (!m_buffer.empty())
+			addRemainder();
+		m_buffer.clear();
+
+		const int rounds = (Bits == 64) ? 4 : ((Bits == 128) ? 6 : 10);
+		for (int i = 0; i < rounds; ++i)
+			permuteAndUpdate(m_state);
+
+		const State &s = m_state;
+		if (Bits == 64)
+		{
+			m_hash[0] = s.v0[0] + s.v1[0] + s.mul0[0] + s.mul1[0];
+		}
+		else if (Bits == 128)
+		{
+			m_hash[0] = s.v0[0] + s.mul0[0] + s.v1[2] + s.mul1[2];
+			m_hash[1] = s.v0[1] + s.mul0[1] + s.v1[3] + s.mul1[3];
+		}
+		else
+		{
+			uint64_t hash[4] = {};
+			modularReduction((s.v1[1] + s.mul1[1]), (s.v1[0] + s.mul1[0]), (s.v0[1] + s.mul0[1]), (s.v0[0] + s.mul0[0]), hash[1], hash[0]);
+			modularReduction((s.v1[3] + s.mul1[3]), (s.v1[2] + s.mul1[2]), (s.v0[3] + s.mul0[3]), (s.v0[2] + s.mul0[2]), hash[3], hash[2]);
+			for (int i = 0; i < (Bits / 64); ++i)
+				m_hash[i] = hash[i];
+		}
+
+		return (*this);
+	}
+
+	template <int Bits>
+	std::string HighwayHash<Bits>::toString() const
+	{
+		const auto digest = toArray();
+		std::string ret;
+		ret.resize(2 * digest.size());
+
+		auto *retPtr = &ret.front();
+		for (const auto c : digest)
+		{
+			const Byte upper = ror<Byte>(c, 4);
+			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
+
+			const Byte lower = c & 0xf;
+			*(retPtr++) = static_cast<char>((lower < 10) ? (lower + '0') : (lower - 10 + 'a'));
+		}
+
+		return ret;
+	}
+
+	template <int Bits>
+	std::vector<typename HighwayHash<Bits>::Byte> HighwayHash<Bits>::toVector() const
+	{
+		const auto digest = toArray();
+		return {digest.begin(), digest.end()};
+	}
+
+	template <int Bits>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH typename HighwayHash<Bits>::ResultArrayType HighwayHash<Bits>::toArray() const
+	{
+		// each 64-bit word in big endian, same as `SipHash`
+		ResultArrayType ret {};
+		auto *retPtr = ret.data();
+		for (const uint64_t h : m_hash)
+		{
+			for (int j = 7; j >= 0; --j)
+				*(retPtr++) = ror<Byte>(h, (j * 8));
+		}
+		return ret;
+	}
+
+	template <int Bits>
+	template <typename T>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH HighwayHash<Bits>::operator T() const noexcept
+	{
+		static_assert(std::is_unsigned<T>::value, "");
+
+		const auto digest = toArray();
+		T ret = 0;
+		for (int i = 0, iMax = static_cast<int>(std::min(sizeof(T), digest.size())); i < iMax; ++i)
+		{
+			ret <<= 8;
+			ret |= digest[i];
+		}
+		return ret;
+	}
+
+	template <int Bits>
+	constexpr HighwayHash<Bits>& HighwayHash<Bits>::addData(const Span<const Byte> inData)
+	{
+		Span<const Byte> data = inData;
+
+		if (!m_buffer.empty())
+		{
+			const size_t len = std::min<size_t>((BLOCK_SIZE - m_buffer.size()), data.size());  // try fill to BLOCK_SIZE bytes
+			m_buffer.push_back(data.begin(), (data.begin() + len));
+
+			if (m_buffer.size() < BLOCK_SIZE)  // still doesn't fill the buffer
+				return (*this);
+
+			addDataImpl({m_buffer.data(), m_buffer.size()});
+			m_buffer.clear();
+
+			data = data.subspan(len);
+		}
+
+		const size_t dataSize = data.size();
+		if (dataSize < BLOCK_SIZE)
+		{
+			m_buffer = {data.begin(), data.end()};
+			return (*this);
+		}
+
+		const size_t len = dataSize - (dataSize % BLOCK_SIZE);  // align on BLOCK_SIZE bytes
+		addDataImpl(data.first(len));
+
+		if (len < dataSize)  // didn't consume all data
+			m_buffer = {(data.begin() + len), data.end()};
+
+		return (*this);
+	}
+
+	template <int Bits>
+	constexpr HighwayHash<Bits>& HighwayHash<Bits>::addData(const void *ptr, const std::size_t length)
+	{
+		// Span::size_type = std::size_t
+		return addData({static_cast<const Byte*>(ptr), length});
+	}
+
+	template <int Bits>
+	template <std::size_t N>
+	constexpr HighwayHash<Bits>& HighwayHash<Bits>::addData(const Byte (&array)[N])
+	{
+		return addData({array, N});
+	}
+
+	template <int Bits>
+	template <typename T, std::size_t N>
+	HighwayHash<Bits>& HighwayHash<Bits>::addData(const T (&array)[N])
+	{
+		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
+	}
+
+	template <int Bits>
+	template <typename T>
+	HighwayHash<Bits>& HighwayHash<Bits>::addData(const Span<T> inSpan)
+	{
+		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
+	}
+
+	template <int Bits>
+	constexpr void HighwayHash<Bits>::addDataImpl(const Span<const Byte> data)
+	{
+		assert((data.size() % BLOCK_SIZE) == 0);
+
+		const std::size_t packets = static_cast<std::size_t>(data.size() / BLOCK_SIZE);
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+		if (!__builtin_is_constant_evaluated() && (packets >= 2) && hasAvx2())
+		{
+			updatePacketsAvx2(m_state, data.data(), packets);
+			return;
+		}
+#endif
+
+		updatePackets(m_state, data.data(), packets);
+	}
+
+	template <int Bits>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH void HighwayHash<Bits>::addRemainder()
+	{
+		// the last 1 to 31 bytes, with the length mixed into the state first
+		const uint64_t size = m_buffer.size();
+		for (int i = 0; i < 4; ++i)
+		{
+			m_state.v0[i] += (size << 32) + size;
+
+			const auto half0 = static_cast<uint32_t>(m_state.v1[i]);
+			const auto half1 = static_cast<uint32_t>(m_state.v1[i] >> 32);
+			m_state.v1[i] = rotl(half0, static_cast<unsigned int>(size)) | (static_cast<uint64_t>(rotl(half1, static_cast<unsigned int>(size))) << 32);
+		}
+
+		const std::size_t sizeMod4 = size & 3;
+		const std::size_t wholeWords = size & ~static_cast<uint64_t>(3);
+		Byte packet[BLOCK_SIZE] = {};
+		for (std::size_t i = 0; i < wholeWords; ++i)
+			packet[i] = m_buffer[static_cast<IndexType>(i)];
+
+		if ((size & 16) != 0)
+		{
+			// the last 4 bytes, overlapping the whole words if needed
+			for (std::size_t i = 0; i < 4; ++i)
+				packet[28 + i] = m_buffer[static_cast<IndexType>(wholeWords + i + sizeMod4 - 4)];
+		}
+		else if (sizeMod4 > 0)
+		{
+			packet[16] = m_buffer[static_cast<IndexType>(wholeWords)];
+			packet[17] = m_buffer[static_cast<IndexType>(wholeWords + (sizeMod4 >> 1))];
+			packet[18] = m_buffer[static_cast<IndexType>(wholeWords + sizeMod4 - 1)];
+		}
+
+		updatePackets(m_state, packet, 1);
+	}
+}
+}
+
+	using HighwayHash64 = Hash::HIGHWAYHASH_NS::HighwayHash<64>;
+	using HighwayHash128 = Hash::HIGHWAYHASH_NS::HighwayHash<128>;
+	using HighwayHash256 = Hash::HIGHWAYHASH_NS::HighwayHash<256>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::HIGHWAYHASH_NS::HighwayHash<64>;
+	extern template class Hash::HIGHWAYHASH_NS::HighwayHash<128>;
+	extern template class Hash::HIGHWAYHASH_NS::HighwayHash<256>;
+#endif
+}
+
+namespace std
+{
+	template <int Bits>
+	struct hash<Chocobo1::Hash::HIGHWAYHASH_NS::HighwayHash<Bits>>
+	{
+		CONSTEXPR_CPP17_CHOCOBO1_HASH size_t operator()(const Chocobo1::Hash::HIGHWAYHASH_NS::HighwayHash<Bits> &hash) const noexcept
+		{
+			return hash;
+		}
+	};
+}
+
+#endif  // CHOCOBO1_HIGHWAYHASH_H
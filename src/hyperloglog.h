@@ -0,0 +1,666 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_HYPERLOGLOG_H
+#define CHOCOBO1_HYPERLOGLOG_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
+// AVX2 kernel, chosen at run time when the CPU supports them
+// define `USE_X86_SIMD_CHOCOBO1_HASH` to 0 to always use the portable code
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#if (defined(__x86_64__) || defined(_M_X64))
+#if defined(__has_builtin)
+#if (__has_builtin(__builtin_is_constant_evaluated) && __has_builtin(__builtin_cpu_supports))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#elif (defined(_MSC_VER) && (_MSC_VER >= 1925))
+#define USE_X86_SIMD_CHOCOBO1_HASH 1
+#endif
+#endif
+#endif
+#ifndef USE_X86_SIMD_CHOCOBO1_HASH
+#define USE_X86_SIMD_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2_CHOCOBO1_HASH
+#else
+#define TARGET_AVX2_CHOCOBO1_HASH __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+#endif
+
+// with the prebuilt library, kernels are defined there only
+#ifndef INLINE_KERNEL_CHOCOBO1_HASH
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+#define INLINE_KERNEL_CHOCOBO1_HASH
+#else
+#define INLINE_KERNEL_CHOCOBO1_HASH inline
+#endif
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// HyperLogLog<SipHash>(SipHash(key), precision = 14);  // 2^precision registers, precision 4 to 18
+	// HyperLogLog<FNV64_1a>(FNV64_1a()).addAll(keys).estimate();
+	// HyperLogLog<SipHash>::load(data, SipHash(key));  // from `serialize()`
+
+	// Distinct count estimation, the standard error is about `1.04 / sqrt(2^precision)` (0.81% for 14).
+	// Keys are hashed once with the hasher (first 8 bytes of the digest), `addHash()` takes such values directly.
+	// Small sketches keep a sorted list of (25-bit index, rank) pairs like HLL++ and are exact up to thousands
+	// of keys, they switch to 8-bit registers once the list would be larger.
+	// Estimates use Ertl's improved estimator ("New cardinality estimation algorithms for HyperLogLog sketches"),
+	// which needs no empirical bias correction tables.
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace HyperLogLog_NS
+{
+	using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+	template <typename T, std::size_t Extent = std::dynamic_extent>
+	using Span = std::span<T, Extent>;
+#else
+	template <typename T, std::size_t Extent = gsl::dynamic_extent>
+	using Span = gsl::span<T, Extent>;
+#endif
+
+	static constexpr int SPARSE_PRECISION = 25;
+	static constexpr int SPARSE_RANK_BITS = 6;
+	static constexpr uint32_t FORMAT_VERSION = 1;
+
+	inline int countLeadingZeros(const uint64_t value)
+	{
+		assert(value != 0);
+#if (defined(__GNUC__) || defined(__clang__))
+		return __builtin_clzll(value);
+#else
+		int count = 0;
+		for (uint64_t mask = (uint64_t(1) << 63); (value & mask) == 0; mask >>= 1)
+			++count;
+		return count;
+#endif
+	}
+
+	// rank of the bits after the index: position of the first 1 bit, `64 - precision + 1` when there is none
+	inline int rank(const uint64_t hash, const int precision)
+	{
+		const uint64_t rest = hash << precision;
+		return (rest == 0) ? (64 - precision + 1) : (countLeadingZeros(rest) + 1);
+	}
+
+	inline uint32_t encodeSparse(const uint64_t hash)
+	{
+		const auto index = static_cast<uint32_t>(hash >> (64 - SPARSE_PRECISION));
+		return ((index << SPARSE_RANK_BITS) | static_cast<uint32_t>(rank(hash, SPARSE_PRECISION)));
+	}
+
+	// register index & rank at `precision` of a sparse entry
+	inline void decodeSparse(const uint32_t entry, const int precision, uint32_t &index, Byte &value)
+	{
+		const int extraBits = SPARSE_PRECISION - precision;
+		const uint32_t sparseIndex = entry >> SPARSE_RANK_BITS;
+		const uint32_t extra = sparseIndex & ((uint32_t(1) << extraBits) - 1);
+
+		index = sparseIndex >> extraBits;
+		value = (extra != 0)
+			? static_cast<Byte>(countLeadingZeros(static_cast<uint64_t>(extra) << (64 - extraBits)) + 1)
+			: static_cast<Byte>(extraBits + static_cast<int>(entry & ((1 << SPARSE_RANK_BITS) - 1)));
+	}
+
+	inline double sigma(double x)
+	{
+		if (x == 1)
+			return std::numeric_limits<double>::infinity();
+
+		double y = 1;
+		double z = x;
+		double zPrev = 0;
+		do
+		{
+			x *= x;
+			zPrev = z;
+			z += (x * y);
+			y += y;
+		}
+		while (z != zPrev);
+		return z;
+	}
+
+	inline double tau(double x)
+	{
+		if ((x == 0) || (x == 1))
+			return 0;
+
+		double y = 1;
+		double z = 1 - x;
+		double zPrev = 0;
+		do
+		{
+			x = std::sqrt(x);
+			zPrev = z;
+			y *= 0.5;
+			z -= ((1 - x) * (1 - x) * y);
+		}
+		while (z != zPrev);
+		return (z / 3);
+	}
+
+	// `histogram[k]`: number of registers holding k, for k in [0, q + 1]
+	inline double estimateFromHistogram(const std::vector<uint64_t> &histogram, const double m)
+	{
+		const std::size_t q = histogram.size() - 2;
+
+		double z = m * tau(1 - (static_cast<double>(histogram[q + 1]) / m));
+		for (std::size_t k = q; k >= 1; --k)
+			z = 0.5 * (z + static_cast<double>(histogram[k]));
+		z += (m * sigma(static_cast<double>(histogram[0]) / m));
+
+		const double alpha = 1 / (2 * std::log(2.0));
+		return (alpha * m * m / z);
+	}
+
+	inline void maxRegistersPortable(Byte *dst, const Byte *src, const std::size_t size)
+	{
+		// fixed size chunks through a local copy, so the compiler vectorizes without aliasing checks
+		std::size_t i = 0;
+		for (; (i + 64) <= size; i += 64)
+		{
+			Byte chunk[64];
+			for (std::size_t j = 0; j < 64; ++j)
+				chunk[j] = std::max(dst[i + j], src[i + j]);
+			std::copy(chunk, (chunk + 64), (dst + i));
+		}
+		for (; i < size; ++i)
+			dst[i] = std::max(dst[i], src[i]);
+	}
+
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+#if ((USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1) && !defined(BUILD_LIBRARY_CHOCOBO1_HASH))
+	bool hasAvx2();
+	TARGET_AVX2_CHOCOBO1_HASH
+	void maxRegistersAvx2(Byte *dst, const Byte *src, std::size_t size);
+#else
+	INLINE_KERNEL_CHOCOBO1_HASH bool hasAvx2()
+	{
+		static const bool ret = []() -> bool
+		{
+#ifdef _MSC_VER
+			int info[4] = {};
+			__cpuid(info, 1);
+			const bool osAvx = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 0x6) == 0x6);
+			__cpuidex(info, 7, 0);
+			return osAvx && ((info[1] & (1 << 5)) != 0);
+#else
+			__builtin_cpu_init();
+			return (__builtin_cpu_supports("avx2") != 0);
+#endif
+		}();
+		return ret;
+	}
+
+	// 128 registers per iteration, `vpmaxub` on four independent vectors
+	TARGET_AVX2_CHOCOBO1_HASH
+	INLINE_KERNEL_CHOCOBO1_HASH void maxRegistersAvx2(Byte *dst, const Byte *src, const std::size_t size)
+	{
+		std::size_t i = 0;
+		for (; (i + 128) <= size; i += 128)
+		{
+			for (std::size_t j = 0; j < 128; j += 32)
+			{
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i + j));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + j));
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + j), _mm256_max_epu8(a, b));
+			}
+		}
+		maxRegistersPortable((dst + i), (src + i), (size - i));
+	}
+#endif
+#endif
+
+	inline void maxRegisters(Byte *dst, const Byte *src, const std::size_t size)
+	{
+#if (USE_X86_SIMD_CHOCOBO1_HASH == 1)
+		if (hasAvx2())
+		{
+			maxRegistersAvx2(dst, src, size);
+			return;
+		}
+#endif
+		maxRegistersPortable(dst, src, size);
+	}
+
+	inline void writeVarint(std::vector<Byte> &out, uint32_t value)
+	{
+		while (value >= 0x80)
+		{
+			out.emplace_back(static_cast<Byte>(value | 0x80));
+			value >>= 7;
+		}
+		out.emplace_back(static_cast<Byte>(value));
+	}
+
+	inline bool readVarint(const Span<const Byte> data, std::size_t &pos, uint32_t &value)
+	{
+		value = 0;
+		for (int shift = 0; shift < 35; shift += 7)
+		{
+			if (pos >= static_cast<std::size_t>(data.size()))
+				return false;
+			const Byte byte = data[pos++];
+			value |= (static_cast<uint32_t>(byte & 0x7F) << shift);
+			if ((byte & 0x80) == 0)
+				return true;
+		}
+		return false;
+	}
+
+
+	template <typename H>
+	class HyperLogLog
+	{
+		public:
+			using Byte = HyperLogLog_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename U, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<U, Extent>;
+#else
+			template <typename U, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<U, Extent>;
+#endif
+
+			static constexpr int MIN_PRECISION = 4;
+			static constexpr int MAX_PRECISION = 18;
+
+			explicit HyperLogLog(const H &prototype, int precision = 14);
+
+			static HyperLogLog load(Span<const Byte> data, const H &prototype);
+
+			bool isValid() const;  // `false` for bad precision or data
+			bool isSparse() const;
+
+			HyperLogLog& clear();
+			HyperLogLog& add(const void *ptr, std::size_t length);
+			template <typename Key>
+			HyperLogLog& add(const Key &key);  // containers with `data()` & `size()`
+			template <typename Keys>
+			HyperLogLog& addAll(const Keys &keys);
+			HyperLogLog& addHash(uint64_t hash);
+
+			bool merge(const HyperLogLog &other);  // union, both must have the same precision
+
+			uint64_t estimate() const;
+			int precision() const;
+
+			// sparse: varint delta coded entries, dense: 6-bit packed registers
+			std::vector<Byte> serialize() const;
+
+		private:
+			std::size_t registerCount() const;
+			std::size_t sparseLimit() const;
+
+			std::vector<uint32_t> sparseEntries() const;  // sorted, pending ones included
+			void flushPending();
+			void toDense();
+			void addSparse(const std::vector<uint32_t> &entries);
+
+			H m_prototype;
+			int m_precision = 0;
+			std::vector<uint32_t> m_sparse;  // sorted by index, one entry per index
+			std::vector<uint32_t> m_pending;  // unsorted new entries
+			std::vector<Byte> m_registers;  // empty while sparse
+	};
+
+
+	//
+	template <typename H>
+	HyperLogLog<H>::HyperLogLog(const H &prototype, const int precision)
+		: m_prototype(prototype)
+		, m_precision(((precision >= MIN_PRECISION) && (precision <= MAX_PRECISION)) ? precision : 0)
+	{
+	}
+
+	template <typename H>
+	HyperLogLog<H> HyperLogLog<H>::load(const Span<const Byte> data, const H &prototype)
+	{
+		if ((data.size() < 8) || (data[0] != 'C') || (data[1] != 'H') || (data[2] != 'L') || (data[3] != 'L')
+			|| (data[4] != FORMAT_VERSION) || (data[6] > 1) || (data[7] != 0))
+			return HyperLogLog(prototype, 0);
+
+		HyperLogLog hll(prototype, data[5]);
+		if (!hll.isValid())
+			return hll;
+
+		if (data[6] == 0)
+		{
+			std::size_t pos = 8;
+			uint32_t count = 0;
+			if (!readVarint(data, pos, count) || (count > hll.sparseLimit()))
+				return HyperLogLog(prototype, 0);
+
+			hll.m_sparse.reserve(count);
+			uint32_t entry = 0;
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				uint32_t delta = 0;
+				if (!readVarint(data, pos, delta) || ((i > 0) && ((delta >> SPARSE_RANK_BITS) == 0))
+					|| (delta > (std::numeric_limits<uint32_t>::max() - entry)))
+					return HyperLogLog(prototype, 0);
+
+				entry += delta;
+				const uint32_t value = entry & ((1 << SPARSE_RANK_BITS) - 1);
+				if ((entry >= (uint32_t(1) << (SPARSE_PRECISION + SPARSE_RANK_BITS))) || (value < 1) || (value > (64 - SPARSE_PRECISION + 1)))
+					return HyperLogLog(prototype, 0);
+				hll.m_sparse.emplace_back(entry);
+			}
+			if (pos != static_cast<std::size_t>(data.size()))
+				return HyperLogLog(prototype, 0);
+		}
+		else
+		{
+			const std::size_t size = hll.registerCount();
+			if (static_cast<std::size_t>(data.size()) != (8 + (size / 4 * 3)))
+				return HyperLogLog(prototype, 0);
+
+			hll.m_registers.resize(size);
+			const Byte *ptr = data.data() + 8;
+			for (std::size_t i = 0; i < size; i += 4, ptr += 3)
+			{
+				const uint32_t packed = ptr[0] | (static_cast<uint32_t>(ptr[1]) << 8) | (static_cast<uint32_t>(ptr[2]) << 16);
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					const auto value = static_cast<Byte>((packed >> (6 * j)) & 0x3F);
+					if (value > (64 - hll.m_precision + 1))
+						return HyperLogLog(prototype, 0);
+					hll.m_registers[i + j] = value;
+				}
+			}
+		}
+		return hll;
+	}
+
+	template <typename H>
+	bool HyperLogLog<H>::isValid() const
+	{
+		return (m_precision > 0);
+	}
+
+	template <typename H>
+	bool HyperLogLog<H>::isSparse() const
+	{
+		return m_registers.empty();
+	}
+
+	template <typename H>
+	std::size_t HyperLogLog<H>::registerCount() const
+	{
+		return (std::size_t(1) << m_precision);
+	}
+
+	template <typename H>
+	std::size_t HyperLogLog<H>::sparseLimit() const
+	{
+		// beyond this the 4-byte entries take more space than the registers
+		return (registerCount() / 4);
+	}
+
+	template <typename H>
+	HyperLogLog<H>& HyperLogLog<H>::clear()
+	{
+		m_sparse.clear();
+		m_pending.clear();
+		m_registers.clear();
+		return (*this);
+	}
+
+	template <typename H>
+	HyperLogLog<H>& HyperLogLog<H>::add(const void *ptr, const std::size_t length)
+	{
+		H hasher = m_prototype;
+		const auto digest = hasher.addData(ptr, length).finalize().toArray();
+		static_assert((std::tuple_size<typename std::remove_const<decltype(digest)>::type>::value >= 8), "The digest should be at least 8 bytes");
+
+		uint64_t hash = 0;
+		for (int i = 0; i < 8; ++i)
+			hash |= (static_cast<uint64_t>(digest[i]) << (8 * i));
+		return addHash(hash);
+	}
+
+	template <typename H>
+	template <typename Key>
+	HyperLogLog<H>& HyperLogLog<H>::add(const Key &key)
+	{
+		return add(key.data(), (key.size() * sizeof(*key.data())));
+	}
+
+	template <typename H>
+	template <typename Keys>
+	HyperLogLog<H>& HyperLogLog<H>::addAll(const Keys &keys)
+	{
+		for (const auto &key : keys)
+			add(key);
+		return (*this);
+	}
+
+	template <typename H>
+	HyperLogLog<H>& HyperLogLog<H>::addHash(const uint64_t hash)
+	{
+		assert(isValid());
+
+		if (isSparse())
+		{
+			m_pending.emplace_back(encodeSparse(hash));
+			if (m_pending.size() >= std::max<std::size_t>((sparseLimit() / 4), 16))
+				flushPending();
+			return (*this);
+		}
+
+		Byte &reg = m_registers[hash >> (64 - m_precision)];
+		reg = std::max(reg, static_cast<Byte>(rank(hash, m_precision)));
+		return (*this);
+	}
+
+	template <typename H>
+	std::vector<uint32_t> HyperLogLog<H>::sparseEntries() const
+	{
+		std::vector<uint32_t> pending = m_pending;
+		std::sort(pending.begin(), pending.end());
+
+		std::vector<uint32_t> merged;
+		merged.reserve(m_sparse.size() + pending.size());
+		std::merge(m_sparse.begin(), m_sparse.end(), pending.begin(), pending.end(), std::back_inserter(merged));
+
+		// same index: keep the highest rank, which sorts last
+		std::size_t size = 0;
+		for (std::size_t i = 0; i < merged.size(); ++i)
+		{
+			if ((size > 0) && ((merged[size - 1] >> SPARSE_RANK_BITS) == (merged[i] >> SPARSE_RANK_BITS)))
+				--size;
+			merged[size++] = merged[i];
+		}
+		merged.resize(size);
+		return merged;
+	}
+
+	template <typename H>
+	void HyperLogLog<H>::flushPending()
+	{
+		m_sparse = sparseEntries();
+		m_pending.clear();
+		if (m_sparse.size() > sparseLimit())
+			toDense();
+	}
+
+	template <typename H>
+	void HyperLogLog<H>::toDense()
+	{
+		std::vector<uint32_t> entries = sparseEntries();
+		m_sparse.clear();
+		m_sparse.shrink_to_fit();
+		m_pending.clear();
+		m_pending.shrink_to_fit();
+
+		m_registers.assign(registerCount(), 0);
+		addSparse(entries);
+	}
+
+	template <typename H>
+	void HyperLogLog<H>::addSparse(const std::vector<uint32_t> &entries)
+	{
+		for (const uint32_t entry : entries)
+		{
+			uint32_t index = 0;
+			Byte value = 0;
+			decodeSparse(entry, m_precision, index, value);
+			m_registers[index] = std::max(m_registers[index], value);
+		}
+	}
+
+	template <typename H>
+	bool HyperLogLog<H>::merge(const HyperLogLog &other)
+	{
+		if (!isValid() || (other.m_precision != m_precision))
+			return false;
+		if (&other == this)
+			return true;
+
+		if (!other.isSparse())
+		{
+			if (isSparse())
+				toDense();
+			maxRegisters(m_registers.data(), other.m_registers.data(), m_registers.size());
+		}
+		else if (!isSparse())
+		{
+			addSparse(other.m_sparse);
+			addSparse(other.m_pending);
+		}
+		else
+		{
+			m_pending.insert(m_pending.end(), other.m_sparse.begin(), other.m_sparse.end());
+			m_pending.insert(m_pending.end(), other.m_pending.begin(), other.m_pending.end());
+			flushPending();
+		}
+		return true;
+	}
+
+	template <typename H>
+	uint64_t HyperLogLog<H>::estimate() const
+	{
+		assert(isValid());
+
+		if (isSparse())
+		{
+			// a precision 25 sketch with most registers empty
+			const std::vector<uint32_t> entries = sparseEntries();
+			std::vector<uint64_t> histogram((64 - SPARSE_PRECISION + 2), 0);
+			histogram[0] = (uint64_t(1) << SPARSE_PRECISION) - entries.size();
+			for (const uint32_t entry : entries)
+				++histogram[entry & ((1 << SPARSE_RANK_BITS) - 1)];
+			return static_cast<uint64_t>(std::llround(estimateFromHistogram(histogram, static_cast<double>(uint64_t(1) << SPARSE_PRECISION))));
+		}
+
+		std::vector<uint64_t> histogram((64 - m_precision + 2), 0);
+		for (const Byte reg : m_registers)
+			++histogram[reg];
+		return static_cast<uint64_t>(std::llround(estimateFromHistogram(histogram, static_cast<double>(registerCount()))));
+	}
+
+	template <typename H>
+	int HyperLogLog<H>::precision() const
+	{
+		return m_precision;
+	}
+
+	template <typename H>
+	std::vector<Byte> HyperLogLog<H>::serialize() const
+	{
+		assert(isValid());
+
+		std::vector<Byte> out = {'C', 'H', 'L', 'L', static_cast<Byte>(FORMAT_VERSION), static_cast<Byte>(m_precision)
+			, static_cast<Byte>(isSparse() ? 0 : 1), 0};
+
+		if (isSparse())
+		{
+			const std::vector<uint32_t> entries = sparseEntries();
+			writeVarint(out, static_cast<uint32_t>(entries.size()));
+
+			uint32_t previous = 0;
+			for (const uint32_t entry : entries)
+			{
+				writeVarint(out, (entry - previous));
+				previous = entry;
+			}
+			return out;
+		}
+
+		out.reserve(8 + (m_registers.size() / 4 * 3));
+		for (std::size_t i = 0; i < m_registers.size(); i += 4)
+		{
+			const uint32_t packed = m_registers[i] | (static_cast<uint32_t>(m_registers[i + 1]) << 6)
+				| (static_cast<uint32_t>(m_registers[i + 2]) << 12) | (static_cast<uint32_t>(m_registers[i + 3]) << 18);
+			out.emplace_back(static_cast<Byte>(packed));
+			out.emplace_back(static_cast<Byte>(packed >> 8));
+			out.emplace_back(static_cast<Byte>(packed >> 16));
+		}
+		return out;
+	}
+}
+}
+	template <typename H>
+	using HyperLogLog = Hash::HyperLogLog_NS::HyperLogLog<H>;
+}
+
+#endif  // CHOCOBO1_HYPERLOGLOG_H
@@ -0,0 +1,117 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+// Explicit instantiations & SIMD kernels for the prebuilt library.
+// Users of the library compile with `USE_EXTERN_TEMPLATE_CHOCOBO1_HASH=1` so their translation units
+// only see `extern template` declarations for these.
+
+#define BUILD_LIBRARY_CHOCOBO1_HASH
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 1
+#endif
+
+#include "../adler32.h"
+#include "../argon2.h"
+#include "../crc.h"
+#include "../crc_32.h"
+#include "../cshake.h"
+#include "../fletcher.h"
+#include "../fnv.h"
+#include "../highwayhash.h"
+#include "../hyperloglog.h"
+#include "../sha3.h"
+#include "../siphash.h"
+#include "../tiger.h"
+#include "../tuple_hash.h"
+
+
+namespace Chocobo1
+{
+	// argon2.h
+	template class Hash::Argon2_NS::Argon2<0>;
+	template class Hash::Argon2_NS::Argon2<1>;
+	template class Hash::Argon2_NS::Argon2<2>;
+
+	// crc.h
+	template class Hash::CRC_NS::Crc<8, 0x07, 0x00, false, false, 0x00>;
+	template class Hash::CRC_NS::Crc<8, 0x31, 0x00, true, true, 0x00>;
+	template class Hash::CRC_NS::Crc<8, 0x2F, 0xFF, false, false, 0xFF>;
+	template class Hash::CRC_NS::Crc<8, 0xA7, 0x00, true, true, 0x00>;
+	template class Hash::CRC_NS::Crc<16, 0x8005, 0x0000, true, true, 0x0000>;
+	template class Hash::CRC_NS::Crc<16, 0x1021, 0x0000, true, true, 0x0000>;
+	template class Hash::CRC_NS::Crc<16, 0x1021, 0xFFFF, false, false, 0x0000>;
+	template class Hash::CRC_NS::Crc<16, 0x1021, 0x0000, false, false, 0x0000>;
+	template class Hash::CRC_NS::Crc<16, 0x1021, 0xFFFF, true, true, 0xFFFF>;
+	template class Hash::CRC_NS::Crc<16, 0x8005, 0xFFFF, true, true, 0x0000>;
+	template class Hash::CRC_NS::Crc<16, 0x8005, 0xFFFF, true, true, 0xFFFF>;
+	template class Hash::CRC_NS::Crc<24, 0x864CFB, 0xB704CE, false, false, 0x000000>;
+	template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 16>;
+	template class Hash::CRC_NS::Crc<32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 16>;
+	template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, 16>;
+	template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000, 16>;
+	template class Hash::CRC_NS::Crc<32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF, 16>;
+	template class Hash::CRC_NS::Crc<64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000, 16>;
+	template class Hash::CRC_NS::Crc<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+	template class Hash::CRC_NS::Crc<64, 0x000000000000001B, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+	template class Hash::CRC_NS::Crc<64, 0xAD93D23594C93659, 0xFFFFFFFFFFFFFFFF, true, true, 0xFFFFFFFFFFFFFFFF, 16>;
+#if (USE_X86_CLMUL_CHOCOBO1_HASH == 1)
+	template void Hash::CRC_NS::clmulReflected64<0x42F0E1EBA9EA3693>(uint64_t, const uint8_t *&, std::size_t &, uint8_t (&)[16]);
+	template void Hash::CRC_NS::clmulReflected64<0x000000000000001B>(uint64_t, const uint8_t *&, std::size_t &, uint8_t (&)[16]);
+	template void Hash::CRC_NS::clmulReflected64<0xAD93D23594C93659>(uint64_t, const uint8_t *&, std::size_t &, uint8_t (&)[16]);
+#endif
+
+	// cshake.h
+	template class Hash::SHA3_NS::Keccak<(1344 / 8), 0x04>;
+	template class Hash::SHA3_NS::Keccak<(1088 / 8), 0x04>;
+	template class Hash::CShake_NS::CShake<SHAKE_128, Hash::SHA3_NS::Keccak<(1344 / 8), 0x04>, (1344 / 8)>;
+	template class Hash::CShake_NS::CShake<SHAKE_256, Hash::SHA3_NS::Keccak<(1088 / 8), 0x04>, (1088 / 8)>;
+
+	// fletcher.h
+	template class Hash::FLETCHER_NS::Fletcher<16>;
+	template class Hash::FLETCHER_NS::Fletcher<32>;
+	template class Hash::FLETCHER_NS::Fletcher<64>;
+
+	// fnv.h
+	template class Hash::FNVHASH_NS::FNVHash<uint32_t, 0>;
+	template class Hash::FNVHASH_NS::FNVHash<uint32_t, 1>;
+	template class Hash::FNVHASH_NS::FNVHash<uint32_t, 2>;
+	template class Hash::FNVHASH_NS::FNVHash<uint64_t, 0>;
+	template class Hash::FNVHASH_NS::FNVHash<uint64_t, 1>;
+	template class Hash::FNVHASH_NS::FNVHash<uint64_t, 2>;
+
+	// highwayhash.h
+	template class Hash::HIGHWAYHASH_NS::HighwayHash<64>;
+	template class Hash::HIGHWAYHASH_NS::HighwayHash<128>;
+	template class Hash::HIGHWAYHASH_NS::HighwayHash<256>;
+
+	// sha3.h
+	template class Hash::SHA3_NS::Keccak<(1152 / 8), 0x06, (224 / 8)>;
+	template class Hash::SHA3_NS::Keccak<(1088 / 8), 0x06, (256 / 8)>;
+	template class Hash::SHA3_NS::Keccak<(832 / 8), 0x06, (384 / 8)>;
+	template class Hash::SHA3_NS::Keccak<(576 / 8), 0x06, (512 / 8)>;
+	template class Hash::SHA3_NS::Keccak<(1344 / 8), 0x1F>;
+	template class Hash::SHA3_NS::Keccak<(1088 / 8), 0x1F>;
+
+	// siphash.h
+	template class Hash::SIPHASH_NS::SipHash<2, 4>;
+
+	// tiger.h
+	template class Hash::Tiger_NS::Tiger<1, 128>;
+	template class Hash::Tiger_NS::Tiger<1, 160>;
+	template class Hash::Tiger_NS::Tiger<1, 192>;
+	template class Hash::Tiger_NS::Tiger<2, 128>;
+	template class Hash::Tiger_NS::Tiger<2, 160>;
+	template class Hash::Tiger_NS::Tiger<2, 192>;
+
+	// tuple_hash.h
+	template class Hash::TupleHash_NS::TupleHash<CSHAKE_128>;
+	template class Hash::TupleHash_NS::TupleHash<CSHAKE_256>;
+}
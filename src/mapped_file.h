@@ -0,0 +1,233 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_MAPPED_FILE_H
+#define CHOCOBO1_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+#if (defined(__unix__) || defined(__APPLE__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define USE_MMAP_CHOCOBO1_HASH 1
+#else
+#define USE_MMAP_CHOCOBO1_HASH 0
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// MappedFile file("disk.img");  file.isValid();  file.data();  // read-only view of the whole file
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace MappedFile_NS
+{
+	class MappedFile
+	{
+		// The file is mmaped on POSIX systems, elsewhere it is read into memory.
+		// The view stays valid until the object is destroyed, changes to the file afterwards are undefined.
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			MappedFile() = default;
+			explicit MappedFile(const std::string &path);
+			MappedFile(MappedFile &&other) noexcept;
+			MappedFile& operator=(MappedFile &&other) noexcept;
+			~MappedFile();
+
+			MappedFile(const MappedFile &) = delete;
+			MappedFile& operator=(const MappedFile &) = delete;
+
+			bool isValid() const;  // `false` when the file could not be opened or read
+			bool isMapped() const;
+
+			Span<const Byte> data() const;
+			std::size_t size() const;
+
+		private:
+			void close();
+
+			const Byte *m_data = nullptr;
+			std::size_t m_size = 0;
+			bool m_valid = false;
+			bool m_mapped = false;
+			std::vector<Byte> m_buffer;  // fallback when mmap is unavailable
+	};
+
+
+	//
+	inline MappedFile::MappedFile(const std::string &path)
+	{
+#if (USE_MMAP_CHOCOBO1_HASH == 1)
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd >= 0)
+		{
+			struct stat status {};
+			if ((::fstat(fd, &status) == 0) && S_ISREG(status.st_mode))
+			{
+				m_size = static_cast<std::size_t>(status.st_size);
+				if (m_size == 0)
+				{
+					m_valid = true;
+				}
+				else
+				{
+					void *map = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+					if (map != MAP_FAILED)
+					{
+						m_data = static_cast<const Byte *>(map);
+						m_valid = true;
+						m_mapped = true;
+					}
+				}
+			}
+			::close(fd);
+			if (m_valid)
+				return;
+			m_size = 0;
+		}
+#endif
+
+		// special files & systems without mmap
+		std::ifstream inStream(path, (std::ios_base::in | std::ios_base::binary));
+		if (!inStream)
+			return;
+
+		const std::size_t bufSize = 1024 * 1024;
+		while (inStream.good())
+		{
+			const std::size_t oldSize = m_buffer.size();
+			m_buffer.resize(oldSize + bufSize);
+			inStream.read(reinterpret_cast<char *>(m_buffer.data() + oldSize), static_cast<std::streamsize>(bufSize));
+			m_buffer.resize(oldSize + static_cast<std::size_t>(inStream.gcount()));
+		}
+		if (inStream.bad())
+		{
+			m_buffer.clear();
+			return;
+		}
+
+		m_data = m_buffer.data();
+		m_size = m_buffer.size();
+		m_valid = true;
+	}
+
+	inline MappedFile::MappedFile(MappedFile &&other) noexcept
+	{
+		(*this) = std::move(other);
+	}
+
+	inline MappedFile& MappedFile::operator=(MappedFile &&other) noexcept
+	{
+		if (this == &other)
+			return (*this);
+
+		close();
+		const bool ownBuffer = !other.m_mapped && (other.m_data != nullptr);
+		m_buffer = std::move(other.m_buffer);
+		m_data = ownBuffer ? m_buffer.data() : other.m_data;
+		m_size = other.m_size;
+		m_valid = other.m_valid;
+		m_mapped = other.m_mapped;
+
+		other.m_data = nullptr;
+		other.m_size = 0;
+		other.m_valid = false;
+		other.m_mapped = false;
+		other.m_buffer.clear();
+		return (*this);
+	}
+
+	inline MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+	inline bool MappedFile::isValid() const
+	{
+		return m_valid;
+	}
+
+	inline bool MappedFile::isMapped() const
+	{
+		return m_mapped;
+	}
+
+	inline MappedFile::Span<const MappedFile::Byte> MappedFile::data() const
+	{
+		return {m_data, m_size};
+	}
+
+	inline std::size_t MappedFile::size() const
+	{
+		return m_size;
+	}
+
+	inline void MappedFile::close()
+	{
+#if (USE_MMAP_CHOCOBO1_HASH == 1)
+		if (m_mapped)
+			::munmap(const_cast<Byte *>(m_data), m_size);
+#endif
+		m_data = nullptr;
+		m_size = 0;
+		m_valid = false;
+		m_mapped = false;
+		m_buffer.clear();
+	}
+}
+}
+	using MappedFile = Hash::MappedFile_NS::MappedFile;
+}
+
+#endif  // CHOCOBO1_MAPPED_FILE_H
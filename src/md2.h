@@ -44,6 +44,8 @@ namespace Chocobo1
 {
 	// Use these!!
 	// MD2();
+
+	// "abc"_md2;  // C++20, digest as `MD2::ResultArrayType` computed at compile time
 }
 
 
@@ -61,15 +63,6 @@ namespace Hash
 #endif
 #endif
 
-#ifndef INLINE_CLASS_VARIABLE_CHOCOBO1_HASH
-#if __cplusplus >= 201703L
-#define INLINE_CLASS_VARIABLE_CHOCOBO1_HASH constexpr static
-#define HAS_INLINE_CLASS_VARIABLE_CHOCOBO1_HASH
-#else
-#define INLINE_CLASS_VARIABLE_CHOCOBO1_HASH const
-#endif
-#endif
-
 #if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
 	using IndexType = std::size_t;
 #else
@@ -166,8 +159,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -185,7 +182,35 @@ namespace Hash
 
 namespace MD2_NS
 {
-	class MD2
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr uint8_t piSubst[256] =
+		{
+			 41,  46,  67, 201, 162, 216, 124,   1,  61,  54,  84, 161, 236, 240,   6,  19,
+			 98, 167,   5, 243, 192, 199, 115, 140, 152, 147,  43, 217, 188,  76, 130, 202,
+			 30, 155,  87,  60, 253, 212, 224,  22, 103,  66, 111,  24, 138,  23, 229,  18,
+			190,  78, 196, 214, 218, 158, 222,  73, 160, 251, 245, 142, 187,  47, 238, 122,
+			169, 104, 121, 145,  21, 178,   7,  63, 148, 194,  16, 137,  11,  34,  95,  33,
+			128, 127,  93, 154,  90, 144,  50,  39,  53,  62, 204, 231, 191, 247, 151,   3,
+			255,  25,  48, 179,  72, 165, 181, 209, 215,  94, 146,  42, 172,  86, 170, 198,
+			 79, 184,  56, 210, 150, 164, 125, 182, 118, 252, 107, 226, 156, 116,   4, 241,
+			 69, 157, 112,  89, 100, 113, 135,  32, 134,  91, 207, 101, 230,  45, 168,   2,
+			 27,  96,  37, 173, 174, 176, 185, 246,  28,  70,  97, 105,  52,  64, 126,  15,
+			 85,  71, 163,  35, 221,  81, 175,  58, 195,  92, 249, 206, 186, 197, 234,  38,
+			 44,  83,  13, 110, 133,  40, 132,   9, 211, 223, 205, 244,  65, 129,  77,  82,
+			106, 220,  55, 200, 108, 193, 171, 250,  36, 225, 123,   8,  12, 189, 177,  74,
+			120, 136, 149, 139, 227,  99, 232, 109, 233, 203, 213, 254,  59,   0,  29,  57,
+			242, 239, 183,  14, 102,  88, 208, 228, 166, 119, 114, 248, 235, 117,  75,  10,
+			 49,  68,  80, 180, 143, 237,  31,  26, 219, 153, 141,  51, 159,  17, 131,  20
+		};
+	};
+
+	template <typename T>
+	constexpr uint8_t Tables<T>::piSubst[256];
+
+
+	class MD2 : private Tables<>
 	{
 		// https://tools.ietf.org/html/rfc1319
 
@@ -241,31 +266,10 @@ namespace MD2_NS
 
 			static constexpr int BLOCK_SIZE = 16;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
-
 			std::array<Byte, 48> m_x {};
 			std::array<Byte, 16> m_checksum {};
 			Byte m_checksumL = 0;
-
-			INLINE_CLASS_VARIABLE_CHOCOBO1_HASH Byte piSubst[256] =
-			{
-				 41,  46,  67, 201, 162, 216, 124,   1,  61,  54,  84, 161, 236, 240,   6,  19,
-				 98, 167,   5, 243, 192, 199, 115, 140, 152, 147,  43, 217, 188,  76, 130, 202,
-				 30, 155,  87,  60, 253, 212, 224,  22, 103,  66, 111,  24, 138,  23, 229,  18,
-				190,  78, 196, 214, 218, 158, 222,  73, 160, 251, 245, 142, 187,  47, 238, 122,
-				169, 104, 121, 145,  21, 178,   7,  63, 148, 194,  16, 137,  11,  34,  95,  33,
-				128, 127,  93, 154,  90, 144,  50,  39,  53,  62, 204, 231, 191, 247, 151,   3,
-				255,  25,  48, 179,  72, 165, 181, 209, 215,  94, 146,  42, 172,  86, 170, 198,
-				 79, 184,  56, 210, 150, 164, 125, 182, 118, 252, 107, 226, 156, 116,   4, 241,
-				 69, 157, 112,  89, 100, 113, 135,  32, 134,  91, 207, 101, 230,  45, 168,   2,
-				 27,  96,  37, 173, 174, 176, 185, 246,  28,  70,  97, 105,  52,  64, 126,  15,
-				 85,  71, 163,  35, 221,  81, 175,  58, 195,  92, 249, 206, 186, 197, 234,  38,
-				 44,  83,  13, 110, 133,  40, 132,   9, 211, 223, 205, 244,  65, 129,  77,  82,
-				106, 220,  55, 200, 108, 193, 171, 250,  36, 225, 123,   8,  12, 189, 177,  74,
-				120, 136, 149, 139, 227,  99, 232, 109, 233, 203, 213, 254,  59,   0,  29,  57,
-				242, 239, 183,  14, 102,  88, 208, 228, 166, 119, 114, 248, 235, 117,  75,  10,
-				 49,  68,  80, 180, 143, 237,  31,  26, 219, 153, 141,  51, 159,  17, 131,  20
-			};
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 	};
 
 
@@ -273,6 +277,7 @@ namespace MD2_NS
 	constexpr MD2::MD2()
 	{
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(MD2) < (sizeof(m_buffer) + sizeof(m_x) + sizeof(m_checksum) + sizeof(m_checksumL) + alignof(MD2))), "Constant tables should not be stored in each instance");
 		reset();
 	}
 
@@ -444,6 +449,41 @@ namespace MD2_NS
 	using MD2 = Hash::MD2_NS::MD2;
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval MD2::ResultArrayType operator""_md2(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<MD2>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <>
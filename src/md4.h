@@ -45,6 +45,8 @@ namespace Chocobo1
 {
 	// Use these!!
 	// MD4();
+
+	// "abc"_md4;  // C++20, digest as `MD4::ResultArrayType` computed at compile time
 }
 
 
@@ -158,8 +160,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -245,10 +251,9 @@ namespace MD4_NS
 
 			static constexpr int BLOCK_SIZE = 64;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
-			uint64_t m_sizeCounter = 0;
-
 			uint32_t m_state[4] = {};
+			uint64_t m_sizeCounter = 0;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 	};
 
 
@@ -300,19 +305,23 @@ namespace MD4_NS
 
 	CONSTEXPR_CPP17_CHOCOBO1_HASH inline MD4& MD4::finalize()
 	{
-		m_sizeCounter += m_buffer.size();
+		const uint64_t sizeCounterBits = ((m_sizeCounter + m_buffer.size()) * 8);
+		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
+		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 
 		// append 1 bit
 		m_buffer.fill(1 << 7);
 
-		// append paddings
-		const auto len = static_cast<int>(((2 * BLOCK_SIZE) - (m_buffer.size() + 8)) % BLOCK_SIZE);
-		m_buffer.fill(0, (len + 8));
+		// append paddings, the size field must fit in the last block
+		if (m_buffer.size() > (BLOCK_SIZE - 8))
+		{
+			m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
+			addDataImpl({m_buffer.data(), m_buffer.size()});
+			m_buffer.clear();
+		}
+		m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
 
 		// append size in bits
-		const uint64_t sizeCounterBits = m_sizeCounter * 8;
-		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
-		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 		for (int i = 0; i < 4; ++i)
 		{
 			m_buffer[m_buffer.size() - 8 + i] = ror<Byte>(sizeCounterBitsL, (8 * i));
@@ -532,6 +541,41 @@ namespace MD4_NS
 	using MD4 = Hash::MD4_NS::MD4;
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval MD4::ResultArrayType operator""_md4(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<MD4>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <>
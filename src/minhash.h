@@ -0,0 +1,635 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_MINHASH_H
+#define CHOCOBO1_MINHASH_H
+
+#include "fnv.h"
+#include "siphash.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// shingles(text, 5);  // 5 consecutive whitespace separated tokens, `ShingleMode::Bytes` for byte k-grams
+	// ShingleHasher<SipHash>(key).hash(shingles);  // 64-bit values, SipHash runs several shingles per SIMD lane
+	// ShingleHasher<FNV64_1a>(FNV64_1a()).hash(shingles);  // any hasher with a digest of 8 bytes or more
+	// MinHash(128).signature(hashes);  // one permutation MinHash
+	// MinHash::similarity(signatureA, signatureB);  // estimated Jaccard similarity
+	// simHash(hashes);  hammingDistance(simHashA, simHashB);
+	// LshIndex(32, 4);  // 32 bands of 4 rows, for 128-value signatures
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace MinHash_NS
+{
+	using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+	template <typename T, std::size_t Extent = std::dynamic_extent>
+	using Span = std::span<T, Extent>;
+#else
+	template <typename T, std::size_t Extent = gsl::dynamic_extent>
+	using Span = gsl::span<T, Extent>;
+#endif
+
+	inline uint64_t loadLE64(const Byte *ptr)
+	{
+		uint64_t value = 0;
+		for (int i = 0; i < 8; ++i)
+			value |= (static_cast<uint64_t>(ptr[i]) << (8 * i));
+		return value;
+	}
+
+	// the last `length` (< 8) bytes, through a fixed size copy so both loads stay single instructions
+	inline uint64_t loadPartialLE64(const Byte *ptr, const std::size_t length)
+	{
+		Byte buffer[8] = {};
+		std::memcpy(buffer, ptr, length);
+		return loadLE64(buffer);
+	}
+
+	inline constexpr uint64_t rotl64(const uint64_t x, const int s)
+	{
+		return ((x << s) | (x >> (64 - s)));
+	}
+
+	// SplitMix64 finalizer, picks the donor bins of the densification
+	inline uint64_t mix64(uint64_t x)
+	{
+		x ^= (x >> 30);
+		x *= 0xBF58476D1CE4E5B9;
+		x ^= (x >> 27);
+		x *= 0x94D049BB133111EB;
+		return (x ^ (x >> 31));
+	}
+
+	// `(value * range) >> 32` on the high half, avoids a division
+	inline uint32_t reduce(const uint64_t value, const uint32_t range)
+	{
+		return static_cast<uint32_t>(((value >> 32) * range) >> 32);
+	}
+
+
+	enum class ShingleMode
+	{
+		Tokens,  // `width` consecutive tokens separated by ASCII whitespace, the separators in between included
+		Bytes  // every `width` byte window
+	};
+
+	// Pieces of `text` (no copies), texts shorter than one shingle give a single shingle of everything
+	inline std::vector<Span<const Byte>> shingles(const Span<const Byte> text, const int width, const ShingleMode mode = ShingleMode::Tokens)
+	{
+		assert(width > 0);
+
+		std::vector<Span<const Byte>> ret;
+		const Byte *data = text.data();
+		const auto size = static_cast<std::size_t>(text.size());
+		const auto count = static_cast<std::size_t>(width);
+
+		if (mode == ShingleMode::Bytes)
+		{
+			if (size == 0)
+				return ret;
+			if (size <= count)
+				return {text};
+
+			ret.reserve(size - count + 1);
+			for (std::size_t i = 0; (i + count) <= size; ++i)
+				ret.emplace_back((data + i), count);
+			return ret;
+		}
+
+		const auto isSpace = [](const Byte c) -> bool
+		{
+			return ((c == ' ') || ((c >= '\t') && (c <= '\r')));
+		};
+
+		// [begin, end) of every token
+		std::vector<std::pair<std::size_t, std::size_t>> tokens;
+		for (std::size_t i = 0; i < size;)
+		{
+			while ((i < size) && isSpace(data[i]))
+				++i;
+			const std::size_t begin = i;
+			while ((i < size) && !isSpace(data[i]))
+				++i;
+			if (i > begin)
+				tokens.emplace_back(begin, i);
+		}
+
+		if (tokens.empty())
+			return ret;
+		if (tokens.size() <= count)
+			return {{(data + tokens.front().first), (tokens.back().second - tokens.front().first)}};
+
+		ret.reserve(tokens.size() - count + 1);
+		for (std::size_t i = 0; (i + count) <= tokens.size(); ++i)
+		{
+			const std::size_t begin = tokens[i].first;
+			ret.emplace_back((data + begin), (tokens[i + count - 1].second - begin));
+		}
+		return ret;
+	}
+
+	inline std::vector<Span<const Byte>> shingles(const void *text, const std::size_t length, const int width, const ShingleMode mode = ShingleMode::Tokens)
+	{
+		return shingles({static_cast<const Byte *>(text), length}, width, mode);
+	}
+
+
+	template <typename H, int Lanes = 4>
+	class ShingleHasher
+	{
+		// 64-bit value of each shingle: the first 8 bytes of the digest, big endian (same as `operator uint64_t()`)
+
+		public:
+			using Byte = MinHash_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			explicit ShingleHasher(const H &prototype)
+				: m_prototype(prototype)
+			{
+			}
+
+			void hash(const Span<const Span<const Byte>> shingles, const Span<uint64_t> results) const
+			{
+				assert(results.size() >= shingles.size());
+				for (std::size_t i = 0; i < static_cast<std::size_t>(shingles.size()); ++i)
+				{
+					H hasher = m_prototype;
+					const auto digest = hasher.addData(shingles[i]).finalize().toArray();
+					static_assert((std::tuple_size<typename std::remove_const<decltype(digest)>::type>::value >= 8), "The digest should be at least 8 bytes");
+					uint64_t value = 0;
+					for (std::size_t j = 0; j < 8; ++j)
+						value = (value << 8) | digest[j];
+					results[i] = value;
+				}
+			}
+
+			std::vector<uint64_t> hash(const Span<const Span<const Byte>> shingles) const
+			{
+				std::vector<uint64_t> ret(shingles.size());
+				hash(shingles, ret);
+				return ret;
+			}
+
+		private:
+			H m_prototype;
+	};
+
+	template <int C, int D, int Lanes>
+	class ShingleHasher<SIPHASH_NS::SipHash<C, D>, Lanes>
+	{
+		// Same values as `uint64_t(SipHash(key).addData(shingle).finalize())`.
+		// Shingles are grouped by their number of 8-byte words, each group is hashed `Lanes` at a time in lockstep
+		// with the state kept as structure-of-arrays, so the lane loops map onto SIMD registers.
+		// Short shingles are mostly bound by memory, 4 lanes were the best default across SSE2/AVX2 builds.
+
+		public:
+			using Byte = MinHash_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			explicit ShingleHasher(const Span<const Byte> key)
+			{
+				assert(key.size() == 16);
+				m_key[0] = loadLE64(key.data());
+				m_key[1] = loadLE64(key.data() + 8);
+			}
+
+			void hash(Span<const Span<const Byte>> shingles, Span<uint64_t> results) const;
+
+			std::vector<uint64_t> hash(const Span<const Span<const Byte>> shingles) const
+			{
+				std::vector<uint64_t> ret(shingles.size());
+				hash(shingles, ret);
+				return ret;
+			}
+
+		private:
+			static void sipRounds(uint64_t (&v)[4][Lanes], int rounds);
+
+			uint64_t m_key[2] = {};
+	};
+
+
+	class MinHash
+	{
+		// One permutation hashing (Li, Owen & Zhang) with optimal densification (Shrivastava, ICML 2017):
+		// the high bits of each value pick one of `k` bins & the bin keeps its minimum value,
+		// an empty bin copies the bin chosen by a fixed probe sequence until it finds a filled one.
+		// Signatures are comparable when built with the same `k` & the same shingle hashing.
+
+		public:
+			using Byte = MinHash_NS::Byte;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			static constexpr uint64_t EMPTY = std::numeric_limits<uint64_t>::max();  // every value of a signature without input
+
+			explicit MinHash(int k);
+
+			int size() const;
+
+			std::vector<uint64_t> signature(Span<const uint64_t> hashes) const;
+			void signature(Span<const uint64_t> hashes, Span<uint64_t> result) const;
+
+			// fraction of equal values
+			static double similarity(Span<const uint64_t> left, Span<const uint64_t> right);
+
+		private:
+			uint32_t m_k = 0;
+	};
+
+
+	// 64-bit SimHash (Charikar): bit i is set when more values have it set than cleared
+	inline uint64_t simHash(const Span<const uint64_t> hashes)
+	{
+		// counters per bit, updated for all 64 bits at once so the loop vectorizes
+		int64_t counts[64] = {};
+		for (const uint64_t hash : hashes)
+		{
+			for (int bit = 0; bit < 64; ++bit)
+				counts[bit] += static_cast<int64_t>((hash >> bit) & 1);
+		}
+
+		const auto half = static_cast<int64_t>(hashes.size());
+		uint64_t ret = 0;
+		for (int bit = 0; bit < 64; ++bit)
+			ret |= (static_cast<uint64_t>((2 * counts[bit]) > half) << bit);
+		return ret;
+	}
+
+	// weighted variant, e.g. by term frequency
+	inline uint64_t simHash(const Span<const uint64_t> hashes, const Span<const double> weights)
+	{
+		assert(weights.size() >= hashes.size());
+
+		double counts[64] = {};
+		for (std::size_t i = 0; i < static_cast<std::size_t>(hashes.size()); ++i)
+		{
+			for (int bit = 0; bit < 64; ++bit)
+				counts[bit] += (((hashes[i] >> bit) & 1) != 0) ? weights[i] : -weights[i];
+		}
+
+		uint64_t ret = 0;
+		for (int bit = 0; bit < 64; ++bit)
+			ret |= (static_cast<uint64_t>(counts[bit] > 0) << bit);
+		return ret;
+	}
+
+	inline int hammingDistance(uint64_t left, const uint64_t right)
+	{
+		left ^= right;
+		int count = 0;
+		for (; left != 0; left &= (left - 1))
+			++count;
+		return count;
+	}
+
+
+	class LshIndex
+	{
+		// Locality sensitive hashing over MinHash signatures: the signature is cut into `bands` bands of `rows` values,
+		// documents sharing any band become candidates of each other. Pairs with Jaccard similarity `s` are found with
+		// probability `1 - (1 - s^rows)^bands`, the threshold sits around `(1 / bands)^(1 / rows)`.
+		// Band keys are `FNV64_1a` of the band values.
+
+		public:
+			using Byte = MinHash_NS::Byte;
+			using Id = uint64_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			LshIndex(int bands, int rows);
+
+			LshIndex& insert(Id id, Span<const uint64_t> signature);
+			std::vector<Id> candidates(Span<const uint64_t> signature) const;  // sorted, without duplicates
+
+			std::size_t size() const;  // documents inserted
+			void clear();
+
+		private:
+			uint64_t bandKey(Span<const uint64_t> signature, int band) const;
+
+			int m_bands = 0;
+			int m_rows = 0;
+			std::size_t m_size = 0;
+			std::vector<std::unordered_map<uint64_t, std::vector<Id>>> m_buckets;
+	};
+
+
+	//
+	template <int C, int D, int Lanes>
+	void ShingleHasher<SIPHASH_NS::SipHash<C, D>, Lanes>::sipRounds(uint64_t (&v)[4][Lanes], const int rounds)
+	{
+		for (int r = 0; r < rounds; ++r)
+		{
+			for (int l = 0; l < Lanes; ++l)
+			{
+				v[0][l] += v[1][l];
+				v[1][l] = rotl64(v[1][l], 13) ^ v[0][l];
+				v[0][l] = rotl64(v[0][l], 32);
+				v[2][l] += v[3][l];
+				v[3][l] = rotl64(v[3][l], 16) ^ v[2][l];
+				v[0][l] += v[3][l];
+				v[3][l] = rotl64(v[3][l], 21) ^ v[0][l];
+				v[2][l] += v[1][l];
+				v[1][l] = rotl64(v[1][l], 17) ^ v[2][l];
+				v[2][l] = rotl64(v[2][l], 32);
+			}
+		}
+	}
+
+	template <int C, int D, int Lanes>
+	void ShingleHasher<SIPHASH_NS::SipHash<C, D>, Lanes>::hash(const Span<const Span<const Byte>> shingles, const Span<uint64_t> results) const
+	{
+		static_assert((Lanes > 0), "Template parameter value invalid: Lanes");
+		assert(results.size() >= shingles.size());
+
+		// counting sort by words, a word count of `n` covers lengths [8 * (n - 1), 8 * n)
+		const auto wordCount = [&shingles](const std::size_t i) -> std::size_t
+		{
+			return ((static_cast<std::size_t>(shingles[i].size()) / 8) + 1);
+		};
+
+		const auto total = static_cast<std::size_t>(shingles.size());
+		std::vector<std::size_t> offsets(2, 0);
+		for (std::size_t i = 0; i < total; ++i)
+		{
+			const std::size_t words = wordCount(i);
+			if (words >= offsets.size())
+				offsets.resize((words + 1), 0);
+			++offsets[words];
+		}
+		for (std::size_t words = 1, sum = 0; words < offsets.size(); ++words)
+		{
+			const std::size_t count = offsets[words];
+			offsets[words] = sum;
+			sum += count;
+		}
+
+		std::vector<std::size_t> order(total);
+		for (std::size_t i = 0; i < total; ++i)
+			order[offsets[wordCount(i)]++] = i;
+
+		for (std::size_t begin = 0, count = 0; begin < total; begin += count)
+		{
+			// up to `Lanes` shingles of the same word count
+			const std::size_t words = wordCount(order[begin]);
+			count = std::min<std::size_t>(Lanes, (total - begin));
+			while (wordCount(order[begin + count - 1]) != words)
+				--count;
+
+			uint64_t v[4][Lanes];
+			for (int l = 0; l < Lanes; ++l)
+			{
+				v[0][l] = m_key[0] ^ 0x736f6d6570736575;
+				v[1][l] = m_key[1] ^ 0x646f72616e646f6d;
+				v[2][l] = m_key[0] ^ 0x6c7967656e657261;
+				v[3][l] = m_key[1] ^ 0x7465646279746573;
+			}
+
+			for (std::size_t w = 0; w < words; ++w)
+			{
+				uint64_t m[Lanes] = {};
+				for (std::size_t l = 0; l < count; ++l)
+				{
+					const Span<const Byte> shingle = shingles[order[begin + l]];
+					const auto size = static_cast<std::size_t>(shingle.size());
+					m[l] = ((w + 1) < words)
+						? loadLE64(shingle.data() + (8 * w))
+						: (loadPartialLE64((shingle.data() + (8 * w)), (size % 8)) | (static_cast<uint64_t>(size) << 56));
+				}
+
+				for (int l = 0; l < Lanes; ++l)
+					v[3][l] ^= m[l];
+				sipRounds(v, C);
+				for (int l = 0; l < Lanes; ++l)
+					v[0][l] ^= m[l];
+			}
+
+			for (int l = 0; l < Lanes; ++l)
+				v[2][l] ^= 0xFF;
+			sipRounds(v, D);
+
+			for (std::size_t l = 0; l < count; ++l)
+				results[order[begin + l]] = v[0][l] ^ v[1][l] ^ v[2][l] ^ v[3][l];
+		}
+	}
+
+
+	//
+	inline MinHash::MinHash(const int k)
+		: m_k(static_cast<uint32_t>(std::max(k, 1)))
+	{
+	}
+
+	inline int MinHash::size() const
+	{
+		return static_cast<int>(m_k);
+	}
+
+	inline std::vector<uint64_t> MinHash::signature(const Span<const uint64_t> hashes) const
+	{
+		std::vector<uint64_t> ret(m_k);
+		signature(hashes, ret);
+		return ret;
+	}
+
+	inline void MinHash::signature(const Span<const uint64_t> hashes, const Span<uint64_t> result) const
+	{
+		assert(static_cast<std::size_t>(result.size()) >= m_k);
+
+		uint64_t *bins = result.data();
+		const uint64_t empty = EMPTY;
+		std::fill(bins, (bins + m_k), empty);
+		for (const uint64_t hash : hashes)
+		{
+			uint64_t &bin = bins[reduce(hash, m_k)];
+			bin = std::min(bin, hash);
+		}
+
+		if (hashes.empty())
+			return;
+
+		// densification: empty bins borrow from the first filled bin of their own probe sequence,
+		// donors are taken from the sparse result, not from bins filled in this loop
+		std::vector<bool> filled(m_k);
+		for (uint32_t i = 0; i < m_k; ++i)
+			filled[i] = (bins[i] != EMPTY);
+
+		for (uint32_t i = 0; i < m_k; ++i)
+		{
+			if (filled[i])
+				continue;
+
+			for (uint64_t attempt = 1;; ++attempt)
+			{
+				const uint32_t donor = reduce(mix64((static_cast<uint64_t>(i) << 32) + attempt), m_k);
+				if (filled[donor])
+				{
+					bins[i] = bins[donor];
+					break;
+				}
+			}
+		}
+	}
+
+	inline double MinHash::similarity(const Span<const uint64_t> left, const Span<const uint64_t> right)
+	{
+		assert(left.size() == right.size());
+		if (left.empty())
+			return 0;
+
+		std::size_t same = 0;
+		for (std::size_t i = 0; i < static_cast<std::size_t>(left.size()); ++i)
+			same += (left[i] == right[i]) ? 1 : 0;
+		return (static_cast<double>(same) / static_cast<double>(left.size()));
+	}
+
+
+	//
+	inline LshIndex::LshIndex(const int bands, const int rows)
+		: m_bands(std::max(bands, 1))
+		, m_rows(std::max(rows, 1))
+		, m_buckets(static_cast<std::size_t>(m_bands))
+	{
+	}
+
+	inline uint64_t LshIndex::bandKey(const Span<const uint64_t> signature, const int band) const
+	{
+		FNV64_1a hasher;
+		for (int r = 0; r < m_rows; ++r)
+		{
+			const uint64_t value = signature[static_cast<std::size_t>((band * m_rows) + r)];
+			Byte bytes[8] = {};
+			for (int i = 0; i < 8; ++i)
+				bytes[i] = static_cast<Byte>(value >> (8 * i));
+			hasher.addData(bytes);
+		}
+		return hasher.finalize();
+	}
+
+	inline LshIndex& LshIndex::insert(const Id id, const Span<const uint64_t> signature)
+	{
+		assert(static_cast<std::size_t>(signature.size()) >= static_cast<std::size_t>(m_bands * m_rows));
+
+		for (int band = 0; band < m_bands; ++band)
+			m_buckets[static_cast<std::size_t>(band)][bandKey(signature, band)].emplace_back(id);
+		++m_size;
+		return (*this);
+	}
+
+	inline std::vector<LshIndex::Id> LshIndex::candidates(const Span<const uint64_t> signature) const
+	{
+		assert(static_cast<std::size_t>(signature.size()) >= static_cast<std::size_t>(m_bands * m_rows));
+
+		std::vector<Id> ret;
+		for (int band = 0; band < m_bands; ++band)
+		{
+			const auto &buckets = m_buckets[static_cast<std::size_t>(band)];
+			const auto iter = buckets.find(bandKey(signature, band));
+			if (iter != buckets.end())
+				ret.insert(ret.end(), iter->second.begin(), iter->second.end());
+		}
+
+		std::sort(ret.begin(), ret.end());
+		ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+		return ret;
+	}
+
+	inline std::size_t LshIndex::size() const
+	{
+		return m_size;
+	}
+
+	inline void LshIndex::clear()
+	{
+		for (auto &buckets : m_buckets)
+			buckets.clear();
+		m_size = 0;
+	}
+}
+}
+	using Hash::MinHash_NS::ShingleMode;
+	using Hash::MinHash_NS::shingles;
+	template <typename H, int Lanes = 4>
+	using ShingleHasher = Hash::MinHash_NS::ShingleHasher<H, Lanes>;
+	using Hash::MinHash_NS::MinHash;
+	using Hash::MinHash_NS::simHash;
+	using Hash::MinHash_NS::hammingDistance;
+	using Hash::MinHash_NS::LshIndex;
+}
+
+#endif  // CHOCOBO1_MINHASH_H
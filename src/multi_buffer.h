@@ -0,0 +1,569 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_MULTI_BUFFER_H
+#define CHOCOBO1_MULTI_BUFFER_H
+
+#include "md5.h"
+#include "sha1.h"
+#include "sha2_256.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// MultiBuffer<MD5>::hash();
+	// MultiBuffer<SHA1>::hash();
+	// MultiBuffer<SHA2_256>::hash();
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace MultiBuffer_NS
+{
+	// Each kernel compresses one 64-byte block per lane, all lanes in lockstep.
+	// State is kept as structure-of-arrays so the inner lane loops map onto SIMD registers.
+	template <typename Alg, int Lanes>
+	struct Kernel;
+
+	template <int Lanes>
+	struct Kernel<MD5, Lanes>
+	{
+		// https://tools.ietf.org/html/rfc1321
+
+		static constexpr int STATE_SIZE = 4;
+		static constexpr bool BIG_ENDIAN_LENGTH = false;
+
+		static void init(uint32_t (&state)[STATE_SIZE][Lanes], const int lane)
+		{
+			state[0][lane] = 0x67452301;
+			state[1][lane] = 0xefcdab89;
+			state[2][lane] = 0x98badcfe;
+			state[3][lane] = 0x10325476;
+		}
+
+		static void compress(uint32_t (&state)[STATE_SIZE][Lanes], const uint8_t *const (&blocks)[Lanes])
+		{
+			uint32_t x[16][Lanes];
+			for (int i = 0; i < 16; ++i)
+			{
+				for (int l = 0; l < Lanes; ++l)
+				{
+					const uint8_t *ptr = blocks[l] + (4 * i);
+					x[i][l] = ( (static_cast<uint32_t>(*(ptr + 0)) <<  0)
+							| (static_cast<uint32_t>(*(ptr + 1)) <<  8)
+							| (static_cast<uint32_t>(*(ptr + 2)) << 16)
+							| (static_cast<uint32_t>(*(ptr + 3)) << 24));
+				}
+			}
+
+			using LaneArray = uint32_t[Lanes];
+			const auto f = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
+			{
+				return ((x & (y ^ z)) ^ z);  // alternative
+			};
+			const auto g = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
+			{
+				return (y ^ ((x ^ y) & z));  // alternative
+			};
+			const auto h = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
+			{
+				return (x ^ y ^ z);
+			};
+			const auto ii = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
+			{
+				return (y ^ (x | (~z)));
+			};
+
+			LaneArray a, b, c, d;
+			std::memcpy(a, state[0], sizeof(a));
+			std::memcpy(b, state[1], sizeof(b));
+			std::memcpy(c, state[2], sizeof(c));
+			std::memcpy(d, state[3], sizeof(d));
+
+			const auto round = [&x](LaneArray &a, const LaneArray &b, const LaneArray &c, const LaneArray &d, const auto &func, const unsigned int k, const unsigned int s, const uint32_t t) -> void
+			{
+				for (int l = 0; l < Lanes; ++l)
+					a[l] = b[l] + rotl((a[l] + func(b[l], c[l], d[l]) + x[k][l] + t), s);
+			};
+
+			round(a, b, c, d, f, 0, 7, 0xd76aa478);
+			round(d, a, b, c, f, 1, 12, 0xe8c7b756);
+			round(c, d, a, b, f, 2, 17, 0x242070db);
+			round(b, c, d, a, f, 3, 22, 0xc1bdceee);
+			round(a, b, c, d, f, 4, 7, 0xf57c0faf);
+			round(d, a, b, c, f, 5, 12, 0x4787c62a);
+			round(c, d, a, b, f, 6, 17, 0xa8304613);
+			round(b, c, d, a, f, 7, 22, 0xfd469501);
+			round(a, b, c, d, f, 8, 7, 0x698098d8);
+			round(d, a, b, c, f, 9, 12, 0x8b44f7af);
+			round(c, d, a, b, f, 10, 17, 0xffff5bb1);
+			round(b, c, d, a, f, 11, 22, 0x895cd7be);
+			round(a, b, c, d, f, 12, 7, 0x6b901122);
+			round(d, a, b, c, f, 13, 12, 0xfd987193);
+			round(c, d, a, b, f, 14, 17, 0xa679438e);
+			round(b, c, d, a, f, 15, 22, 0x49b40821);
+
+			round(a, b, c, d, g, 1, 5, 0xf61e2562);
+			round(d, a, b, c, g, 6, 9, 0xc040b340);
+			round(c, d, a, b, g, 11, 14, 0x265e5a51);
+			round(b, c, d, a, g, 0, 20, 0xe9b6c7aa);
+			round(a, b, c, d, g, 5, 5, 0xd62f105d);
+			round(d, a, b, c, g, 10, 9, 0x02441453);
+			round(c, d, a, b, g, 15, 14, 0xd8a1e681);
+			round(b, c, d, a, g, 4, 20, 0xe7d3fbc8);
+			round(a, b, c, d, g, 9, 5, 0x21e1cde6);
+			round(d, a, b, c, g, 14, 9, 0xc33707d6);
+			round(c, d, a, b, g, 3, 14, 0xf4d50d87);
+			round(b, c, d, a, g, 8, 20, 0x455a14ed);
+			round(a, b, c, d, g, 13, 5, 0xa9e3e905);
+			round(d, a, b, c, g, 2, 9, 0xfcefa3f8);
+			round(c, d, a, b, g, 7, 14, 0x676f02d9);
+			round(b, c, d, a, g, 12, 20, 0x8d2a4c8a);
+
+			round(a, b, c, d, h, 5, 4, 0xfffa3942);
+			round(d, a, b, c, h, 8, 11, 0x8771f681);
+			round(c, d, a, b, h, 11, 16, 0x6d9d6122);
+			round(b, c, d, a, h, 14, 23, 0xfde5380c);
+			round(a, b, c, d, h, 1, 4, 0xa4beea44);
+			round(d, a, b, c, h, 4, 11, 0x4bdecfa9);
+			round(c, d, a, b, h, 7, 16, 0xf6bb4b60);
+			round(b, c, d, a, h, 10, 23, 0xbebfbc70);
+			round(a, b, c, d, h, 13, 4, 0x289b7ec6);
+			round(d, a, b, c, h, 0, 11, 0xeaa127fa);
+			round(c, d, a, b, h, 3, 16, 0xd4ef3085);
+			round(b, c, d, a, h, 6, 23, 0x04881d05);
+			round(a, b, c, d, h, 9, 4, 0xd9d4d039);
+			round(d, a, b, c, h, 12, 11, 0xe6db99e5);
+			round(c, d, a, b, h, 15, 16, 0x1fa27cf8);
+			round(b, c, d, a, h, 2, 23, 0xc4ac5665);
+
+			round(a, b, c, d, ii, 0, 6, 0xf4292244);
+			round(d, a, b, c, ii, 7, 10, 0x432aff97);
+			round(c, d, a, b, ii, 14, 15, 0xab9423a7);
+			round(b, c, d, a, ii, 5, 21, 0xfc93a039);
+			round(a, b, c, d, ii, 12, 6, 0x655b59c3);
+			round(d, a, b, c, ii, 3, 10, 0x8f0ccc92);
+			round(c, d, a, b, ii, 10, 15, 0xffeff47d);
+			round(b, c, d, a, ii, 1, 21, 0x85845dd1);
+			round(a, b, c, d, ii, 8, 6, 0x6fa87e4f);
+			round(d, a, b, c, ii, 15, 10, 0xfe2ce6e0);
+			round(c, d, a, b, ii, 6, 15, 0xa3014314);
+			round(b, c, d, a, ii, 13, 21, 0x4e0811a1);
+			round(a, b, c, d, ii, 4, 6, 0xf7537e82);
+			round(d, a, b, c, ii, 11, 10, 0xbd3af235);
+			round(c, d, a, b, ii, 2, 15, 0x2ad7d2bb);
+			round(b, c, d, a, ii, 9, 21, 0xeb86d391);
+
+			for (int l = 0; l < Lanes; ++l)
+			{
+				state[0][l] += a[l];
+				state[1][l] += b[l];
+				state[2][l] += c[l];
+				state[3][l] += d[l];
+			}
+		}
+
+		static MD5::ResultArrayType toArray(const uint32_t (&state)[STATE_SIZE][Lanes], const int lane)
+		{
+			MD5::ResultArrayType ret {};
+			auto *retPtr = ret.data();
+			for (int i = 0; i < STATE_SIZE; ++i)
+			{
+				for (int j = 0; j < 4; ++j)
+					*(retPtr++) = ror<uint8_t>(state[i][lane], (j * 8));
+			}
+			return ret;
+		}
+	};
+
+	template <int Lanes>
+	struct Kernel<SHA1, Lanes>
+	{
+		// https://tools.ietf.org/html/rfc3174
+
+		static constexpr int STATE_SIZE = 5;
+		static constexpr bool BIG_ENDIAN_LENGTH = true;
+
+		static void init(uint32_t (&state)[STATE_SIZE][Lanes], const int lane)
+		{
+			state[0][lane] = 0x67452301;
+			state[1][lane] = 0xEFCDAB89;
+			state[2][lane] = 0x98BADCFE;
+			state[3][lane] = 0x10325476;
+			state[4][lane] = 0xC3D2E1F0;
+		}
+
+		static void compress(uint32_t (&state)[STATE_SIZE][Lanes], const uint8_t *const (&blocks)[Lanes])
+		{
+			uint32_t w[80][Lanes];
+			for (int t = 0; t < 16; ++t)
+			{
+				for (int l = 0; l < Lanes; ++l)
+				{
+					const uint8_t *ptr = blocks[l] + (4 * t);
+					w[t][l] = ( (static_cast<uint32_t>(*(ptr + 0)) << 24)
+							| (static_cast<uint32_t>(*(ptr + 1)) << 16)
+							| (static_cast<uint32_t>(*(ptr + 2)) <<  8)
+							| (static_cast<uint32_t>(*(ptr + 3)) <<  0));
+				}
+			}
+			for (int t = 16; t < 80; ++t)
+			{
+				for (int l = 0; l < Lanes; ++l)
+					w[t][l] = rotl((w[t - 3][l] ^ w[t - 8][l] ^ w[t - 14][l] ^ w[t - 16][l]), 1);
+			}
+
+			using LaneArray = uint32_t[Lanes];
+			const auto f1 = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
+			{
+				return ((x & (y ^ z)) ^ z);  // alternative
+			};
+			const auto f2 = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
+			{
+				return (x ^ y ^ z);
+			};
+			const auto f3 = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
+			{
+				return ((x & y) | (z & (x | y)));
+			};
+
+			LaneArray a, b, c, d, e;
+			std::memcpy(a, state[0], sizeof(a));
+			std::memcpy(b, state[1], sizeof(b));
+			std::memcpy(c, state[2], sizeof(c));
+			std::memcpy(d, state[3], sizeof(d));
+			std::memcpy(e, state[4], sizeof(e));
+
+			const auto round = [&w](const LaneArray &a, LaneArray &b, const LaneArray &c, const LaneArray &d, LaneArray &e, const auto &func, const uint32_t k, const int t) -> void
+			{
+				for (int l = 0; l < Lanes; ++l)
+				{
+					e[l] += rotl(a[l], 5) + func(b[l], c[l], d[l]) + w[t][l] + k;
+					b[l] = rotl(b[l], 30);
+				}
+			};
+			const auto fiveRounds = [&](const auto &func, const uint32_t k, const int t) -> void
+			{
+				round(a, b, c, d, e, func, k, (t + 0));
+				round(e, a, b, c, d, func, k, (t + 1));
+				round(d, e, a, b, c, func, k, (t + 2));
+				round(c, d, e, a, b, func, k, (t + 3));
+				round(b, c, d, e, a, func, k, (t + 4));
+			};
+
+			for (int t = 0; t < 20; t += 5)
+				fiveRounds(f1, 0x5A827999, t);
+			for (int t = 20; t < 40; t += 5)
+				fiveRounds(f2, 0x6ED9EBA1, t);
+			for (int t = 40; t < 60; t += 5)
+				fiveRounds(f3, 0x8F1BBCDC, t);
+			for (int t = 60; t < 80; t += 5)
+				fiveRounds(f2, 0xCA62C1D6, t);
+
+			for (int l = 0; l < Lanes; ++l)
+			{
+				state[0][l] += a[l];
+				state[1][l] += b[l];
+				state[2][l] += c[l];
+				state[3][l] += d[l];
+				state[4][l] += e[l];
+			}
+		}
+
+		static SHA1::ResultArrayType toArray(const uint32_t (&state)[STATE_SIZE][Lanes], const int lane)
+		{
+			SHA1::ResultArrayType ret {};
+			auto *retPtr = ret.data();
+			for (int i = 0; i < STATE_SIZE; ++i)
+			{
+				for (int j = 3; j >= 0; --j)
+					*(retPtr++) = ror<uint8_t>(state[i][lane], (j * 8));
+			}
+			return ret;
+		}
+	};
+
+	template <int Lanes>
+	struct Kernel<SHA2_256, Lanes>
+	{
+		// https://tools.ietf.org/html/rfc6234
+
+		static constexpr int STATE_SIZE = 8;
+		static constexpr bool BIG_ENDIAN_LENGTH = true;
+
+		static void init(uint32_t (&state)[STATE_SIZE][Lanes], const int lane)
+		{
+			state[0][lane] = 0x6a09e667;
+			state[1][lane] = 0xbb67ae85;
+			state[2][lane] = 0x3c6ef372;
+			state[3][lane] = 0xa54ff53a;
+			state[4][lane] = 0x510e527f;
+			state[5][lane] = 0x9b05688c;
+			state[6][lane] = 0x1f83d9ab;
+			state[7][lane] = 0x5be0cd19;
+		}
+
+		static void compress(uint32_t (&state)[STATE_SIZE][Lanes], const uint8_t *const (&blocks)[Lanes])
+		{
+			static constexpr uint32_t kTable[64] =
+			{
+				0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+				0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+				0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+				0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+				0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+				0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+				0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+				0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+			};
+
+			uint32_t w[64][Lanes];
+			for (int t = 0; t < 16; ++t)
+			{
+				for (int l = 0; l < Lanes; ++l)
+				{
+					const uint8_t *ptr = blocks[l] + (4 * t);
+					w[t][l] = ( (static_cast<uint32_t>(*(ptr + 0)) << 24)
+							| (static_cast<uint32_t>(*(ptr + 1)) << 16)
+							| (static_cast<uint32_t>(*(ptr + 2)) <<  8)
+							| (static_cast<uint32_t>(*(ptr + 3)) <<  0));
+				}
+			}
+			for (int t = 16; t < 64; ++t)
+			{
+				for (int l = 0; l < Lanes; ++l)
+				{
+					const uint32_t ssig0 = rotr(w[t - 15][l], 7) ^ rotr(w[t - 15][l], 18) ^ (w[t - 15][l] >> 3);
+					const uint32_t ssig1 = rotr(w[t - 2][l], 17) ^ rotr(w[t - 2][l], 19) ^ (w[t - 2][l] >> 10);
+					w[t][l] = ssig1 + w[t - 7][l] + ssig0 + w[t - 16][l];
+				}
+			}
+
+			using LaneArray = uint32_t[Lanes];
+			LaneArray a, b, c, d, e, f, g, h;
+			std::memcpy(a, state[0], sizeof(a));
+			std::memcpy(b, state[1], sizeof(b));
+			std::memcpy(c, state[2], sizeof(c));
+			std::memcpy(d, state[3], sizeof(d));
+			std::memcpy(e, state[4], sizeof(e));
+			std::memcpy(f, state[5], sizeof(f));
+			std::memcpy(g, state[6], sizeof(g));
+			std::memcpy(h, state[7], sizeof(h));
+
+			const auto round = [&w](const LaneArray &a, const LaneArray &b, const LaneArray &c, LaneArray &d, const LaneArray &e, const LaneArray &f, const LaneArray &g, LaneArray &h, const int t) -> void
+			{
+				for (int l = 0; l < Lanes; ++l)
+				{
+					const uint32_t bsig0 = rotr(a[l], 2) ^ rotr(a[l], 13) ^ rotr(a[l], 22);
+					const uint32_t bsig1 = rotr(e[l], 6) ^ rotr(e[l], 11) ^ rotr(e[l], 25);
+					const uint32_t t1 = h[l] + bsig1 + ((e[l] & (f[l] ^ g[l])) ^ g[l]) + kTable[t] + w[t][l];
+					const uint32_t t2 = bsig0 + ((a[l] & (b[l] | c[l])) | (b[l] & c[l]));
+					d[l] += t1;
+					h[l] = t1 + t2;
+				}
+			};
+			for (int t = 0; t < 64; t += 8)
+			{
+				round(a, b, c, d, e, f, g, h, (t + 0));
+				round(h, a, b, c, d, e, f, g, (t + 1));
+				round(g, h, a, b, c, d, e, f, (t + 2));
+				round(f, g, h, a, b, c, d, e, (t + 3));
+				round(e, f, g, h, a, b, c, d, (t + 4));
+				round(d, e, f, g, h, a, b, c, (t + 5));
+				round(c, d, e, f, g, h, a, b, (t + 6));
+				round(b, c, d, e, f, g, h, a, (t + 7));
+			}
+
+			for (int l = 0; l < Lanes; ++l)
+			{
+				state[0][l] += a[l];
+				state[1][l] += b[l];
+				state[2][l] += c[l];
+				state[3][l] += d[l];
+				state[4][l] += e[l];
+				state[5][l] += f[l];
+				state[6][l] += g[l];
+				state[7][l] += h[l];
+			}
+		}
+
+		static SHA2_256::ResultArrayType toArray(const uint32_t (&state)[STATE_SIZE][Lanes], const int lane)
+		{
+			SHA2_256::ResultArrayType ret {};
+			auto *retPtr = ret.data();
+			for (int i = 0; i < STATE_SIZE; ++i)
+			{
+				for (int j = 3; j >= 0; --j)
+					*(retPtr++) = ror<uint8_t>(state[i][lane], (j * 8));
+			}
+			return ret;
+		}
+	};
+
+
+	template <typename Alg, int Lanes = 8>
+	class MultiBuffer
+	{
+		// Hash many independent messages at once, one message per lane.
+		// Best suited for lots of short inputs where a single stream can't keep the CPU busy.
+
+		public:
+			using Byte = uint8_t;
+			using ResultArrayType = typename Alg::ResultArrayType;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename T, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<T, Extent>;
+#else
+			template <typename T, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<T, Extent>;
+#endif
+
+			static constexpr int LANES = Lanes;
+
+			// `results[i]` receives the digest of `messages[i]`
+			static void hash(Span<const Span<const Byte>> messages, Span<ResultArrayType> results);
+			static std::vector<ResultArrayType> hash(Span<const Span<const Byte>> messages);
+
+		private:
+			using KernelType = Kernel<Alg, Lanes>;
+
+			static constexpr int BLOCK_SIZE = 64;
+	};
+
+
+	//
+	template <typename Alg, int Lanes>
+	void MultiBuffer<Alg, Lanes>::hash(const Span<const Span<const Byte>> messages, const Span<ResultArrayType> results)
+	{
+		static_assert((Lanes > 0), "Template parameter value invalid: Lanes");
+		assert(results.size() >= messages.size());
+
+		struct Lane
+		{
+			bool active = false;
+			size_t message = 0;
+			size_t block = 0;
+			size_t directBlocks = 0;  // blocks read straight from the message
+			size_t totalBlocks = 0;
+			Byte tail[BLOCK_SIZE * 2] = {};  // last partial block + paddings
+		};
+
+		Lane lanes[Lanes];
+		uint32_t state[KernelType::STATE_SIZE][Lanes] = {};
+		const Byte dummyBlock[BLOCK_SIZE] = {};
+		size_t nextMessage = 0;
+
+		// when a lane finishes its message, immediately refill it with the next pending one
+		const auto loadLane = [&](const int l) -> void
+		{
+			Lane &lane = lanes[l];
+			if (nextMessage >= static_cast<size_t>(messages.size()))
+			{
+				lane.active = false;
+				return;
+			}
+
+			const Span<const Byte> message = messages[nextMessage];
+			const size_t messageSize = message.size();
+			const size_t remainder = messageSize % BLOCK_SIZE;
+			const size_t tailBlocks = ((remainder + 1 + 8) > BLOCK_SIZE) ? 2 : 1;
+
+			lane.active = true;
+			lane.message = nextMessage;
+			lane.block = 0;
+			lane.directBlocks = messageSize / BLOCK_SIZE;
+			lane.totalBlocks = lane.directBlocks + tailBlocks;
+
+			std::fill(std::begin(lane.tail), std::end(lane.tail), Byte(0));
+			std::copy((message.begin() + (messageSize - remainder)), message.end(), lane.tail);
+			lane.tail[remainder] = (1 << 7);
+
+			const uint64_t sizeCounterBits = static_cast<uint64_t>(messageSize) * 8;
+			Byte *sizePtr = lane.tail + (tailBlocks * BLOCK_SIZE) - 8;
+			for (int i = 0; i < 8; ++i)
+				sizePtr[i] = ror<Byte>(sizeCounterBits, (8 * (KernelType::BIG_ENDIAN_LENGTH ? (7 - i) : i)));
+
+			KernelType::init(state, l);
+			++nextMessage;
+		};
+
+		for (int l = 0; l < Lanes; ++l)
+			loadLane(l);
+
+		while (true)
+		{
+			const Byte *blocks[Lanes] = {};
+			bool anyActive = false;
+			for (int l = 0; l < Lanes; ++l)
+			{
+				const Lane &lane = lanes[l];
+				if (!lane.active)
+				{
+					// idle lanes chew on a dummy block, their state is thrown away on refill
+					blocks[l] = dummyBlock;
+					continue;
+				}
+
+				anyActive = true;
+				blocks[l] = (lane.block < lane.directBlocks)
+					? (messages[lane.message].data() + (lane.block * BLOCK_SIZE))
+					: (lane.tail + ((lane.block - lane.directBlocks) * BLOCK_SIZE));
+			}
+			if (!anyActive)
+				break;
+
+			KernelType::compress(state, blocks);
+
+			for (int l = 0; l < Lanes; ++l)
+			{
+				Lane &lane = lanes[l];
+				if (!lane.active)
+					continue;
+
+				++lane.block;
+				if (lane.block < lane.totalBlocks)
+					continue;
+
+				results[lane.message] = KernelType::toArray(state, l);
+				loadLane(l);
+			}
+		}
+	}
+
+	template <typename Alg, int Lanes>
+	std::vector<typename MultiBuffer<Alg, Lanes>::ResultArrayType> MultiBuffer<Alg, Lanes>::hash(const Span<const Span<const Byte>> messages)
+	{
+		std::vector<ResultArrayType> ret(messages.size());
+		hash(messages, ret);
+		return ret;
+	}
+}
+}
+
+	template <typename Alg, int Lanes = 8>
+	using MultiBuffer = Hash::MultiBuffer_NS::MultiBuffer<Alg, Lanes>;
+}
+
+#endif  // CHOCOBO1_MULTI_BUFFER_H
@@ -9,77 +9,54 @@
  *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
  */
 
-#include "../blake1_224.h"
-#include "../blake1_256.h"
-#include "../blake1_384.h"
-#include "../blake1_512.h"
-#include "../blake2.h"
-#include "../blake2s.h"
-#include "../crc_32.h"
-#include "../cshake.h"
-#include "../fnv.h"
-#include "../has_160.h"
-#include "../md2.h"
-#include "../md4.h"
-#include "../md5.h"
-#include "../ripemd_128.h"
-#include "../ripemd_160.h"
-#include "../ripemd_256.h"
-#include "../ripemd_320.h"
-#include "../siphash.h"
-#include "../sha1.h"
-#include "../sha2_224.h"
-#include "../sha2_256.h"
-#include "../sha2_384.h"
-#include "../sha2_512.h"
-#include "../sha2_512_224.h"
-#include "../sha2_512_256.h"
-#include "../sha3.h"
-#include "../sm3.h"
-#include "../tiger.h"
+#include "../any_hasher.h"
+#include "../block_list_hash.h"
+#include "../digest_manifest.h"
+#include "../mapped_file.h"
+#include "../multi_buffer.h"
+#include "../tree_digest.h"
 #include "../tuple_hash.h"
-#include "../whirlpool.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define USE_POSIX_STDIN
+#elif defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#define USE_WIN32_STDIN
+#endif
 
-#define ARRAY_LENGTH(a) (static_cast<int>(std::extent<decltype(a)>::value))
 
-
-enum class Hash : int
+enum class Mode : int
 {
-	Blake1_224, Blake1_256, Blake1_384, Blake1_512,
-	Blake2, Blake2s,
-	Crc_32,
-	Cshake_128, Cshake_256,
-	Fnv32_1a, Fnv64_1a,
-	Has160,
-	Md2, Md4, Md5,
-	Ripemd_128, Ripemd_160, Ripemd_256, Ripemd_320,
-	Siphash,
-	Sha1,
-	Sha2_224, Sha2_256, Sha2_384, Sha2_512,
-	Sha2_512_224, Sha2_512_256,
-	Sha3_224, Sha3_256, Sha3_384, Sha3_512,
-	Shake_128, Shake_256,
-	Sm3,
-	Tiger1_128, Tiger1_160, Tiger1_192,
-	Tiger2_128, Tiger2_160, Tiger2_192,
-	Tuple_hash_128, Tuple_hash_256,
-	Whirlpool,
-	Invalid,
+	Files,
+	TreeDigest,
+	TreeDigestWithMode,
 };
 
 
 static void printUsage(const std::string &name);
-static Hash getHash(const std::string &hash);
-static bool runHash(const Hash hash, const int argc, const char *argv[]);
+static bool runHash(const std::string &hashName, const Mode mode, const int argc, const char *argv[]);
+static bool runBlockList(const std::string &option, const int argc, const char *argv[]);
+static bool runManifest(const std::string &option, const int argc, const char *argv[]);
+template <typename Func>
+static void readStdin(const Func &func);
 
 
 int main(const int argc, const char *argv[])
@@ -95,9 +72,41 @@ int main(const int argc, const char *argv[])
 
 	goToFail(argc <= 1);
 
-	const Hash hash = getHash(argv[1]);
+	std::ios_base::sync_with_stdio(false);
+
+	if ((argv[1] == std::string("--s3-etag")) || (argv[1] == std::string("--dropbox-content-hash")))
+	{
+		goToFail(!runBlockList(argv[1], argc, argv));
+		return 0;
+	}
+
+	if ((argv[1] == std::string("--manifest-create")) || (argv[1] == std::string("--manifest-text"))
+		|| (argv[1] == std::string("--manifest-check")))
+	{
+		goToFail(!runManifest(argv[1], argc, argv));
+		return 0;
+	}
+
+	std::vector<const char *> args(argv, (argv + argc));
+	Mode mode = Mode::Files;
+	if (args[1] == std::string("--tree-digest"))
+		mode = Mode::TreeDigest;
+	else if (args[1] == std::string("--tree-digest-mode"))
+		mode = Mode::TreeDigestWithMode;
+
+	if (mode != Mode::Files)
+	{
+#if (USE_STD_FILESYSTEM_CHOCOBO1_HASH == 0)
+		fprintf(stderr, "%s requires a C++17 build (std::filesystem)\n", args[1]);
+		return 1;
+#endif
+		args.erase(args.begin() + 1);
+		if (args.size() == 2)
+			args.insert((args.begin() + 1), "-sha2-256");
+		goToFail(args.size() <= 2);
+	}
 
-	const bool ret = runHash(hash, argc, argv);
+	const bool ret = runHash(args[1], mode, static_cast<int>(args.size()), args.data());
 	goToFail(!ret);
 
 	return 0;
@@ -105,18 +114,26 @@ int main(const int argc, const char *argv[])
 
 void printUsage(const std::string &name)
 {
-	printf("Usage: %s <HASH> <FILE | - (stdin)>\n", name.c_str());
+	printf("Usage: %s <HASH> <FILE... | - (stdin)>\n", name.c_str());
+	printf("       %s <--tree-digest | --tree-digest-mode> [HASH] <DIR>\n", name.c_str());
+	printf("       %s --s3-etag [PART SIZE] <FILE... | - (stdin)>\n", name.c_str());
+	printf("       %s --dropbox-content-hash <FILE... | - (stdin)>\n", name.c_str());
+	printf("       %s --manifest-create [HASH] <SUM FILE | - (stdin)> <MANIFEST>\n", name.c_str());
+	printf("       %s <--manifest-text | --manifest-check> <MANIFEST>\n", name.c_str());
 	printf("  https://github.com/Chocobo1/Hash \n");
 	printf(
 		"\n"
 		"Available HASH:\n"
+		"  -adler32\n"
 		"  -blake1-224"		"\t -blake1-256"	"\t -blake1-384"	"\t -blake1-512\n"
 		"  -blake2"			"\t -blake2s\n"
-		"  -crc-32\n"
+		"  -crc-32"			"\t -crc-64-xz\n"
 		"  -cshake-128 <Digest length (bytes)> <Customization string>\n"
 		"  -cshake-256 <Digest length (bytes)> <Customization string>\n"
+		"  -fletcher16"		"\t -fletcher32"	"\t -fletcher64\n"
 		"  -fnv32_1a"		"\t -fnv64_1a\n"
 		"  -has160\n"
+		"  -highwayhash-64"	"\t -highwayhash-128"	"\t -highwayhash-256\n"
 		"  -md2"			"\t\t -md4"			"\t\t -md5\n"
 		"  -ripemd-128"		"\t -ripemd-160"	"\t -ripemd-256"	"\t -ripemd-320\n"
 		"  -siphash\n"
@@ -131,540 +148,569 @@ void printUsage(const std::string &name)
 		"  -tuple-hash-128 <Digest length (bytes)> <Customization string>\n"
 		"  -tuple-hash-256 <Digest length (bytes)> <Customization string>\n"
 		"  -whirlpool\n"
+		"\n"
+		"-md5, -sha1 and -sha2-256 accept multiple FILE, small files are hashed in batches\n"
+		"--tree-digest prints the Merkle root over relative paths & contents of files in DIR (default HASH: -sha2-256)\n"
+		"--tree-digest-mode also includes the permission bits\n"
+		"--s3-etag prints the multipart upload ETag, PART SIZE in bytes or with a K/M/G suffix (default: 8M)\n"
+		"--dropbox-content-hash prints the Dropbox content hash (SHA-256 over SHA-256s of 4 MiB blocks)\n"
+		"--manifest-create converts `sha256sum` style output to a binary manifest (default HASH: -sha2-256)\n"
+		"--manifest-text prints a binary manifest back as `sha256sum` style text\n"
+		"--manifest-check verifies the files listed in a binary manifest in parallel, like `sha256sum --check`\n"
 	);
 }
 
-Hash getHash(const std::string &hash)
-{
-	static const std::string names[] = {
-		"-blake1-224", "-blake1-256", "-blake1-384", "-blake1-512",
-		"-blake2", "-blake2s",
-		"-crc-32",
-		"-cshake-128", "-cshake-256",
-		"-fnv32_1a", "-fnv64_1a",
-		"-has160",
-		"-md2", "-md4", "-md5",
-		"-ripemd-128", "-ripemd-160", "-ripemd-256", "-ripemd-320",
-		"-siphash",
-		"-sha1",
-		"-sha2-224", "-sha2-256", "-sha2-384", "-sha2-512",
-		"-sha2-512-224", "-sha2-512-256",
-		"-sha3-224", "-sha3-256", "-sha3-384", "-sha3-512",
-		"-shake-128", "-shake-256",
-		"-sm3",
-		"-tiger1-128", "-tiger1-160", "-tiger1-192",
-		"-tiger2-128", "-tiger2-160", "-tiger2-192",
-		"-tuple-hash-128", "-tuple-hash-256",
-		"-whirlpool"
-	};
-
-	for (int i = 0; i < ARRAY_LENGTH(names); ++i)
-	{
-		if (hash == names[i])
-			return static_cast<Hash>(i);
-	}
-	return Hash::Invalid;
-}
-
-bool runHash(const Hash hash, const int argc, const char *argv[])
+bool runHash(const std::string &hashName, const Mode mode, const int argc, const char *argv[])
 {
-	const auto readNPrint = [](auto hash, const std::string &filename) -> void
+	const auto treeNPrint = [mode](auto hash, const std::string &dirname) -> void
 	{
-		std::unique_ptr<std::istream, void (*)(std::istream *)> inStream {nullptr, [](auto) {}};
-		if (filename == "-")
-			inStream = {&std::cin, [](auto) {}};
-		else
-			inStream = {new std::ifstream(filename, (std::ios_base::in | std::ios_base::binary)), [](std::istream *p) {delete p;}};
-
-		const int bufSize = 1024 * 1024;
-		auto buf = std::make_unique<char[]>(bufSize);
-		while (inStream->good())
+#if (USE_STD_FILESYSTEM_CHOCOBO1_HASH == 1)
+		Chocobo1::TreeDigest<decltype(hash)> tree(hash);
+		try
 		{
-			inStream->read(buf.get(), bufSize);
-			hash.addData(buf.get(), inStream->gcount());
+			tree.addDirectory(dirname, (mode == Mode::TreeDigestWithMode));
 		}
-
-		printf("%s  %s\n", hash.finalize().toString().c_str(), filename.c_str());
-	};
-
-	const auto readAllNPrint = [](auto hash, const std::string &filename) -> void
-	{
-		std::unique_ptr<std::istream, void (*)(std::istream *)> inStream {nullptr, [](auto) {}};
-		if (filename == "-")
-			inStream = {&std::cin, [](auto) {}};
-		else
-			inStream = {new std::ifstream(filename), [](std::istream *p) {delete p;}};
-
-		const int tmpSize = 1024 * 1024;
-		auto tmp = std::make_unique<char[]>(tmpSize);
-
-		std::vector<char> buf;
-		buf.reserve(tmpSize);
-		while (inStream->good())
+		catch (const std::exception &e)
 		{
-			inStream->read(tmp.get(), tmpSize);
-			buf.insert(buf.end(), tmp.get(), (tmp.get() + inStream->gcount()));
+			fprintf(stderr, "%s\n", e.what());
+			exit(1);
 		}
 
-		printf("%s  %s\n", hash.nextData(buf.data(), buf.size()).finalize().toString().c_str(), filename.c_str());
+		printf("%s  %s\n", tree.finalize().toString().c_str(), dirname.c_str());
+#else
+		// refused in `main()`
+		(void) mode;
+		(void) hash;
+		(void) dirname;
+#endif
 	};
 
-	// when benchmarking, comment out unrelated hash as it bloats the binary
-	switch (hash)
+	const auto readNPrint = [mode, &treeNPrint](Chocobo1::AnyHasher hash, const std::string &filename) -> void
 	{
-		case Hash::Blake1_224:
+		if (mode != Mode::Files)
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Blake1_224(), argv[2]);
-			return true;
+			treeNPrint(hash, filename);
+			return;
 		}
 
-		case Hash::Blake1_256:
+		if (filename == "-")
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Blake1_256(), argv[2]);
-			return true;
+			readStdin([&hash](const char *data, const size_t size) -> void
+			{
+				hash.addData(data, size);
+			});
+			printf("%s  %s\n", hash.finalize().toString().c_str(), filename.c_str());
+			return;
 		}
 
-		case Hash::Blake1_384:
-		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Blake1_384(), argv[2]);
-			return true;
-		}
+		std::ifstream inStream(filename, (std::ios_base::in | std::ios_base::binary));
 
-		case Hash::Blake1_512:
+		const int bufSize = 1024 * 1024;
+		auto buf = std::make_unique<char[]>(bufSize);
+		while (inStream.good())
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Blake1_512(), argv[2]);
-			return true;
+			inStream.read(buf.get(), bufSize);
+			hash.addData(buf.get(), inStream.gcount());
 		}
 
-		case Hash::Blake2:
-		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Blake2(), argv[2]);
-			return true;
-		}
+		printf("%s  %s\n", hash.finalize().toString().c_str(), filename.c_str());
+	};
 
-		case Hash::Blake2s:
+	const auto readAllNPrint = [mode, &treeNPrint](auto hash, const std::string &filename) -> void
+	{
+		if (mode != Mode::Files)
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Blake2s(), argv[2]);
-			return true;
+			treeNPrint(hash, filename);
+			return;
 		}
 
-		case Hash::Crc_32:
-		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::CRC_32(), argv[2]);
-			return true;
-		}
+		const int tmpSize = 1024 * 1024;
 
-		case Hash::Cshake_128:
+		std::vector<char> buf;
+		buf.reserve(tmpSize);
+		if (filename == "-")
 		{
-			if (argc != 5)
-				return false;
-
-			int digestLength = 0;
-			try
-			{
-				digestLength = std::stoi(argv[2]);
-			}
-			catch (const std::invalid_argument &e)
+			readStdin([&buf](const char *data, const size_t size) -> void
 			{
-				return false;
-			}
-
-			readNPrint(Chocobo1::CSHAKE_128(digestLength, argv[3]), argv[4]);
-			return true;
+				buf.insert(buf.end(), data, (data + size));
+			});
 		}
-
-		case Hash::Cshake_256:
+		else
 		{
-			if (argc != 5)
-				return false;
-
-			int digestLength = 0;
-			try
-			{
-				digestLength = std::stoi(argv[2]);
-			}
-			catch (const std::invalid_argument &e)
+			std::ifstream inStream(filename);
+			auto tmp = std::make_unique<char[]>(tmpSize);
+			while (inStream.good())
 			{
-				return false;
+				inStream.read(tmp.get(), tmpSize);
+				buf.insert(buf.end(), tmp.get(), (tmp.get() + inStream.gcount()));
 			}
-
-			readNPrint(Chocobo1::CSHAKE_256(digestLength, argv[3]), argv[4]);
-			return true;
 		}
 
-		case Hash::Fnv32_1a:
-		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::FNV32_1a(), argv[2]);
-			return true;
-		}
-
-		case Hash::Fnv64_1a:
-		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::FNV64_1a(), argv[2]);
-			return true;
-		}
+		printf("%s  %s\n", hash.nextData(buf.data(), buf.size()).finalize().toString().c_str(), filename.c_str());
+	};
 
-		case Hash::Has160:
+	const auto batchNPrint = [mode, &readNPrint](auto hash, const int fileCount, const char *files[]) -> void
+	{
+		if (mode != Mode::Files)
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::HAS_160(), argv[2]);
-			return true;
+			for (int i = 0; i < fileCount; ++i)
+				readNPrint(Chocobo1::AnyHasher(hash), files[i]);
+			return;
 		}
 
-		case Hash::Md2:
-		{
-			if (argc != 3)
-				return false;
+		// Small files are read whole and hashed together, one file per lane.
+		// Results are still printed in argument order.
+		using HashType = decltype(hash);
+		using MultiHash = Chocobo1::MultiBuffer<HashType>;
+		using Span = typename MultiHash::template Span<const uint8_t>;
 
-			readNPrint(Chocobo1::MD2(), argv[2]);
-			return true;
-		}
+		const size_t smallFileSize = 16 * 1024;
+		const size_t batchSize = MultiHash::LANES * 8;
 
-		case Hash::Md4:
+		std::vector<std::string> batchNames;
+		std::vector<std::vector<uint8_t>> batchData;
+		const auto flushBatch = [&batchNames, &batchData]() -> void
 		{
-			if (argc != 3)
-				return false;
+			if (batchData.empty())
+				return;
 
-			readNPrint(Chocobo1::MD4(), argv[2]);
-			return true;
-		}
+			std::vector<Span> messages;
+			messages.reserve(batchData.size());
+			for (const auto &data : batchData)
+				messages.emplace_back(data.data(), data.size());
 
-		case Hash::Md5:
-		{
-			if (argc != 3)
-				return false;
+			const auto results = MultiHash::hash(messages);
+			for (size_t i = 0; i < results.size(); ++i)
+			{
+				std::string digest;
+				for (const auto c : results[i])
+				{
+					char hex[3] = {};
+					snprintf(hex, sizeof(hex), "%02x", c);
+					digest += hex;
+				}
+				printf("%s  %s\n", digest.c_str(), batchNames[i].c_str());
+			}
 
-			readNPrint(Chocobo1::MD5(), argv[2]);
-			return true;
-		}
+			batchNames.clear();
+			batchData.clear();
+		};
 
-		case Hash::Ripemd_128:
+		for (int i = 0; i < fileCount; ++i)
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::RIPEMD_128(), argv[2]);
-			return true;
-		}
+			const std::string filename = files[i];
+			if (filename == "-")
+			{
+				flushBatch();
+				readNPrint(Chocobo1::AnyHasher(hash), filename);
+				continue;
+			}
 
-		case Hash::Ripemd_160:
-		{
-			if (argc != 3)
-				return false;
+			std::unique_ptr<FILE, int (*)(FILE *)> file {fopen(filename.c_str(), "rb"), fclose};
+			if (!file)
+			{
+				// same behavior as readNPrint(): unreadable files hash as empty input
+				batchNames.emplace_back(filename);
+				batchData.emplace_back();
+			}
+			else
+			{
+				// a single unbuffered read tells whether the file is small
+				setvbuf(file.get(), nullptr, _IONBF, 0);
+				std::vector<uint8_t> data(smallFileSize + 1);
+				data.resize(fread(data.data(), 1, data.size(), file.get()));
+
+				if (data.size() <= smallFileSize)
+				{
+					batchNames.emplace_back(filename);
+					batchData.emplace_back(std::move(data));
+				}
+				else
+				{
+					flushBatch();
+
+					HashType largeHash = hash;
+					largeHash.addData(data.data(), data.size());
+
+					data.resize(1024 * 1024);
+					size_t readSize = 0;
+					while ((readSize = fread(data.data(), 1, data.size(), file.get())) > 0)
+						largeHash.addData(data.data(), readSize);
+
+					printf("%s  %s\n", largeHash.finalize().toString().c_str(), filename.c_str());
+				}
+			}
 
-			readNPrint(Chocobo1::RIPEMD_160(), argv[2]);
-			return true;
+			if (batchData.size() >= batchSize)
+				flushBatch();
 		}
+		flushBatch();
+	};
 
-		case Hash::Ripemd_256:
-		{
-			if (argc != 3)
-				return false;
+	if ((hashName.size() < 2) || (hashName[0] != '-'))
+		return false;
+	const std::string name = hashName.substr(1);
 
-			readNPrint(Chocobo1::RIPEMD_256(), argv[2]);
-			return true;
-		}
-
-		case Hash::Ripemd_320:
+	const auto parseLength = [](const char *str, int &length) -> bool
+	{
+		try
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::RIPEMD_320(), argv[2]);
-			return true;
+			length = std::stoi(str);
 		}
-
-		case Hash::Siphash:
+		catch (const std::invalid_argument &e)
 		{
-			if (argc != 3)
-				return false;
-
-			// keep it simple for now
-			const unsigned char key[16] = {0};
-			readNPrint(Chocobo1::SipHash(key), argv[2]);
-			return true;
+			return false;
 		}
+		return true;
+	};
 
-		case Hash::Sha1:
-		{
-			if (argc != 3)
-				return false;
+	// TupleHash takes the whole input as a single element
+	if ((name == "tuple-hash-128") || (name == "tuple-hash-256"))
+	{
+		int digestLength = 0;
+		if ((argc != 5) || !parseLength(argv[2], digestLength))
+			return false;
 
-			readNPrint(Chocobo1::SHA1(), argv[2]);
-			return true;
-		}
+		if (name == "tuple-hash-128")
+			readAllNPrint(Chocobo1::TupleHash_128(digestLength, argv[3]), argv[4]);
+		else
+			readAllNPrint(Chocobo1::TupleHash_256(digestLength, argv[3]), argv[4]);
+		return true;
+	}
 
-		case Hash::Sha2_224:
-		{
-			if (argc != 3)
-				return false;
+	if ((name == "md5") || (name == "sha1") || (name == "sha2-256"))
+	{
+		if (argc < 3)
+			return false;
 
-			readNPrint(Chocobo1::SHA2_224(), argv[2]);
-			return true;
-		}
+		if (name == "md5")
+			batchNPrint(Chocobo1::MD5(), (argc - 2), (argv + 2));
+		else if (name == "sha1")
+			batchNPrint(Chocobo1::SHA1(), (argc - 2), (argv + 2));
+		else
+			batchNPrint(Chocobo1::SHA2_256(), (argc - 2), (argv + 2));
+		return true;
+	}
 
-		case Hash::Sha2_256:
-		{
-			if (argc != 3)
-				return false;
+	// everything else shares a single `AnyHasher` code path
+	const Chocobo1::HashId id = Chocobo1::AnyHasher::findId(name);
 
-			readNPrint(Chocobo1::SHA2_256(), argv[2]);
-			return true;
-		}
+	int paramCount = 0;
+	if ((id == Chocobo1::HashId::SHAKE_128) || (id == Chocobo1::HashId::SHAKE_256))
+		paramCount = 1;  // <Digest length>
+	else if ((id == Chocobo1::HashId::CSHAKE_128) || (id == Chocobo1::HashId::CSHAKE_256))
+		paramCount = 2;  // <Digest length> <Customization string>
 
-		case Hash::Sha2_384:
-		{
-			if (argc != 3)
-				return false;
+	if (argc != (3 + paramCount))
+		return false;
 
-			readNPrint(Chocobo1::SHA2_384(), argv[2]);
-			return true;
-		}
+	int digestLength = 0;
+	if ((paramCount > 0) && !parseLength(argv[2], digestLength))
+		return false;
 
-		case Hash::Sha2_512:
-		{
-			if (argc != 3)
-				return false;
+	const Chocobo1::AnyHasher hasher(id, digestLength, ((paramCount == 2) ? argv[3] : ""));
+	if (!hasher.isValid())
+		return false;
 
-			readNPrint(Chocobo1::SHA2_512(), argv[2]);
-			return true;
-		}
+	readNPrint(hasher, argv[argc - 1]);
+	return true;
+}
 
-		case Hash::Sha2_512_224:
+bool runBlockList(const std::string &option, const int argc, const char *argv[])
+{
+	// Files are mmaped & fed whole so every core (and SIMD lane) gets parts to hash
+	const auto hashNPrint = [](auto hash, const bool withPartCount, const std::string &filename, const uint64_t partSize) -> void
+	{
+		if (filename == "-")
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::SHA2_512_224(), argv[2]);
-			return true;
+			// buffer a few parts for the threads
+			const size_t bufLimit = static_cast<size_t>(std::min<uint64_t>(std::max<uint64_t>((partSize * std::max(std::thread::hardware_concurrency(), 1u)), (1024 * 1024)), (256 * 1024 * 1024)));
+			std::vector<uint8_t> buf;
+			buf.reserve(bufLimit);
+			readStdin([&hash, &buf, bufLimit](const char *data, const size_t size) -> void
+			{
+				buf.insert(buf.end(), data, (data + size));
+				if (buf.size() >= bufLimit)
+				{
+					hash.addData(buf.data(), buf.size());
+					buf.clear();
+				}
+			});
+			hash.addData(buf.data(), buf.size());
 		}
-
-		case Hash::Sha2_512_256:
+		else
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::SHA2_512_256(), argv[2]);
-			return true;
+			const Chocobo1::MappedFile file(filename);
+			if (!file.isValid())
+			{
+				fprintf(stderr, "Cannot read file: %s\n", filename.c_str());
+				return;
+			}
+			hash.addData(file.data());
 		}
 
-		case Hash::Sha3_224:
-		{
-			if (argc != 3)
-				return false;
+		hash.finalize();
+		printf("%s  %s\n", (withPartCount ? hash.toETag() : hash.toString()).c_str(), filename.c_str());
+	};
 
-			readNPrint(Chocobo1::SHA3_224(), argv[2]);
-			return true;
-		}
+	int firstFile = 2;
+	if (option == "--dropbox-content-hash")
+	{
+		if (argc <= firstFile)
+			return false;
 
-		case Hash::Sha3_256:
-		{
-			if (argc != 3)
-				return false;
+		for (int i = firstFile; i < argc; ++i)
+			hashNPrint(Chocobo1::DropboxContentHash(), false, argv[i], Chocobo1::DropboxContentHash::BLOCK_SIZE);
+		return true;
+	}
 
-			readNPrint(Chocobo1::SHA3_256(), argv[2]);
-			return true;
-		}
+	// optional part size: digits with an optional K/M/G suffix
+	uint64_t partSize = Chocobo1::S3ETag::DEFAULT_PART_SIZE;
+	if ((argc > 3) && (argv[2][0] >= '0') && (argv[2][0] <= '9'))
+	{
+		char *end = nullptr;
+		partSize = strtoull(argv[2], &end, 10);
+		const std::string suffix = end;
+		if ((suffix == "K") || (suffix == "k"))
+			partSize *= 1024;
+		else if ((suffix == "M") || (suffix == "m"))
+			partSize *= (1024 * 1024);
+		else if ((suffix == "G") || (suffix == "g"))
+			partSize *= (1024 * 1024 * 1024);
+		else if (!suffix.empty())
+			return false;
+		++firstFile;
+	}
+	if ((partSize == 0) || (argc <= firstFile))
+		return false;
 
-		case Hash::Sha3_384:
-		{
-			if (argc != 3)
-				return false;
+	for (int i = firstFile; i < argc; ++i)
+		hashNPrint(Chocobo1::S3ETag(partSize), true, argv[i], partSize);
+	return true;
+}
 
-			readNPrint(Chocobo1::SHA3_384(), argv[2]);
-			return true;
-		}
+bool runManifest(const std::string &option, const int argc, const char *argv[])
+{
+	if (option == "--manifest-create")
+	{
+		if ((argc != 4) && (argc != 5))
+			return false;
 
-		case Hash::Sha3_512:
-		{
-			if (argc != 3)
-				return false;
+		const std::string hashName = (argc == 5) ? std::string(argv[2]) : std::string("-sha2-256");
+		const std::string inName = argv[argc - 2];
+		const std::string outName = argv[argc - 1];
+		if ((hashName.size() < 2) || (hashName[0] != '-'))
+			return false;
 
-			readNPrint(Chocobo1::SHA3_512(), argv[2]);
-			return true;
-		}
+		// the digest size comes from the hasher, not from the text
+		Chocobo1::AnyHasher hasher(hashName.substr(1));
+		if (!hasher.isValid())
+			return false;
+		Chocobo1::DigestManifestBuilder builder(hashName.substr(1), hasher.finalize().toVector().size());
 
-		case Hash::Shake_128:
+		std::size_t malformed = 0;
+		if (inName == "-")
 		{
-			if (argc != 4)
-				return false;
-
-			int digestLength = 0;
-			try
-			{
-				digestLength = std::stoi(argv[2]);
-			}
-			catch (const std::invalid_argument &e)
+			std::vector<char> text;
+			readStdin([&text](const char *data, const size_t size) -> void
 			{
-				return false;
-			}
-
-			readNPrint(Chocobo1::SHAKE_128(digestLength), argv[3]);
-			return true;
+				text.insert(text.end(), data, (data + size));
+			});
+			malformed = builder.addSumText(text);
 		}
-
-		case Hash::Shake_256:
+		else
 		{
-			if (argc != 4)
-				return false;
-
-			int digestLength = 0;
-			try
-			{
-				digestLength = std::stoi(argv[2]);
-			}
-			catch (const std::invalid_argument &e)
+			const Chocobo1::MappedFile file(inName);
+			if (!file.isValid())
 			{
-				return false;
+				fprintf(stderr, "Cannot read file: %s\n", inName.c_str());
+				exit(1);
 			}
-
-			readNPrint(Chocobo1::SHAKE_256(digestLength), argv[3]);
-			return true;
+			malformed = builder.addSumText({reinterpret_cast<const char *>(file.data().data()), file.size()});
 		}
+		if (malformed > 0)
+			fprintf(stderr, "WARNING: %zu lines are improperly formatted\n", malformed);
 
-		case Hash::Sm3:
+		const std::vector<uint8_t> manifest = builder.serialize();
+		std::ofstream outStream(outName, (std::ios_base::out | std::ios_base::binary | std::ios_base::trunc));
+		outStream.write(reinterpret_cast<const char *>(manifest.data()), static_cast<std::streamsize>(manifest.size()));
+		if (!outStream)
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::SM3(), argv[2]);
-			return true;
+			fprintf(stderr, "Cannot write file: %s\n", outName.c_str());
+			exit(1);
 		}
+		return true;
+	}
 
-		case Hash::Tiger1_128:
-		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Tiger1_128(), argv[2]);
-			return true;
-		}
+	if (argc != 3)
+		return false;
 
-		case Hash::Tiger1_160:
-		{
-			if (argc != 3)
-				return false;
+	const Chocobo1::MappedFile file(argv[2]);
+	const auto manifest = Chocobo1::DigestManifest::view(file.data());
+	if (!manifest.isValid())
+	{
+		fprintf(stderr, "Not a valid manifest: %s\n", argv[2]);
+		exit(1);
+	}
 
-			readNPrint(Chocobo1::Tiger1_160(), argv[2]);
-			return true;
-		}
+	if (option == "--manifest-text")
+	{
+		const std::string text = manifest.toSumText();
+		fwrite(text.data(), 1, text.size(), stdout);
+		return true;
+	}
 
-		case Hash::Tiger1_192:
-		{
-			if (argc != 3)
-				return false;
+	const Chocobo1::AnyHasher prototype(manifest.algorithm());
+	if (!prototype.isValid())
+	{
+		fprintf(stderr, "Unsupported hash: %s\n", manifest.algorithm().c_str());
+		exit(1);
+	}
 
-			readNPrint(Chocobo1::Tiger1_192(), argv[2]);
-			return true;
-		}
+	// Files are hashed in windows across threads, results are printed in manifest order
+	enum Status : char { Ok, Failed, Unreadable };
+	const size_t window = 4096;
+	const unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u);
+	std::vector<char> status(std::min(window, manifest.size()));
+	size_t failed = 0;
+	size_t unreadable = 0;
 
-		case Hash::Tiger2_128:
+	for (size_t first = 0; first < manifest.size(); first += window)
+	{
+		const size_t count = std::min(window, (manifest.size() - first));
+		std::atomic<size_t> next {0};
+		const auto worker = [&]() -> void
 		{
-			if (argc != 3)
-				return false;
+			Chocobo1::AnyHasher hasher = prototype;
+			for (size_t i = next++; i < count; i = next++)
+			{
+				const auto record = manifest.record(first + i);
+				const Chocobo1::MappedFile input(record.pathString());
+				if (record.digest.empty() || !input.isValid())
+				{
+					status[i] = Unreadable;
+					continue;
+				}
+
+				hasher.reset();
+				const std::vector<uint8_t> digest = hasher.addData(input.data()).finalize().toVector();
+				status[i] = std::equal(digest.begin(), digest.end(), record.digest.begin(), record.digest.end()) ? Ok : Failed;
+			}
+		};
 
-			readNPrint(Chocobo1::Tiger2_128(), argv[2]);
-			return true;
-		}
+		std::vector<std::thread> pool;
+		for (unsigned int i = 1; i < std::min<size_t>(threads, count); ++i)
+			pool.emplace_back(worker);
+		worker();
+		for (std::thread &t : pool)
+			t.join();
 
-		case Hash::Tiger2_160:
+		for (size_t i = 0; i < count; ++i)
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Tiger2_160(), argv[2]);
-			return true;
+			const auto record = manifest.record(first + i);
+			const char *result = (status[i] == Ok) ? "OK" : ((status[i] == Failed) ? "FAILED" : "FAILED open or read");
+			printf("%s: %s\n", record.pathString().c_str(), result);
+			failed += (status[i] == Failed) ? 1 : 0;
+			unreadable += (status[i] == Unreadable) ? 1 : 0;
 		}
+	}
 
-		case Hash::Tiger2_192:
-		{
-			if (argc != 3)
-				return false;
+	fflush(stdout);
+	if (unreadable > 0)
+		fprintf(stderr, "WARNING: %zu listed files could not be read\n", unreadable);
+	if (failed > 0)
+		fprintf(stderr, "WARNING: %zu computed checksums did NOT match\n", failed);
+	if ((failed > 0) || (unreadable > 0))
+		exit(1);
+	return true;
+}
 
-			readNPrint(Chocobo1::Tiger2_192(), argv[2]);
-			return true;
-		}
+template <typename Func>
+void readStdin(const Func &func)
+{
+	// Feed stdin to `func` in chunks, bypassing iostreams
+	const size_t bufSize = 1024 * 1024;
+
+#if defined(USE_POSIX_STDIN)
+	// stdin redirected from a regular file: map it, no copying at all
+	struct stat fileStat {};
+	const off_t offset = lseek(STDIN_FILENO, 0, SEEK_CUR);
+	if ((fstat(STDIN_FILENO, &fileStat) == 0) && S_ISREG(fileStat.st_mode) && (offset >= 0) && (fileStat.st_size > offset))
+	{
+		const off_t pageSize = sysconf(_SC_PAGESIZE);
+		const off_t mapOffset = offset - (offset % pageSize);
+		const size_t mapSize = static_cast<size_t>(fileStat.st_size - mapOffset);
 
-		case Hash::Tuple_hash_128:
+		void *map = mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, STDIN_FILENO, mapOffset);
+		if (map != MAP_FAILED)
 		{
-			if (argc != 5)
-				return false;
+			madvise(map, mapSize, MADV_SEQUENTIAL);
 
-			int digestLength = 0;
-			try
-			{
-				digestLength = std::stoi(argv[2]);
-			}
-			catch (const std::invalid_argument &e)
+			const char *data = static_cast<const char *>(map) + (offset - mapOffset);
+			size_t remaining = static_cast<size_t>(fileStat.st_size - offset);
+			while (remaining > 0)
 			{
-				return false;
+				const size_t size = std::min(remaining, bufSize);
+				func(data, size);
+				data += size;
+				remaining -= size;
 			}
 
-			readAllNPrint(Chocobo1::TupleHash_128(digestLength, argv[3]), argv[4]);
-			return true;
+			munmap(map, mapSize);
+			lseek(STDIN_FILENO, fileStat.st_size, SEEK_SET);
+			return;
 		}
+	}
 
-		case Hash::Tuple_hash_256:
-		{
-			if (argc != 5)
-				return false;
-
-			int digestLength = 0;
-			try
-			{
-				digestLength = std::stoi(argv[2]);
-			}
-			catch (const std::invalid_argument &e)
-			{
-				return false;
-			}
+	// pipes & everything else: raw read() into a page aligned buffer
+	void *buf = nullptr;
+	if (posix_memalign(&buf, 4096, bufSize) != 0)
+	{
+		fprintf(stderr, "Cannot read stdin: out of memory\n");
+		exit(1);
+	}
+	const std::unique_ptr<void, void (*)(void *)> bufHolder {buf, free};
 
-			readAllNPrint(Chocobo1::TupleHash_256(digestLength, argv[3]), argv[4]);
-			return true;
+	while (true)
+	{
+		const ssize_t size = read(STDIN_FILENO, buf, bufSize);
+		if (size > 0)
+			func(static_cast<const char *>(buf), static_cast<size_t>(size));
+		else if (size == 0)
+			break;
+		else if (errno != EINTR)
+		{
+			fprintf(stderr, "Cannot read stdin: %s\n", strerror(errno));
+			exit(1);
 		}
+	}
+#elif defined(USE_WIN32_STDIN)
+	_setmode(_fileno(stdin), _O_BINARY);
 
-		case Hash::Whirlpool:
+	auto buf = std::make_unique<char[]>(bufSize);
+	while (true)
+	{
+		const int size = _read(_fileno(stdin), buf.get(), static_cast<unsigned int>(bufSize));
+		if (size == 0)
+			break;
+		if (size < 0)
 		{
-			if (argc != 3)
-				return false;
-
-			readNPrint(Chocobo1::Whirlpool(), argv[2]);
-			return true;
+			fprintf(stderr, "Cannot read stdin: %s\n", strerror(errno));
+			exit(1);
 		}
-
-		default:
-		case Hash::Invalid:
-			return false;
+		func(buf.get(), static_cast<size_t>(size));
 	}
-
-	return false;
+#else
+	auto buf = std::make_unique<char[]>(bufSize);
+	while (std::cin.good())
+	{
+		std::cin.read(buf.get(), bufSize);
+		func(buf.get(), static_cast<size_t>(std::cin.gcount()));
+	}
+	if (std::cin.bad())
+	{
+		fprintf(stderr, "Cannot read stdin\n");
+		exit(1);
+	}
+#endif
 }
@@ -0,0 +1,210 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_RANGE_HASH_H
+#define CHOCOBO1_RANGE_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+// Opt in to reading `std::deque` a chunk at a time. This relies on libstdc++ internals (`std::_Deque_iterator`)
+// that are not a stable interface, so it is off unless requested and ignored for other standard libraries
+#ifndef USE_LIBSTDCXX_DEQUE_SEGMENTS_CHOCOBO1_HASH
+#define USE_LIBSTDCXX_DEQUE_SEGMENTS_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_LIBSTDCXX_DEQUE_SEGMENTS_CHOCOBO1_HASH == 1) && defined(__GLIBCXX__)
+#include <deque>
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// addRange(sha1, deque.begin(), deque.end());  // iterators or iterator & sentinel
+	// addRange(sha1, deque).finalize().toString();  // containers & `std::ranges`, returns the hasher
+	// addRange(sha1, generator);  // input ranges are staged through a small buffer
+
+	// Elements must be 1 byte wide (char, uint8_t, std::byte...).
+	// Contiguous input (pointers, containers with `data()`, `std::contiguous_iterator`) is passed on as is,
+	// specialize `RangeSegments` for iterators that walk over contiguous pieces, e.g. of a rope:
+	//   template <> struct RangeSegments<Rope::Iterator>
+	//   {
+	//       static constexpr bool IsSegmented = true;
+	//       static std::size_t contiguousLength(const Rope::Iterator &it);  // elements contiguous with `*it`
+	//   };
+	template <typename It, typename = void>
+	struct RangeSegments
+	{
+		static constexpr bool IsSegmented = false;
+	};
+
+#if (USE_LIBSTDCXX_DEQUE_SEGMENTS_CHOCOBO1_HASH == 1) && defined(__GLIBCXX__)
+	// `std::deque` stores its elements in fixed size chunks
+	template <typename T, typename Ref, typename Ptr>
+	struct RangeSegments<std::_Deque_iterator<T, Ref, Ptr>>
+	{
+		static constexpr bool IsSegmented = true;
+		static std::size_t contiguousLength(const std::_Deque_iterator<T, Ref, Ptr> &it)
+		{
+			return static_cast<std::size_t>(it._M_last - it._M_cur);
+		}
+	};
+#endif
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace RangeHash_NS
+{
+	using Byte = uint8_t;
+
+	static constexpr std::size_t STAGING_SIZE = 512;  // a few blocks of every algorithm here
+
+	template <typename It>
+	using ElementType = typename std::remove_cv<typename std::remove_reference<decltype(*std::declval<It &>())>::type>::type;
+
+	template <typename It>
+	void checkElement()
+	{
+		using E = ElementType<It>;
+		static_assert(((sizeof(E) == 1) && std::is_trivially_copyable<E>::value), "Elements must be 1 byte wide");
+	}
+
+	// containers with `data()` & `size()` are contiguous (std::vector, std::string, std::array, spans...)
+	template <typename R, typename = void>
+	struct HasDataSize : std::false_type {};
+	template <typename R>
+	struct HasDataSize<R, decltype(std::declval<R &>().data(), std::declval<R &>().size(), void())>
+		: std::integral_constant<bool, std::is_pointer<decltype(std::declval<R &>().data())>::value> {};
+
+	template <typename It>
+	using IsContiguous = std::integral_constant<bool, (std::is_pointer<It>::value
+#if (__cpp_lib_ranges >= 201911L)
+		|| std::contiguous_iterator<It>
+#endif
+		)>;
+
+	template <typename It, typename Sentinel>
+	using IsSized = std::integral_constant<bool, (std::is_same<It, Sentinel>::value
+		&& std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value)>;
+
+	template <typename T, typename It, typename Sentinel>
+	void feed(T &hasher, It first, Sentinel last)
+	{
+		// input iterators, generators etc.: constant memory, never materializes the whole range
+		Byte buffer[STAGING_SIZE];
+		std::size_t size = 0;
+		for (; first != last; ++first)
+		{
+			buffer[size++] = static_cast<Byte>(*first);
+			if (size == STAGING_SIZE)
+			{
+				hasher.addData(buffer, size);
+				size = 0;
+			}
+		}
+		if (size > 0)
+			hasher.addData(buffer, size);
+	}
+
+	template <typename T, typename It, typename Sentinel>
+	void feedSegments(T &hasher, It first, const Sentinel last, std::true_type)
+	{
+		auto remaining = static_cast<std::size_t>(last - first);
+		while (remaining > 0)
+		{
+			std::size_t length = RangeSegments<It>::contiguousLength(first);
+			length = (length < remaining) ? length : remaining;
+			hasher.addData(std::addressof(*first), length);
+			first += static_cast<typename std::iterator_traits<It>::difference_type>(length);
+			remaining -= length;
+		}
+	}
+
+	template <typename T, typename It, typename Sentinel>
+	void feedSegments(T &hasher, It first, const Sentinel last, std::false_type)
+	{
+		feed(hasher, first, last);
+	}
+
+	template <typename T, typename It, typename Sentinel>
+	void feedRange(T &hasher, const It first, const Sentinel last, std::true_type)
+	{
+		const auto length = static_cast<std::size_t>(last - first);
+		if (length > 0)
+		{
+#if (__cpp_lib_to_address >= 201711L)
+			hasher.addData(std::to_address(first), length);
+#else
+			hasher.addData(first, length);
+#endif
+		}
+	}
+
+	template <typename T, typename It, typename Sentinel>
+	void feedRange(T &hasher, const It first, const Sentinel last, std::false_type)
+	{
+		feedSegments(hasher, first, last, std::integral_constant<bool, (RangeSegments<It>::IsSegmented && IsSized<It, Sentinel>::value)>());
+	}
+
+	template <typename T, typename It, typename Sentinel>
+	typename std::remove_reference<T>::type& addRange(T &&hasher, const It first, const Sentinel last)
+	{
+		checkElement<It>();
+		feedRange(hasher, first, last, std::integral_constant<bool, (IsContiguous<It>::value && IsSized<It, Sentinel>::value)>());
+		return hasher;
+	}
+
+	template <typename T, typename R>
+	void feedContainer(T &hasher, R &range, std::true_type)
+	{
+		using E = typename std::remove_pointer<decltype(range.data())>::type;
+		static_assert(((sizeof(E) == 1) && std::is_trivially_copyable<typename std::remove_cv<E>::type>::value), "Elements must be 1 byte wide");
+
+		const auto length = static_cast<std::size_t>(range.size());
+		if (length > 0)
+			hasher.addData(range.data(), length);
+	}
+
+	template <typename T, typename R>
+	void feedContainer(T &hasher, R &range, std::false_type)
+	{
+		using std::begin;
+		using std::end;
+		addRange(hasher, begin(range), end(range));
+	}
+
+	template <typename T, typename R>
+	typename std::remove_reference<T>::type& addRange(T &&hasher, R &&range)
+	{
+		feedContainer(hasher, range, HasDataSize<typename std::remove_reference<R>::type>());
+		return hasher;
+	}
+}
+}
+	using Hash::RangeHash_NS::addRange;
+}
+
+#endif  // CHOCOBO1_RANGE_HASH_H
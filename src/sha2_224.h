@@ -45,6 +45,8 @@ namespace Chocobo1
 {
 	// Use these!!
 	// SHA2_224();
+
+	// "abc"_sha2_224;  // C++20, digest as `SHA2_224::ResultArrayType` computed at compile time
 }
 
 
@@ -62,15 +64,6 @@ namespace Hash
 #endif
 #endif
 
-#ifndef INLINE_CLASS_VARIABLE_CHOCOBO1_HASH
-#if __cplusplus >= 201703L
-#define INLINE_CLASS_VARIABLE_CHOCOBO1_HASH constexpr static
-#define HAS_INLINE_CLASS_VARIABLE_CHOCOBO1_HASH
-#else
-#define INLINE_CLASS_VARIABLE_CHOCOBO1_HASH const
-#endif
-#endif
-
 #if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
 	using IndexType = std::size_t;
 #else
@@ -167,8 +160,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -198,7 +195,35 @@ namespace Hash
 
 namespace SHA2_224_NS
 {
-	class SHA2_224
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr uint32_t kTable[64] =
+		{
+			0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+			0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+			0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+			0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+			0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+			0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+			0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+			0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+			0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+			0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+			0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+			0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+			0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+			0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+			0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+			0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+		};
+	};
+
+	template <typename T>
+	constexpr uint32_t Tables<T>::kTable[64];
+
+
+	class SHA2_224 : private Tables<>
 	{
 		// https://tools.ietf.org/html/rfc6234
 
@@ -254,30 +279,9 @@ namespace SHA2_224_NS
 
 			static constexpr int BLOCK_SIZE = 64;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
-			uint64_t m_sizeCounter = 0;
-
 			uint32_t m_h[8] = {};
-
-			INLINE_CLASS_VARIABLE_CHOCOBO1_HASH uint32_t kTable[64] =
-			{
-				0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-				0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-				0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-				0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-				0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-				0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-				0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-				0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-				0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-				0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-				0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-				0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-				0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-				0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-				0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-				0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-			};
+			uint64_t m_sizeCounter = 0;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 	};
 
 
@@ -313,6 +317,7 @@ namespace SHA2_224_NS
 	constexpr SHA2_224::SHA2_224()
 	{
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
+		static_assert((sizeof(SHA2_224) < (sizeof(m_buffer) + sizeof(m_sizeCounter) + sizeof(m_h) + alignof(SHA2_224))), "Constant tables should not be stored in each instance");
 		reset();
 	}
 
@@ -333,19 +338,23 @@ namespace SHA2_224_NS
 
 	CONSTEXPR_CPP17_CHOCOBO1_HASH inline SHA2_224& SHA2_224::finalize()
 	{
-		m_sizeCounter += m_buffer.size();
+		const uint64_t sizeCounterBits = ((m_sizeCounter + m_buffer.size()) * 8);
+		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
+		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 
 		// append 1 bit
 		m_buffer.fill(1 << 7);
 
-		// append paddings
-		const auto len = static_cast<int>(((2 * BLOCK_SIZE) - (m_buffer.size() + 8)) % BLOCK_SIZE);
-		m_buffer.fill(0, (len + 8));
+		// append paddings, the size field must fit in the last block
+		if (m_buffer.size() > (BLOCK_SIZE - 8))
+		{
+			m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
+			addDataImpl({m_buffer.data(), m_buffer.size()});
+			m_buffer.clear();
+		}
+		m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
 
 		// append size in bits
-		const uint64_t sizeCounterBits = m_sizeCounter * 8;
-		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
-		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 		for (int i = 0; i < 4; ++i)
 		{
 			m_buffer[m_buffer.size() - 8 + i] = ror<Byte>(sizeCounterBitsH, (8 * (3 - i)));
@@ -507,11 +516,7 @@ namespace SHA2_224_NS
 			uint32_t g = m_h[6];
 			uint32_t h = m_h[7];
 
-#ifdef HAS_INLINE_CLASS_VARIABLE_CHOCOBO1_HASH
 			const auto round = [&wTable](uint32_t &a, uint32_t &b, uint32_t &c, uint32_t &d, uint32_t &e, uint32_t &f, uint32_t &g, uint32_t &h, const unsigned int t) -> void
-#else
-			const auto round = [this, &wTable](uint32_t &a, uint32_t &b, uint32_t &c, uint32_t &d, uint32_t &e, uint32_t &f, uint32_t &g, uint32_t &h, const unsigned int t) -> void
-#endif
 			{
 				const auto ch = [](const uint32_t x, const uint32_t y, const uint32_t z) -> uint32_t
 				{
@@ -565,6 +570,41 @@ namespace SHA2_224_NS
 	using SHA2_224 = Hash::SHA2_224_NS::SHA2_224;
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval SHA2_224::ResultArrayType operator""_sha2_224(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<SHA2_224>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <>
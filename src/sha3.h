@@ -40,6 +40,11 @@
 #include "gsl/span"
 #endif
 
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
 
 namespace Chocobo1
 {
@@ -48,6 +53,7 @@ namespace Chocobo1
 	// SHA3_256();
 	// SHA3_384();
 	// SHA3_512();
+	// "abc"_sha3_256;  // C++20, digest as `SHA3_256::ResultArrayType` computed at compile time
 
 	// SHAKE_128(const int digestLengthInBytes);
 	// SHAKE_256(const int digestLengthInBytes);
@@ -68,6 +74,14 @@ namespace Hash
 #endif
 #endif
 
+#ifndef CONSTEXPR_CPP20_CHOCOBO1_HASH
+#if (__cpp_lib_constexpr_vector >= 201907L) && (__cpp_lib_constexpr_string >= 201907L)
+#define CONSTEXPR_CPP20_CHOCOBO1_HASH constexpr
+#else
+#define CONSTEXPR_CPP20_CHOCOBO1_HASH
+#endif
+#endif
+
 #if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
 	using IndexType = std::size_t;
 #else
@@ -164,8 +178,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -195,13 +213,30 @@ namespace Hash
 
 namespace SHA3_NS
 {
-	template<int R, int P>  // `R`: see m_params. `P`: suffix + padding
-	class Keccak
+	template <typename T = void>
+	struct Tables
+	{
+		static constexpr uint64_t roundConstantTable[24] =
+		{
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000, 0x000000000000808B, 0x0000000080000001,
+			0x8000000080008081, 0x8000000000008009, 0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+			0x000000000000800A, 0x800000008000000A, 0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+	};
+
+	template <typename T>
+	constexpr uint64_t Tables<T>::roundConstantTable[24];
+
+
+	template<int R, int P, int D = 0>  // `R`: rate in bytes. `P`: suffix + padding. `D`: fixed digest size in bytes, 0 if chosen at runtime
+	class Keccak : private Tables<>
 	{
 		// https://dx.doi.org/10.6028/NIST.FIPS.202
 
 		public:
 			using Byte = uint8_t;
+			using ResultArrayType = std::array<Byte, D>;
 
 #if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
 			template <typename T, std::size_t Extent = std::dynamic_extent>
@@ -215,10 +250,13 @@ namespace SHA3_NS
 			constexpr explicit Keccak(int digestLength);
 
 			constexpr void reset();
-			Keccak& finalize();  // after this, only `operator T()`, `reset()`, `toString()`, `toVector()` are available
+			CONSTEXPR_CPP17_CHOCOBO1_HASH Keccak& finalize();  // after this, only `operator T()`, `reset()`, `toArray()`, `toSpan()`, `toString()`, `toVector()` are available
 
 			std::string toString() const;
-			std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP20_CHOCOBO1_HASH std::vector<Byte> toVector() const;
+			template <int Size = D>  // a template, so explicitly instantiating SHAKE doesn't trip the static_assert
+			CONSTEXPR_CPP17_CHOCOBO1_HASH ResultArrayType toArray() const;  // only for fixed size digests
+			CONSTEXPR_CPP17_CHOCOBO1_HASH void toSpan(Span<Byte> output) const;  // writes the first `output.size()` bytes of output
 			template <typename T>
 			operator T() const noexcept;
 
@@ -250,26 +288,20 @@ namespace SHA3_NS
 
 		private:
 			constexpr void addDataImpl(Span<const Byte> data);
-			std::vector<typename Keccak::Byte> stateToVector() const;
 
-			struct
-			{
-				// Keccak-512(M) = KECCAK[1024](M || 01, 512)
-				//                 KECCAK[ c  ](   _   ,  d )
-
-				// loosely related to the spec
-//				int b = 1600;  // fixed for all Keccak instances
-//				int c = 1024;
-//				int d = 512 / 8;  // digest size
-//				int r = 576 / 8;  // (b - c)  // IOW, BLOCK_SIZE
-				int w = 64;       // (b / 25)
-			} m_params;
-			int m_digestLength;
-
-			Buffer<Byte, R> m_buffer;
-			std::vector<Byte> m_final;
+			// Keccak-512(M) = KECCAK[1024](M || 01, 512)
+			//                 KECCAK[ c  ](   _   ,  d )
+			// loosely related to the spec
+			//   b = 1600, fixed for all Keccak instances
+			//   c = 1024
+			//   d = 512 / 8, digest size
+			//   r = 576 / 8, (b - c), IOW `R` or BLOCK_SIZE
+			static constexpr int W = 64;  // lane size, (b / 25)
 
 			uint64_t m_state[5][5] = {};  // [y][x]
+			int m_digestLength;
+			Buffer<Byte, R> m_buffer;
+			bool m_finalized = false;  // finalizing twice must not absorb another padding block
 	};
 
 
@@ -306,61 +338,51 @@ namespace SHA3_NS
 
 
 	//
-	template <int R, int P>
-	constexpr Keccak<R, P>::Keccak(const int digestLength)
-		: m_params()
-		, m_digestLength(digestLength)
+	template <int R, int P, int D>
+	constexpr Keccak<R, P, D>::Keccak(const int digestLength)
+		: m_digestLength(digestLength)
 	{
 		static_assert((R >= 0), "Template parameter value invalid: R");
 		static_assert((P >= 0), "Template parameter value invalid: P");
 		static_assert((CHAR_BIT == 8), "Sorry, we don't support exotic CPUs");
 
-		m_final.reserve(m_digestLength);
 		reset();
 	}
 
-	template <int R, int P>
-	constexpr void Keccak<R, P>::reset()
+	template <int R, int P, int D>
+	constexpr void Keccak<R, P, D>::reset()
 	{
 		m_buffer.clear();
-		m_final.clear();
+		m_finalized = false;
 
 		for (int y = 0; y < 5; ++y)
 			for (int x = 0; x < 5; ++x)
 				m_state[y][x] = 0;
 	}
 
-	template <int R, int P>
-	Keccak<R, P>& Keccak<R, P>::finalize()
+	template <int R, int P, int D>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH Keccak<R, P, D>& Keccak<R, P, D>::finalize()
 	{
+		if (m_finalized)
+			return (*this);
+		m_finalized = true;
+
 		// add padding
 		// the padding is reversed due to "B.1 Conversion Functions - Algorithm 11: b2h(S)"
 		m_buffer.fill(P);
 
-		const auto len = static_cast<int>(((2 * R) - m_buffer.size()) % R);
+		const auto len = static_cast<int>(R - m_buffer.size());
 		m_buffer.fill(0, len);
 		m_buffer[m_buffer.size() - 1] |= (1 << 7);
 
 		addDataImpl({m_buffer.data(), m_buffer.size()});
 		m_buffer.clear();
 
-		// squish out
-		while (true)
-		{
-			const std::vector<Byte> state = stateToVector();
-			m_final.insert(m_final.end(), state.begin(), (state.begin() + R));
-			if (m_final.size() >= static_cast<size_t>(m_digestLength))
-				break;
-
-			addDataImpl(std::array<Byte, R> {});
-		}
-
-		m_final.resize(m_digestLength);
 		return (*this);
 	}
 
-	template <int R, int P>
-	std::string Keccak<R, P>::toString() const
+	template <int R, int P, int D>
+	std::string Keccak<R, P, D>::toString() const
 	{
 		const auto v = toVector();
 		std::string ret;
@@ -379,15 +401,51 @@ namespace SHA3_NS
 		return ret;
 	}
 
-	template <int R, int P>
-	std::vector<typename Keccak<R, P>::Byte> Keccak<R, P>::toVector() const
+	template <int R, int P, int D>
+	CONSTEXPR_CPP20_CHOCOBO1_HASH std::vector<typename Keccak<R, P, D>::Byte> Keccak<R, P, D>::toVector() const
 	{
-		return m_final;
+		std::vector<Byte> ret(static_cast<size_t>(m_digestLength));
+		toSpan(ret);
+		return ret;
+	}
+
+	template <int R, int P, int D>
+	template <int Size>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH typename Keccak<R, P, D>::ResultArrayType Keccak<R, P, D>::toArray() const
+	{
+		static_assert((Size > 0), "Digest size is chosen at runtime, use `toVector()` or `toSpan()` instead");
+
+		ResultArrayType ret {};
+		toSpan(ret);
+		return ret;
+	}
+
+	template <int R, int P, int D>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH void Keccak<R, P, D>::toSpan(const Span<Byte> output) const
+	{
+		// squish out, on a copy so the finalized state is left intact
+		Keccak squeezer = *this;
+		size_t outputIdx = 0;
+		while (true)
+		{
+			for (int i = 0; i < R; ++i)
+			{
+				if (outputIdx >= output.size())
+					return;
+
+				// lanes are stored in little endian
+				const uint64_t lane = squeezer.m_state[(i / 8) / 5][(i / 8) % 5];
+				output[outputIdx] = ror<Byte>(lane, (8 * (i % 8)));
+				++outputIdx;
+			}
+
+			squeezer.addDataImpl(std::array<Byte, R> {});
+		}
 	}
 
-	template <int R, int P>
+	template <int R, int P, int D>
 	template <typename T>
-	Keccak<R, P>::operator T() const noexcept
+	Keccak<R, P, D>::operator T() const noexcept
 	{
 		static_assert(std::is_unsigned<T>::value, "");
 
@@ -401,8 +459,8 @@ namespace SHA3_NS
 		return ret;
 	}
 
-	template <int R, int P>
-	constexpr Keccak<R, P>& Keccak<R, P>::addData(const Span<const Byte> inData)
+	template <int R, int P, int D>
+	constexpr Keccak<R, P, D>& Keccak<R, P, D>::addData(const Span<const Byte> inData)
 	{
 		Span<const Byte> data = inData;
 
@@ -436,36 +494,36 @@ namespace SHA3_NS
 		return (*this);
 	}
 
-	template <int R, int P>
-	constexpr Keccak<R, P>& Keccak<R, P>::addData(const void *ptr, const std::size_t length)
+	template <int R, int P, int D>
+	constexpr Keccak<R, P, D>& Keccak<R, P, D>::addData(const void *ptr, const std::size_t length)
 	{
 		// Span::size_type = std::size_t
 		return addData({static_cast<const Byte*>(ptr), length});
 	}
 
-	template <int R, int P>
+	template <int R, int P, int D>
 	template <std::size_t N>
-	constexpr Keccak<R, P>& Keccak<R, P>::addData(const Byte (&array)[N])
+	constexpr Keccak<R, P, D>& Keccak<R, P, D>::addData(const Byte (&array)[N])
 	{
 		return addData({array, N});
 	}
 
-	template <int R, int P>
+	template <int R, int P, int D>
 	template <typename T, std::size_t N>
-	Keccak<R, P>& Keccak<R, P>::addData(const T (&array)[N])
+	Keccak<R, P, D>& Keccak<R, P, D>::addData(const T (&array)[N])
 	{
 		return addData({reinterpret_cast<const Byte*>(array), (sizeof(T) * N)});
 	}
 
-	template <int R, int P>
+	template <int R, int P, int D>
 	template <typename T>
-	Keccak<R, P>& Keccak<R, P>::addData(const Span<T> inSpan)
+	Keccak<R, P, D>& Keccak<R, P, D>::addData(const Span<T> inSpan)
 	{
 		return addData({reinterpret_cast<const Byte*>(inSpan.data()), inSpan.size_bytes()});
 	}
 
-	template <int R, int P>
-	constexpr void Keccak<R, P>::addDataImpl(const Span<const Byte> data)
+	template <int R, int P, int D>
+	constexpr void Keccak<R, P, D>::addDataImpl(const Span<const Byte> data)
 	{
 		assert((data.size() % R) == 0);
 
@@ -473,10 +531,7 @@ namespace SHA3_NS
 		{
 			const Loader<uint64_t> m(static_cast<const Byte *>(data.data() + (iter * R)));
 			for (int i = 0; i < (R / 8); ++i)
-			{
- 				uint64_t *statePtr = reinterpret_cast<uint64_t *>(m_state);
- 				statePtr[i] ^= m[i];
-			}
+				m_state[i / 5][i % 5] ^= m[i];
 
 			const auto roundFunction = [this](const int indexRound)
 			{
@@ -514,39 +569,39 @@ namespace SHA3_NS
 					const uint64_t tmp[5][5] =
 					{
 						{
-							rotl(m_state[0][0], (  0 % m_params.w)),
-							rotl(m_state[1][1], (300 % m_params.w)),
-							rotl(m_state[2][2], (171 % m_params.w)),
-							rotl(m_state[3][3], ( 21 % m_params.w)),
-							rotl(m_state[4][4], ( 78 % m_params.w))
+							rotl(m_state[0][0], (  0 % W)),
+							rotl(m_state[1][1], (300 % W)),
+							rotl(m_state[2][2], (171 % W)),
+							rotl(m_state[3][3], ( 21 % W)),
+							rotl(m_state[4][4], ( 78 % W))
 						},
 						{
-							rotl(m_state[0][3], ( 28 % m_params.w)),
-							rotl(m_state[1][4], (276 % m_params.w)),
-							rotl(m_state[2][0], (  3 % m_params.w)),
-							rotl(m_state[3][1], ( 45 % m_params.w)),
-							rotl(m_state[4][2], (253 % m_params.w))
+							rotl(m_state[0][3], ( 28 % W)),
+							rotl(m_state[1][4], (276 % W)),
+							rotl(m_state[2][0], (  3 % W)),
+							rotl(m_state[3][1], ( 45 % W)),
+							rotl(m_state[4][2], (253 % W))
 						},
 						{
-							rotl(m_state[0][1], (  1 % m_params.w)),
-							rotl(m_state[1][2], (  6 % m_params.w)),
-							rotl(m_state[2][3], (153 % m_params.w)),
-							rotl(m_state[3][4], (136 % m_params.w)),
-							rotl(m_state[4][0], (210 % m_params.w))
+							rotl(m_state[0][1], (  1 % W)),
+							rotl(m_state[1][2], (  6 % W)),
+							rotl(m_state[2][3], (153 % W)),
+							rotl(m_state[3][4], (136 % W)),
+							rotl(m_state[4][0], (210 % W))
 						},
 						{
-							rotl(m_state[0][4], ( 91 % m_params.w)),
-							rotl(m_state[1][0], ( 36 % m_params.w)),
-							rotl(m_state[2][1], ( 10 % m_params.w)),
-							rotl(m_state[3][2], ( 15 % m_params.w)),
-							rotl(m_state[4][3], (120 % m_params.w))
+							rotl(m_state[0][4], ( 91 % W)),
+							rotl(m_state[1][0], ( 36 % W)),
+							rotl(m_state[2][1], ( 10 % W)),
+							rotl(m_state[3][2], ( 15 % W)),
+							rotl(m_state[4][3], (120 % W))
 						},
 						{
-							rotl(m_state[0][2], (190 % m_params.w)),
-							rotl(m_state[1][3], ( 55 % m_params.w)),
-							rotl(m_state[2][4], (231 % m_params.w)),
-							rotl(m_state[3][0], (105 % m_params.w)),
-							rotl(m_state[4][1], ( 66 % m_params.w))
+							rotl(m_state[0][2], (190 % W)),
+							rotl(m_state[1][3], ( 55 % W)),
+							rotl(m_state[2][4], (231 % W)),
+							rotl(m_state[3][0], (105 % W)),
+							rotl(m_state[4][1], ( 66 % W))
 						}
 					};
 					// chi
@@ -561,14 +616,6 @@ namespace SHA3_NS
 				};
 				const auto iota = [this](const int indexRound)
 				{
-					static const uint64_t roundConstantTable[24] =
-					{
-						0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000, 0x000000000000808B, 0x0000000080000001,
-						0x8000000080008081, 0x8000000000008009, 0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
-						0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
-						0x000000000000800A, 0x800000008000000A, 0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
-					};
-
 					m_state[0][0] ^= roundConstantTable[indexRound];
 				};
 
@@ -581,23 +628,6 @@ namespace SHA3_NS
 				roundFunction(i);
 		}
 	}
-
-	template <int R, int P>
-	std::vector<typename Keccak<R, P>::Byte> Keccak<R, P>::stateToVector() const
-	{
-		const Span<const uint64_t> state(reinterpret_cast<const uint64_t *>(m_state), 25);
-		const int dataSize = sizeof(typename decltype(state)::value_type);
-
-		std::vector<Byte> ret;
-		ret.reserve(dataSize * state.size());
-		for (const auto i : state)
-		{
-			for (int j = 0; j < dataSize; ++j)
-				ret.emplace_back(ror<Byte>(i, (j * 8)));
-		}
-
-		return ret;
-	}
 }
 }
 
@@ -611,10 +641,10 @@ namespace SHA3_NS
 		KeccakAlias& operator=(const Base &other) { if (this != &other) { Base::operator=(other); } return *this; }
 		KeccakAlias& operator=(Base &&other) noexcept { if (this != &other) { Base::operator=(std::move(other)); } return *this; }
 	};
-	using SHA3_224 = KeccakAlias<Hash::SHA3_NS::Keccak<(1152 / 8), 0x06>, (224 / 8)>;
-	using SHA3_256 = KeccakAlias<Hash::SHA3_NS::Keccak<(1088 / 8), 0x06>, (256 / 8)>;
-	using SHA3_384 = KeccakAlias<Hash::SHA3_NS::Keccak<(832 / 8), 0x06>, (384 / 8)>;
-	using SHA3_512 = KeccakAlias<Hash::SHA3_NS::Keccak<(576 / 8), 0x06>, (512 / 8)>;
+	using SHA3_224 = KeccakAlias<Hash::SHA3_NS::Keccak<(1152 / 8), 0x06, (224 / 8)>, (224 / 8)>;
+	using SHA3_256 = KeccakAlias<Hash::SHA3_NS::Keccak<(1088 / 8), 0x06, (256 / 8)>, (256 / 8)>;
+	using SHA3_384 = KeccakAlias<Hash::SHA3_NS::Keccak<(832 / 8), 0x06, (384 / 8)>, (384 / 8)>;
+	using SHA3_512 = KeccakAlias<Hash::SHA3_NS::Keccak<(576 / 8), 0x06, (512 / 8)>, (512 / 8)>;
 
 	template <typename Base>
 	struct SHAKEAlias : Base
@@ -628,14 +658,74 @@ namespace SHA3_NS
 	};
 	using SHAKE_128 = SHAKEAlias<Hash::SHA3_NS::Keccak<(1344 / 8), 0x1F>>;
 	using SHAKE_256 = SHAKEAlias<Hash::SHA3_NS::Keccak<(1088 / 8), 0x1F>>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::SHA3_NS::Keccak<(1152 / 8), 0x06, (224 / 8)>;
+	extern template class Hash::SHA3_NS::Keccak<(1088 / 8), 0x06, (256 / 8)>;
+	extern template class Hash::SHA3_NS::Keccak<(832 / 8), 0x06, (384 / 8)>;
+	extern template class Hash::SHA3_NS::Keccak<(576 / 8), 0x06, (512 / 8)>;
+	extern template class Hash::SHA3_NS::Keccak<(1344 / 8), 0x1F>;
+	extern template class Hash::SHA3_NS::Keccak<(1088 / 8), 0x1F>;
+#endif
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval SHA3_224::ResultArrayType operator""_sha3_224(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<SHA3_224>(str, length);
+	}
+
+	consteval SHA3_256::ResultArrayType operator""_sha3_256(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<SHA3_256>(str, length);
+	}
+
+	consteval SHA3_384::ResultArrayType operator""_sha3_384(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<SHA3_384>(str, length);
+	}
+
+	consteval SHA3_512::ResultArrayType operator""_sha3_512(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<SHA3_512>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
-	template <int R, int P>
-	struct hash<Chocobo1::Hash::SHA3_NS::Keccak<R, P>>
+	template <int R, int P, int D>
+	struct hash<Chocobo1::Hash::SHA3_NS::Keccak<R, P, D>>
 	{
-		size_t operator()(const Chocobo1::Hash::SHA3_NS::Keccak<R, P> &hash) const noexcept
+		size_t operator()(const Chocobo1::Hash::SHA3_NS::Keccak<R, P, D> &hash) const noexcept
 		{
 			return hash;
 		}
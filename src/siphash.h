@@ -40,6 +40,11 @@
 #include "gsl/span"
 #endif
 
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
 
 namespace Chocobo1
 {
@@ -158,8 +163,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -247,11 +256,10 @@ namespace SIPHASH_NS
 
 			static constexpr int BLOCK_SIZE = 8;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
-			uint8_t m_sizeCounter = 0;
-
-			uint64_t m_key[2] = {};
 			uint64_t m_state[4] = {};
+			uint64_t m_key[2] = {};
+			uint8_t m_sizeCounter = 0;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 	};
 
 
@@ -495,6 +503,11 @@ namespace SIPHASH_NS
 }
 
 	using SipHash = Hash::SIPHASH_NS::SipHash<2, 4>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::SIPHASH_NS::SipHash<2, 4>;
+#endif
 }
 
 namespace std
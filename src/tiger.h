@@ -40,6 +40,11 @@
 #include "gsl/span"
 #endif
 
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
 
 namespace Chocobo1
 {
@@ -51,6 +56,8 @@ namespace Chocobo1
 	// Tiger2_128();
 	// Tiger2_160();
 	// Tiger2_192();
+
+	// "abc"_tiger2_192;  // C++20, digest as `Tiger2_192::ResultArrayType` computed at compile time
 }
 
 
@@ -164,8 +171,12 @@ namespace Hash
 			}
 
 		private:
+			// a narrow fill counter, a block sized buffer only needs a byte most of the time
+			using counter_type = typename std::conditional<(N <= UINT8_MAX), uint8_t,
+				typename std::conditional<(N <= UINT16_MAX), uint16_t, index_type>::type>::type;
+
 			std::array<T, N> m_array {};
-			index_type m_dataEndIdx = 0;
+			counter_type m_dataEndIdx = 0;
 	};
 #endif
 
@@ -252,10 +263,9 @@ namespace Tiger_NS
 
 			static constexpr int BLOCK_SIZE = 64;
 
-			Buffer<Byte, (BLOCK_SIZE * 2)> m_buffer;  // x2 for paddings
-			uint64_t m_sizeCounter = 0;
-
 			uint64_t m_h[3] = {};
+			uint64_t m_sizeCounter = 0;
+			Buffer<Byte, BLOCK_SIZE> m_buffer;
 
 			static constexpr uint64_t tTable[4][256] =
 			{
@@ -456,19 +466,23 @@ namespace Tiger_NS
 	template <int V, int D>
 	constexpr Tiger<V, D>& Tiger<V, D>::finalize()
 	{
-		m_sizeCounter += m_buffer.size();
+		const uint64_t sizeCounterBits = ((m_sizeCounter + m_buffer.size()) * 8);
+		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
+		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 
 		// append 1 bit
 		m_buffer.fill((V == 1) ? 1 : (1 << 7));
 
-		// append paddings
-		const auto len = static_cast<int>(((2 * BLOCK_SIZE) - (m_buffer.size() + 8)) % BLOCK_SIZE);
-		m_buffer.fill(0, (len + 8));
+		// append paddings, the size field must fit in the last block
+		if (m_buffer.size() > (BLOCK_SIZE - 8))
+		{
+			m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
+			addDataImpl({m_buffer.data(), m_buffer.size()});
+			m_buffer.clear();
+		}
+		m_buffer.fill(0, static_cast<int>(BLOCK_SIZE - m_buffer.size()));
 
 		// append size in bits
-		const uint64_t sizeCounterBits = m_sizeCounter * 8;
-		const uint32_t sizeCounterBitsL = ror<uint32_t>(sizeCounterBits, 0);
-		const uint32_t sizeCounterBitsH = ror<uint32_t>(sizeCounterBits, 32);
 		for (int i = 0; i < 4; ++i)
 		{
 			m_buffer[m_buffer.size() - 8 + i] = ror<Byte>(sizeCounterBitsL, (8 * i));
@@ -690,8 +704,78 @@ namespace Tiger_NS
 	using Tiger2_128 = Hash::Tiger_NS::Tiger<2, 128>;
 	using Tiger2_160 = Hash::Tiger_NS::Tiger<2, 160>;
 	using Tiger2_192 = Hash::Tiger_NS::Tiger<2, 192>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::Tiger_NS::Tiger<1, 128>;
+	extern template class Hash::Tiger_NS::Tiger<1, 160>;
+	extern template class Hash::Tiger_NS::Tiger<1, 192>;
+	extern template class Hash::Tiger_NS::Tiger<2, 128>;
+	extern template class Hash::Tiger_NS::Tiger<2, 160>;
+	extern template class Hash::Tiger_NS::Tiger<2, 192>;
+#endif
 }
 
+#if (__cpp_consteval >= 201811L)
+namespace Chocobo1
+{
+namespace Hash
+{
+#ifndef CHOCOBO1_HASH_LITERAL_IMPL
+#define CHOCOBO1_HASH_LITERAL_IMPL
+	template <typename T>
+	consteval typename T::ResultArrayType hashLiteral(const char *str, const std::size_t length)
+	{
+		// `char` can't be reinterpreted as bytes in constant expressions, copy them over instead
+		T hasher;
+		uint8_t chunk[64] {};
+		for (std::size_t i = 0; i < length; i += sizeof(chunk))
+		{
+			const std::size_t size = ((length - i) < sizeof(chunk)) ? (length - i) : sizeof(chunk);
+			for (std::size_t j = 0; j < size; ++j)
+				chunk[j] = static_cast<uint8_t>(str[i + j]);
+			hasher.addData(typename T::template Span<const uint8_t>(chunk, size));
+		}
+		return hasher.finalize().toArray();
+	}
+#endif
+}
+
+inline namespace Literals
+{
+	consteval Tiger1_128::ResultArrayType operator""_tiger1_128(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Tiger1_128>(str, length);
+	}
+
+	consteval Tiger1_160::ResultArrayType operator""_tiger1_160(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Tiger1_160>(str, length);
+	}
+
+	consteval Tiger1_192::ResultArrayType operator""_tiger1_192(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Tiger1_192>(str, length);
+	}
+
+	consteval Tiger2_128::ResultArrayType operator""_tiger2_128(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Tiger2_128>(str, length);
+	}
+
+	consteval Tiger2_160::ResultArrayType operator""_tiger2_160(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Tiger2_160>(str, length);
+	}
+
+	consteval Tiger2_192::ResultArrayType operator""_tiger2_192(const char *str, const std::size_t length)
+	{
+		return Hash::hashLiteral<Tiger2_192>(str, length);
+	}
+}
+}
+#endif
+
 namespace std
 {
 	template <int V, int D>
@@ -0,0 +1,371 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_TREE_DIGEST_H
+#define CHOCOBO1_TREE_DIGEST_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+#ifndef USE_STD_FILESYSTEM_CHOCOBO1_HASH
+#if (__cplusplus >= 201703L) && defined(__has_include)
+#if __has_include(<filesystem>)
+#define USE_STD_FILESYSTEM_CHOCOBO1_HASH 1
+#endif
+#endif
+#endif
+#ifndef USE_STD_FILESYSTEM_CHOCOBO1_HASH
+#define USE_STD_FILESYSTEM_CHOCOBO1_HASH 0
+#endif
+
+#if (USE_STD_FILESYSTEM_CHOCOBO1_HASH == 1)
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// TreeDigest<SHA2_256>();
+	// TreeDigest<CSHAKE_128>(CSHAKE_128(32));  // classes without a default constructor take a prototype
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace TreeDigest_NS
+{
+	// `TupleHash` only has `nextData()`, everything else has `addData()`
+	template <typename T, typename = void>
+	struct HasAddData : std::false_type {};
+	template <typename T>
+	struct HasAddData<T, decltype(std::declval<T &>().addData(std::declval<const void *>(), std::size_t()), void())> : std::true_type {};
+
+	template <typename T>
+	void feed(T &hasher, const void *ptr, const std::size_t length, std::true_type)
+	{
+		hasher.addData(ptr, length);
+	}
+	template <typename T>
+	void feed(T &hasher, const void *ptr, const std::size_t length, std::false_type)
+	{
+		hasher.nextData(ptr, length);
+	}
+	template <typename T>
+	void feed(T &hasher, const void *ptr, const std::size_t length)
+	{
+		feed(hasher, ptr, length, HasAddData<T>());
+	}
+
+
+	template <typename T>
+	class TreeDigest
+	{
+		// Merkle root over a set of files, independent of the order they were added
+		//   leaf = H(0x00 || uint64_be(path size) || path || uint32_be(mode) || H(file content))
+		//   node = H(0x01 || left || right), an odd node at the end of a level is promoted as-is
+		// Leaves are sorted by path (byte-wise). An empty tree hashes to H("").
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename U, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<U, Extent>;
+#else
+			template <typename U, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<U, Extent>;
+#endif
+
+			explicit TreeDigest(const T &prototype = T());
+
+			void reset();
+			TreeDigest& finalize();  // after this, only `reset()`, `toString()`, `toVector()` are available
+
+			std::string toString() const;
+			std::vector<Byte> toVector() const;
+
+			// `path` should be relative & use '/' as separator, `fileDigest` is the digest of file content
+			TreeDigest& addEntry(const std::string &path, Span<const Byte> fileDigest, uint32_t mode = 0);
+			TreeDigest& addFile(const std::string &path, Span<const Byte> content, uint32_t mode = 0);
+
+#if (USE_STD_FILESYSTEM_CHOCOBO1_HASH == 1)
+			// Recursively adds the regular files under `dir`, content is hashed in parallel.
+			// Symlinks to files are followed, symlinks to directories are not.
+			// `threads == 0` means `std::thread::hardware_concurrency()`.
+			TreeDigest& addDirectory(const std::filesystem::path &dir, bool withMode = false, unsigned int threads = 0);
+#endif
+
+		private:
+			struct Entry
+			{
+				std::string path;
+				uint32_t mode = 0;
+				std::vector<Byte> digest;
+			};
+
+			std::vector<Byte> leafDigest(const Entry &entry) const;
+
+			T m_prototype;
+			std::vector<Entry> m_entries;
+			std::vector<Byte> m_root;
+	};
+
+
+	//
+	template <typename T>
+	TreeDigest<T>::TreeDigest(const T &prototype)
+		: m_prototype(prototype)
+	{
+	}
+
+	template <typename T>
+	void TreeDigest<T>::reset()
+	{
+		m_entries.clear();
+		m_root.clear();
+	}
+
+	template <typename T>
+	TreeDigest<T>& TreeDigest<T>::finalize()
+	{
+		std::stable_sort(m_entries.begin(), m_entries.end(), [](const Entry &left, const Entry &right) -> bool
+		{
+			return (left.path < right.path);
+		});
+
+		if (m_entries.empty())
+		{
+			T hasher = m_prototype;
+			m_root = hasher.finalize().toVector();
+			return (*this);
+		}
+
+		std::vector<std::vector<Byte>> level;
+		level.reserve(m_entries.size());
+		for (const Entry &entry : m_entries)
+			level.emplace_back(leafDigest(entry));
+
+		while (level.size() > 1)
+		{
+			std::vector<std::vector<Byte>> nextLevel;
+			nextLevel.reserve((level.size() + 1) / 2);
+			for (std::size_t i = 0; (i + 1) < level.size(); i += 2)
+			{
+				std::vector<Byte> node;
+				node.reserve(1 + level[i].size() + level[i + 1].size());
+				node.emplace_back(0x01);
+				node.insert(node.end(), level[i].begin(), level[i].end());
+				node.insert(node.end(), level[i + 1].begin(), level[i + 1].end());
+
+				T hasher = m_prototype;
+				feed(hasher, node.data(), node.size());
+				nextLevel.emplace_back(hasher.finalize().toVector());
+			}
+			if ((level.size() % 2) != 0)
+				nextLevel.emplace_back(std::move(level.back()));
+
+			level = std::move(nextLevel);
+		}
+
+		m_root = std::move(level.front());
+		return (*this);
+	}
+
+	template <typename T>
+	std::string TreeDigest<T>::toString() const
+	{
+		std::string ret;
+		ret.resize(2 * m_root.size());
+
+		auto *retPtr = &ret.front();
+		for (const auto c : m_root)
+		{
+			const Byte upper = static_cast<Byte>(c >> 4);
+			*(retPtr++) = static_cast<char>((upper < 10) ? (upper + '0') : (upper - 10 + 'a'));
+
+			const Byte lower = c & 0xf;
+			*(retPtr++) = static_cast<char>((lower < 10) ? (lower + '0') : (lower - 10 + 'a'));
+		}
+
+		return ret;
+	}
+
+	template <typename T>
+	std::vector<typename TreeDigest<T>::Byte> TreeDigest<T>::toVector() const
+	{
+		return m_root;
+	}
+
+	template <typename T>
+	TreeDigest<T>& TreeDigest<T>::addEntry(const std::string &path, const Span<const Byte> fileDigest, const uint32_t mode)
+	{
+		Entry entry;
+		entry.path = path;
+		entry.mode = mode;
+		entry.digest.assign(fileDigest.begin(), fileDigest.end());
+		m_entries.emplace_back(std::move(entry));
+		return (*this);
+	}
+
+	template <typename T>
+	TreeDigest<T>& TreeDigest<T>::addFile(const std::string &path, const Span<const Byte> content, const uint32_t mode)
+	{
+		T hasher = m_prototype;
+		feed(hasher, content.data(), content.size());
+		const std::vector<Byte> digest = hasher.finalize().toVector();
+		return addEntry(path, digest, mode);
+	}
+
+	template <typename T>
+	std::vector<typename TreeDigest<T>::Byte> TreeDigest<T>::leafDigest(const Entry &entry) const
+	{
+		std::vector<Byte> leaf;
+		leaf.reserve(1 + 8 + entry.path.size() + 4 + entry.digest.size());
+
+		leaf.emplace_back(0x00);
+		const uint64_t pathSize = entry.path.size();
+		for (int i = 7; i >= 0; --i)
+			leaf.emplace_back(static_cast<Byte>(pathSize >> (8 * i)));
+		leaf.insert(leaf.end(), entry.path.begin(), entry.path.end());
+		for (int i = 3; i >= 0; --i)
+			leaf.emplace_back(static_cast<Byte>(entry.mode >> (8 * i)));
+		leaf.insert(leaf.end(), entry.digest.begin(), entry.digest.end());
+
+		T hasher = m_prototype;
+		feed(hasher, leaf.data(), leaf.size());
+		return hasher.finalize().toVector();
+	}
+
+#if (USE_STD_FILESYSTEM_CHOCOBO1_HASH == 1)
+	template <typename T>
+	TreeDigest<T>& TreeDigest<T>::addDirectory(const std::filesystem::path &dir, const bool withMode, unsigned int threads)
+	{
+		namespace fs = std::filesystem;
+
+		const std::size_t firstNew = m_entries.size();
+		std::vector<fs::path> files;
+		for (const fs::directory_entry &dirEntry : fs::recursive_directory_iterator(dir))
+		{
+			const fs::file_status status = dirEntry.status();
+			if (!fs::is_regular_file(status))
+				continue;
+
+			Entry entry;
+			entry.path = dirEntry.path().lexically_relative(dir).generic_string();
+			entry.mode = withMode ? static_cast<uint32_t>(status.permissions()) : 0;
+			m_entries.emplace_back(std::move(entry));
+			files.emplace_back(dirEntry.path());
+		}
+
+		if (threads == 0)
+			threads = std::max(std::thread::hardware_concurrency(), 1u);
+		threads = static_cast<unsigned int>(std::min<std::size_t>(threads, files.size()));
+
+		std::atomic<std::size_t> nextFile {0};
+		std::exception_ptr error;
+		std::mutex errorMutex;
+
+		const auto worker = [&]() -> void
+		{
+			const std::size_t bufSize = 1024 * 1024;
+			auto buf = std::make_unique<char[]>(bufSize);
+			std::vector<char> whole;  // for `nextData()` hashers the file is a single element
+
+			for (std::size_t i = nextFile++; i < files.size(); i = nextFile++)
+			{
+				try
+				{
+					std::ifstream inStream(files[i], (std::ios_base::in | std::ios_base::binary));
+					if (!inStream)
+						throw fs::filesystem_error("cannot open file", files[i], std::make_error_code(std::errc::io_error));
+
+					T hasher = m_prototype;
+					whole.clear();
+					while (inStream.good())
+					{
+						inStream.read(buf.get(), bufSize);
+						const auto size = static_cast<std::size_t>(inStream.gcount());
+						if (HasAddData<T>::value)
+							feed(hasher, buf.get(), size);
+						else
+							whole.insert(whole.end(), buf.get(), (buf.get() + size));
+					}
+					if (!HasAddData<T>::value)
+						feed(hasher, whole.data(), whole.size());
+
+					m_entries[firstNew + i].digest = hasher.finalize().toVector();
+				}
+				catch (...)
+				{
+					const std::lock_guard<std::mutex> lock(errorMutex);
+					if (!error)
+						error = std::current_exception();
+					nextFile = files.size();
+				}
+			}
+		};
+
+		std::vector<std::thread> pool;
+		for (unsigned int i = 1; i < threads; ++i)
+			pool.emplace_back(worker);
+		worker();
+		for (std::thread &t : pool)
+			t.join();
+
+		if (error)
+		{
+			m_entries.resize(firstNew);
+			std::rethrow_exception(error);
+		}
+		return (*this);
+	}
+#endif
+}
+}
+	template <typename T>
+	using TreeDigest = Hash::TreeDigest_NS::TreeDigest<T>;
+}
+
+#endif  // CHOCOBO1_TREE_DIGEST_H
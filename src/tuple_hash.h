@@ -15,7 +15,6 @@
 #include "cshake.h"
 
 #include <climits>
-#include <cmath>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -38,6 +37,11 @@
 #include "gsl/span"
 #endif
 
+// define to 1 when linking the prebuilt library in "src/library", common instantiations are then compiled only once
+#ifndef USE_EXTERN_TEMPLATE_CHOCOBO1_HASH
+#define USE_EXTERN_TEMPLATE_CHOCOBO1_HASH 0
+#endif
+
 
 namespace Chocobo1
 {
@@ -83,13 +87,14 @@ namespace TupleHash_NS
 #endif
 
 
-			explicit constexpr TupleHash(int digestLength, const std::string &customize = {});
+			explicit CONSTEXPR_CPP20_CHOCOBO1_HASH TupleHash(int digestLength, const std::string &customize = {});
 
 			constexpr void reset();
-			constexpr TupleHash& finalize();  // after this, only `operator T()`, `reset()`, `toString()`, `toVector()` are available
+			constexpr TupleHash& finalize();  // after this, only `operator T()`, `reset()`, `toSpan()`, `toString()`, `toVector()` are available
 
 			std::string toString() const;
-			std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP20_CHOCOBO1_HASH std::vector<Byte> toVector() const;
+			CONSTEXPR_CPP17_CHOCOBO1_HASH void toSpan(Span<Byte> output) const;  // writes the first `output.size()` bytes of output
 			template <typename T>
 			operator T() const noexcept;
 
@@ -120,22 +125,25 @@ namespace TupleHash_NS
 
 
 	// helpers
-	const auto rightEncode = [](const uint64_t value) -> Buffer<uint8_t, sizeof(value)>
+	inline CONSTEXPR_CPP17_CHOCOBO1_HASH Buffer<uint8_t, (sizeof(uint64_t) + 1)> rightEncode(const uint64_t value)
 	{
-		const uint8_t n = (value == 0) ? 1 : static_cast<uint8_t>(std::lround((std::log2(value) / 8) + 0.5));
+		// number of bytes needed to represent `value`, at least 1
+		uint8_t n = 1;
+		while ((n < sizeof(value)) && ((value >> (8 * n)) != 0))
+			++n;
 
-		Buffer<uint8_t, sizeof(value)> ret;
+		Buffer<uint8_t, (sizeof(value) + 1)> ret;
 		for (int i = (n - 1); i >= 0; --i)
-			ret.fill(ror<uint8_t>(value, (8 * i)));
+			ret.fill(ror<uint8_t>(value, static_cast<unsigned int>(8 * i)));
 		ret.fill(n);
 
 		return ret;
-	};
+	}
 
 
 	//
 	template <typename Alg>
-	constexpr TupleHash<Alg>::TupleHash(const int digestLength, const std::string &customize)
+	CONSTEXPR_CPP20_CHOCOBO1_HASH TupleHash<Alg>::TupleHash(const int digestLength, const std::string &customize)
 		: m_cshake(digestLength, "TupleHash", customize)
 		, m_digestLength(digestLength)
 	{
@@ -164,11 +172,17 @@ namespace TupleHash_NS
 	}
 
 	template <typename Alg>
-	std::vector<typename TupleHash<Alg>::Byte> TupleHash<Alg>::toVector() const
+	CONSTEXPR_CPP20_CHOCOBO1_HASH std::vector<typename TupleHash<Alg>::Byte> TupleHash<Alg>::toVector() const
 	{
 		return m_cshake.toVector();
 	}
 
+	template <typename Alg>
+	CONSTEXPR_CPP17_CHOCOBO1_HASH void TupleHash<Alg>::toSpan(const Span<Byte> output) const
+	{
+		m_cshake.toSpan(output);
+	}
+
 	template <typename Alg>
 	template <typename T>
 	TupleHash<Alg>::operator T() const noexcept
@@ -235,7 +249,7 @@ namespace TupleHash_NS
 	struct TupleHashAlias : Base
 	{
 		using BaseType = Base;
-		explicit constexpr TupleHashAlias(const int l, const std::string &c = {}) : Base(l, c) {}
+		explicit CONSTEXPR_CPP20_CHOCOBO1_HASH TupleHashAlias(const int l, const std::string &c = {}) : Base(l, c) {}
 		TupleHashAlias(const Base &other) : Base(other) {}
 		TupleHashAlias(Base &&other) noexcept : Base(std::move(other)) {}
 		TupleHashAlias& operator=(const Base &other) { if (this != &other) { Base::operator=(other); } return *this; }
@@ -243,6 +257,12 @@ namespace TupleHash_NS
 	};
 	using TupleHash_128 = TupleHashAlias<Hash::TupleHash_NS::TupleHash<CSHAKE_128>>;
 	using TupleHash_256 = TupleHashAlias<Hash::TupleHash_NS::TupleHash<CSHAKE_256>>;
+
+#if (USE_EXTERN_TEMPLATE_CHOCOBO1_HASH == 1)
+	// instantiated once in "src/library/instantiations.cpp"
+	extern template class Hash::TupleHash_NS::TupleHash<CSHAKE_128>;
+	extern template class Hash::TupleHash_NS::TupleHash<CSHAKE_256>;
+#endif
 }
 
 namespace std
@@ -0,0 +1,364 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_VALUE_HASH_H
+#define CHOCOBO1_VALUE_HASH_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// ValueHash<SHA2_256>().addValue(uint64_t(42)).addValues(values, count).finalize().toArray();
+	// ValueHash<SHA2_256, ByteOrder::Big>();  // little endian is the default
+	// ValueHash<CSHAKE_128>(CSHAKE_128(32));  // classes without a default constructor take a prototype
+
+	// valueHash.addValue(std::make_tuple(id, offset, name));  // tuples, pairs, arrays & strings nest
+	// valueHash.addMembers(record, &Record::id, &Record::offset, &Record::flags);
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace ValueHash_NS
+{
+	enum class ByteOrder
+	{
+		Little,
+		Big
+	};
+
+	inline bool isLittleEndianHost()
+	{
+		const uint16_t probe = 1;
+		uint8_t firstByte = 0;
+		std::memcpy(&firstByte, &probe, 1);
+		return (firstByte == 1);
+	}
+
+	// unsigned integer of the same size, the value's bits are encoded through it
+	template <typename V, typename = void>
+	struct Encoding;
+	template <typename V>
+	struct Encoding<V, typename std::enable_if<std::is_integral<V>::value>::type>
+	{
+		using Type = typename std::make_unsigned<V>::type;
+	};
+	template <>
+	struct Encoding<bool>
+	{
+		using Type = uint8_t;
+	};
+	template <typename V>
+	struct Encoding<V, typename std::enable_if<std::is_enum<V>::value>::type>
+	{
+		using Type = typename std::make_unsigned<typename std::underlying_type<V>::type>::type;
+	};
+	template <>
+	struct Encoding<float>
+	{
+		using Type = uint32_t;
+	};
+	template <>
+	struct Encoding<double>
+	{
+		using Type = uint64_t;
+	};
+
+	template <typename V>
+	using IsScalar = std::integral_constant<bool, (std::is_arithmetic<V>::value || std::is_enum<V>::value)>;
+
+
+	template <typename T, ByteOrder Order = ByteOrder::Little>
+	class ValueHash
+	{
+		// Feeds values to `T` in a canonical encoding, independent of padding & host endianness:
+		//   integers, enums & bool: `sizeof` bytes in `Order`, bool as 0 or 1
+		//   float & double: their IEEE-754 bit pattern, like an integer of the same size
+		//   strings: uint64 byte count, then the bytes
+		//   tuples, pairs, arrays & `addMembers()`: the elements one after another, without any framing
+		// Values are staged in a small buffer & handed to `T` a few blocks at a time, so `TupleHash`
+		// (where every `nextData()` call is an element) is not supported.
+
+		public:
+			using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+			template <typename U, std::size_t Extent = std::dynamic_extent>
+			using Span = std::span<U, Extent>;
+#else
+			template <typename U, std::size_t Extent = gsl::dynamic_extent>
+			using Span = gsl::span<U, Extent>;
+#endif
+
+			explicit ValueHash(const T &prototype = T());
+
+			void reset();
+			T& finalize();  // returns the finalized hasher, get the digest from it
+			T& hasher();  // the hasher with every value added so far
+
+			template <typename V>
+			typename std::enable_if<IsScalar<V>::value, ValueHash&>::type addValue(V value);
+			ValueHash& addValue(const std::string &value);
+			template <typename... Vs>
+			ValueHash& addValue(const std::tuple<Vs...> &value);
+			template <typename V1, typename V2>
+			ValueHash& addValue(const std::pair<V1, V2> &value);
+			template <typename V, std::size_t N>
+			ValueHash& addValue(const std::array<V, N> &value);
+
+			template <typename V>
+			ValueHash& addValues(const V *values, std::size_t count);
+			template <typename V>
+			ValueHash& addValues(Span<V> values);
+
+			template <typename C, typename... Ms>
+			ValueHash& addMembers(const C &object, Ms C::*... members);
+
+			ValueHash& addData(const void *ptr, std::size_t length);  // raw bytes, as is
+
+		private:
+			template <typename U>
+			void put(U bits);
+			template <typename V>
+			void addValuesImpl(const V *values, std::size_t count, std::true_type);
+			template <typename V>
+			void addValuesImpl(const V *values, std::size_t count, std::false_type);
+			template <typename Tuple, std::size_t... I>
+			void addTupleImpl(const Tuple &value, std::index_sequence<I...>);
+			void flush();
+
+			static constexpr std::size_t BUFFER_SIZE = 512;  // a few blocks of every algorithm here
+
+			T m_hasher;
+			std::size_t m_size = 0;
+			Byte m_buffer[BUFFER_SIZE];
+	};
+
+
+	//
+	template <typename T, ByteOrder Order>
+	ValueHash<T, Order>::ValueHash(const T &prototype)
+		: m_hasher(prototype)
+	{
+	}
+
+	template <typename T, ByteOrder Order>
+	void ValueHash<T, Order>::reset()
+	{
+		m_hasher.reset();
+		m_size = 0;
+	}
+
+	template <typename T, ByteOrder Order>
+	T& ValueHash<T, Order>::finalize()
+	{
+		flush();
+		m_hasher.finalize();
+		return m_hasher;
+	}
+
+	template <typename T, ByteOrder Order>
+	T& ValueHash<T, Order>::hasher()
+	{
+		flush();
+		return m_hasher;
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename V>
+	typename std::enable_if<IsScalar<V>::value, ValueHash<T, Order>&>::type ValueHash<T, Order>::addValue(const V value)
+	{
+		using U = typename Encoding<V>::Type;
+		static_assert((sizeof(U) == sizeof(V)), "Unsupported type");
+
+		U bits = 0;
+		if (std::is_same<V, bool>::value)
+			bits = static_cast<U>((value != V()) ? 1 : 0);
+		else
+			std::memcpy(&bits, &value, sizeof(bits));
+		put(bits);
+		return (*this);
+	}
+
+	template <typename T, ByteOrder Order>
+	ValueHash<T, Order>& ValueHash<T, Order>::addValue(const std::string &value)
+	{
+		addValue(static_cast<uint64_t>(value.size()));
+		return addData(value.data(), value.size());
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename... Vs>
+	ValueHash<T, Order>& ValueHash<T, Order>::addValue(const std::tuple<Vs...> &value)
+	{
+		addTupleImpl(value, std::index_sequence_for<Vs...>());
+		return (*this);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename V1, typename V2>
+	ValueHash<T, Order>& ValueHash<T, Order>::addValue(const std::pair<V1, V2> &value)
+	{
+		addValue(value.first);
+		return addValue(value.second);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename V, std::size_t N>
+	ValueHash<T, Order>& ValueHash<T, Order>::addValue(const std::array<V, N> &value)
+	{
+		return addValues(value.data(), N);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename V>
+	ValueHash<T, Order>& ValueHash<T, Order>::addValues(const V *values, const std::size_t count)
+	{
+		addValuesImpl(values, count, std::integral_constant<bool, (IsScalar<V>::value && !std::is_same<V, bool>::value)>());
+		return (*this);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename V>
+	ValueHash<T, Order>& ValueHash<T, Order>::addValues(const Span<V> values)
+	{
+		return addValues(values.data(), static_cast<std::size_t>(values.size()));
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename C, typename... Ms>
+	ValueHash<T, Order>& ValueHash<T, Order>::addMembers(const C &object, Ms C::*... members)
+	{
+		const int expand[] = {0, ((void)addValue(object.*members), 0)...};
+		static_cast<void>(expand);
+		return (*this);
+	}
+
+	template <typename T, ByteOrder Order>
+	ValueHash<T, Order>& ValueHash<T, Order>::addData(const void *ptr, std::size_t length)
+	{
+		const Byte *data = static_cast<const Byte *>(ptr);
+		if (length >= BUFFER_SIZE)
+		{
+			flush();
+			m_hasher.addData(data, length);
+			return (*this);
+		}
+
+		while (length > 0)
+		{
+			const std::size_t size = std::min(length, (BUFFER_SIZE - m_size));
+			std::memcpy((m_buffer + m_size), data, size);
+			m_size += size;
+			data += size;
+			length -= size;
+			if (m_size == BUFFER_SIZE)
+				flush();
+		}
+		return (*this);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename U>
+	void ValueHash<T, Order>::put(const U bits)
+	{
+		if ((BUFFER_SIZE - m_size) < sizeof(U))
+			flush();
+
+		Byte *out = m_buffer + m_size;
+		for (std::size_t i = 0; i < sizeof(U); ++i)
+		{
+			const std::size_t shift = (Order == ByteOrder::Little) ? (8 * i) : (8 * (sizeof(U) - 1 - i));
+			out[i] = static_cast<Byte>(bits >> shift);
+		}
+		m_size += sizeof(U);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename V>
+	void ValueHash<T, Order>::addValuesImpl(const V *values, const std::size_t count, std::true_type)
+	{
+		// scalars: copied in bulk when the host already has the right byte order
+		const bool hostOrder = (isLittleEndianHost() == (Order == ByteOrder::Little));
+		if (hostOrder)
+		{
+			addData(values, (count * sizeof(V)));
+			return;
+		}
+
+		for (std::size_t i = 0; i < count; ++i)
+			addValue(values[i]);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename V>
+	void ValueHash<T, Order>::addValuesImpl(const V *values, const std::size_t count, std::false_type)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			addValue(values[i]);
+	}
+
+	template <typename T, ByteOrder Order>
+	template <typename Tuple, std::size_t... I>
+	void ValueHash<T, Order>::addTupleImpl(const Tuple &value, std::index_sequence<I...>)
+	{
+		const int expand[] = {0, ((void)addValue(std::get<I>(value)), 0)...};
+		static_cast<void>(expand);
+	}
+
+	template <typename T, ByteOrder Order>
+	void ValueHash<T, Order>::flush()
+	{
+		if (m_size == 0)
+			return;
+		m_hasher.addData(m_buffer, m_size);
+		m_size = 0;
+	}
+}
+}
+	using ByteOrder = Hash::ValueHash_NS::ByteOrder;
+	template <typename T, ByteOrder Order = ByteOrder::Little>
+	using ValueHash = Hash::ValueHash_NS::ValueHash<T, Order>;
+}
+
+#endif  // CHOCOBO1_VALUE_HASH_H
@@ -0,0 +1,703 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#ifndef CHOCOBO1_VERITY_H
+#define CHOCOBO1_VERITY_H
+
+#include "mapped_file.h"
+#include "multi_buffer.h"
+#include "sha2_256.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if (__cplusplus > 201703L)
+#include <version>
+#endif
+
+#ifndef USE_STD_SPAN_CHOCOBO1_HASH
+#if (__cpp_lib_span >= 202002L)
+#define USE_STD_SPAN_CHOCOBO1_HASH 1
+#else
+#define USE_STD_SPAN_CHOCOBO1_HASH 0
+#endif
+#endif
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+#include <span>
+#else
+#include "gsl/span"
+#endif
+
+
+namespace Chocobo1
+{
+	// Use these!!
+	// VerityTree(salt).build(image);  // `image` is whole 4 KiB data blocks
+	// VerityTree(salt).setUuid(uuid).buildFile("rootfs.img");  // the image is mmaped, levels are hashed in parallel
+	// tree.rootHash();  tree.rootHashString();  tree.hashArea();  // write `hashArea()` to the hash device
+	// VerityVerifier(hashArea, rootHash).verify(image, firstBlock, blockCount);  // only the paths of the blocks are checked
+
+	// Same result as `veritysetup format --hash=sha256 --format=1`:
+	//   digest of a block = SHA2_256(salt || block)
+	//   the superblock takes the first hash block, then the levels follow from the top one down to the data digests
+	//   a hash block holds `hashBlockSize / 32` digests & is zero padded
+	//   the root hash is the digest of the single top hash block (of data block 0 for a single block image)
+}
+
+
+namespace Chocobo1
+{
+// users should ignore things in this namespace
+
+namespace Hash
+{
+namespace Verity_NS
+{
+	using Byte = uint8_t;
+
+#if (USE_STD_SPAN_CHOCOBO1_HASH == 1)
+	template <typename T, std::size_t Extent = std::dynamic_extent>
+	using Span = std::span<T, Extent>;
+#else
+	template <typename T, std::size_t Extent = gsl::dynamic_extent>
+	using Span = gsl::span<T, Extent>;
+#endif
+
+	constexpr std::size_t DIGEST_SIZE = 32;
+	constexpr std::size_t SUPERBLOCK_SIZE = 512;
+	constexpr std::size_t MAX_SALT_SIZE = 256;
+	constexpr uint32_t MIN_BLOCK_SIZE = 512;
+	constexpr uint32_t MAX_BLOCK_SIZE = 512 * 1024;
+	constexpr int LANES = 8;
+
+	inline bool isBlockSizeValid(const uint32_t size)
+	{
+		return ((size >= MIN_BLOCK_SIZE) && (size <= MAX_BLOCK_SIZE) && ((size & (size - 1)) == 0));
+	}
+
+	inline uint64_t loadLE(const Byte *ptr, const int bytes)
+	{
+		uint64_t ret = 0;
+		for (int i = (bytes - 1); i >= 0; --i)
+			ret = (ret << 8) | ptr[i];
+		return ret;
+	}
+
+	inline void storeLE(Byte *ptr, const uint64_t value, const int bytes)
+	{
+		for (int i = 0; i < bytes; ++i)
+			ptr[i] = ror<Byte>(value, static_cast<unsigned int>(8 * i));
+	}
+
+	struct Layout
+	{
+		// position of every level in the hash area, in hash blocks
+		// level 0 holds the data block digests, level `levels - 1` is a single block hashed into the root
+
+		static constexpr int MAX_LEVELS = 64;
+
+		uint64_t dataBlocks = 0;
+		unsigned int digestBits = 0;  // log2(digests per hash block)
+		int levels = 0;
+		uint64_t levelBlock[MAX_LEVELS] = {};
+		uint64_t levelSize[MAX_LEVELS] = {};
+		uint64_t hashBlocks = 0;  // including the superblock
+
+		bool init(const uint64_t blocks, const uint32_t hashBlockSize, const bool superblock)
+		{
+			if ((blocks == 0) || !isBlockSizeValid(hashBlockSize))
+				return false;
+
+			dataBlocks = blocks;
+			digestBits = 0;
+			while ((std::size_t(1) << (digestBits + 1)) <= (hashBlockSize / DIGEST_SIZE))
+				++digestBits;
+
+			levels = 0;
+			while (((digestBits * static_cast<unsigned int>(levels)) < 64) && (((dataBlocks - 1) >> (digestBits * static_cast<unsigned int>(levels))) > 0))
+				++levels;
+
+			uint64_t position = superblock ? 1 : 0;
+			for (int i = (levels - 1); i >= 0; --i)
+			{
+				const unsigned int shift = digestBits * static_cast<unsigned int>(i + 1);
+				levelBlock[i] = position;
+				levelSize[i] = (shift >= 64) ? 1 : (((dataBlocks - 1) >> shift) + 1);
+				position += levelSize[i];
+			}
+			hashBlocks = position;
+			return true;
+		}
+	};
+
+	template <int Lanes>
+	class SaltedHasher
+	{
+		// SHA2_256(salt || block) of many equal sized blocks, one block per lane.
+		// Whole 64-byte blocks of the salt are compressed once into a midstate. The rest of the salt goes into a staging
+		// block with the start of the input, the following 64-byte chunks are read straight from the input.
+
+		public:
+			SaltedHasher(Span<const Byte> salt, std::size_t blockSize);
+
+			// output `i` (32 bytes at `output + 32 * i`) is the digest of the block at `input + stride * i`
+			void hash(const Byte *input, std::size_t stride, std::size_t count, Byte *output) const;
+
+		private:
+			template <int L>
+			void hashGroup(const Byte *input, std::size_t stride, int active, Byte *output) const;
+
+			using MidstateCompressor = MultiBuffer_NS::Kernel<SHA2_256, 1>;
+
+			static constexpr std::size_t BLOCK_SIZE = 64;
+
+			uint32_t m_midstate[8] = {};
+			Byte m_saltTail[BLOCK_SIZE] = {};
+			std::size_t m_saltTailSize = 0;
+			std::size_t m_blockSize = 0;
+			uint64_t m_messageBits = 0;
+	};
+
+	// runs `task(begin, end)` over [0, count) in pieces of `grain`, the caller's thread takes part
+	template <typename F>
+	void parallelFor(const uint64_t count, const uint64_t grain, const unsigned int threads, const F &task)
+	{
+		const uint64_t pieces = (count + grain - 1) / grain;
+		const unsigned int workers = static_cast<unsigned int>(std::min<uint64_t>(std::max(threads, 1u), pieces));
+		if (workers <= 1)
+		{
+			if (count > 0)
+				task(0, count);
+			return;
+		}
+
+		std::atomic<uint64_t> nextPiece {0};
+		const auto worker = [&]() -> void
+		{
+			for (uint64_t i = nextPiece++; i < pieces; i = nextPiece++)
+				task((i * grain), std::min((i + 1) * grain, count));
+		};
+
+		std::vector<std::thread> pool;
+		for (unsigned int i = 1; i < workers; ++i)
+			pool.emplace_back(worker);
+		worker();
+		for (std::thread &t : pool)
+			t.join();
+	}
+
+
+	class VerityTree
+	{
+		public:
+			explicit VerityTree(Span<const Byte> salt = {}, uint32_t dataBlockSize = 4096, uint32_t hashBlockSize = 4096);
+
+			VerityTree& setUuid(Span<const Byte, 16> uuid);  // recorded in the superblock, default is all zeros
+			VerityTree& setSuperblock(bool enabled);  // `false` is `veritysetup --no-superblock`
+			VerityTree& setThreads(unsigned int threads);  // default: the number of cores
+
+			// `false` for bad parameters (block sizes are powers of 2 in [512, 512 KiB], salt is at most 256 bytes)
+			// or when the last build failed
+			bool isValid() const;
+
+			// `image` should be one or more whole data blocks
+			VerityTree& build(Span<const Byte> image);
+			VerityTree& buildFile(const std::string &path);
+
+			uint64_t dataBlocks() const;
+			std::vector<Byte> rootHash() const;  // empty when not built
+			std::string rootHashString() const;  // hex, as printed by `veritysetup`
+			Span<const Byte> hashArea() const;  // superblock (if enabled) + hash levels
+
+		private:
+			void writeSuperblock(Byte *ptr) const;
+
+			std::vector<Byte> m_salt;
+			uint32_t m_dataBlockSize = 0;
+			uint32_t m_hashBlockSize = 0;
+			Byte m_uuid[16] = {};
+			bool m_superblock = true;
+			unsigned int m_threads = 0;
+			bool m_paramsValid = false;
+			bool m_buildFailed = false;
+
+			Layout m_layout;
+			std::vector<Byte> m_hashArea;
+			std::vector<Byte> m_rootHash;
+	};
+
+	class VerityVerifier
+	{
+		// Checks data blocks against a hash area & a trusted root hash.
+		// Only the hash blocks on the paths of the requested blocks are read, each at most once per call.
+		// `hashArea` is referenced, not copied, it should outlive the verifier.
+
+		public:
+			// `hashArea` starts with the superblock, the parameters are read from it
+			VerityVerifier(Span<const Byte> hashArea, Span<const Byte> rootHash);
+			// hash area without a superblock
+			VerityVerifier(Span<const Byte> hashArea, Span<const Byte> rootHash, uint64_t dataBlocks
+				, Span<const Byte> salt, uint32_t dataBlockSize = 4096, uint32_t hashBlockSize = 4096);
+
+			VerityVerifier& setThreads(unsigned int threads);  // default: 1
+
+			bool isValid() const;  // `false` for a bad superblock, parameters or a too short hash area
+
+			uint64_t dataBlocks() const;
+			uint32_t dataBlockSize() const;
+
+			// checks data blocks [firstBlock, firstBlock + blockCount) of the whole image `image`
+			bool verify(Span<const Byte> image, uint64_t firstBlock, uint64_t blockCount = 1) const;
+			// `block` is the content of data block `index` alone, e.g. read with `pread()`
+			bool verifyBlock(uint64_t index, Span<const Byte> block) const;
+
+		private:
+			void init(Span<const Byte> hashArea, Span<const Byte> rootHash, uint64_t dataBlocks
+				, Span<const Byte> salt, uint32_t dataBlockSize, uint32_t hashBlockSize, bool superblock);
+
+			// `data` points to the content of block `firstBlock`
+			bool verifyRange(const Byte *data, uint64_t firstBlock, uint64_t blockCount) const;
+			bool verifyPath(const SaltedHasher<LANES> &hasher, uint64_t hashBlock, uint64_t (&verified)[Layout::MAX_LEVELS]) const;
+
+			const Byte *m_hashArea = nullptr;
+			Byte m_rootHash[DIGEST_SIZE] = {};
+			std::vector<Byte> m_salt;
+			uint32_t m_dataBlockSize = 0;
+			uint32_t m_hashBlockSize = 0;
+			unsigned int m_threads = 1;
+			bool m_valid = false;
+
+			Layout m_layout;
+	};
+
+
+	//
+	template <int Lanes>
+	SaltedHasher<Lanes>::SaltedHasher(const Span<const Byte> salt, const std::size_t blockSize)
+		: m_saltTailSize(static_cast<std::size_t>(salt.size()) % BLOCK_SIZE)
+		, m_blockSize(blockSize)
+		, m_messageBits((static_cast<uint64_t>(salt.size()) + blockSize) * 8)
+	{
+		static_assert((Lanes > 0), "Template parameter value invalid: Lanes");
+		assert(blockSize >= BLOCK_SIZE);
+
+		uint32_t state[8][1] = {};
+		MidstateCompressor::init(state, 0);
+		const std::size_t saltBlocks = static_cast<std::size_t>(salt.size()) / BLOCK_SIZE;
+		for (std::size_t i = 0; i < saltBlocks; ++i)
+		{
+			const Byte *const blocks[1] = {salt.data() + (i * BLOCK_SIZE)};
+			MidstateCompressor::compress(state, blocks);
+		}
+		for (int i = 0; i < 8; ++i)
+			m_midstate[i] = state[i][0];
+
+		std::copy((salt.data() + (saltBlocks * BLOCK_SIZE)), (salt.data() + salt.size()), m_saltTail);
+	}
+
+	template <int Lanes>
+	void SaltedHasher<Lanes>::hash(const Byte *input, const std::size_t stride, const std::size_t count, Byte *output) const
+	{
+		// a mostly idle wide group costs more than hashing its few blocks one by one
+		std::size_t done = 0;
+		while ((count - done) >= std::max<std::size_t>((Lanes / 2), 1))
+		{
+			const int active = static_cast<int>(std::min<std::size_t>(Lanes, (count - done)));
+			hashGroup<Lanes>((input + (stride * done)), stride, active, (output + (DIGEST_SIZE * done)));
+			done += static_cast<std::size_t>(active);
+		}
+		for (; done < count; ++done)
+			hashGroup<1>((input + (stride * done)), stride, 1, (output + (DIGEST_SIZE * done)));
+	}
+
+	template <int Lanes>
+	template <int L>
+	void SaltedHasher<Lanes>::hashGroup(const Byte *input, const std::size_t stride, const int active, Byte *output) const
+	{
+		using Compressor = MultiBuffer_NS::Kernel<SHA2_256, L>;
+
+		// the stream after the midstate is `saltTail || block`
+		const std::size_t streamSize = m_saltTailSize + m_blockSize;
+		const std::size_t chunks = streamSize / BLOCK_SIZE;
+		const std::size_t remainder = streamSize % BLOCK_SIZE;
+		const std::size_t tailBlocks = ((remainder + 1 + 8) > BLOCK_SIZE) ? 2 : 1;
+
+		// idle lanes repeat the last block, their results are dropped
+		const Byte *sources[L];
+		for (int l = 0; l < L; ++l)
+			sources[l] = input + (stride * static_cast<std::size_t>(std::min(l, (active - 1))));
+
+		uint32_t state[8][L];
+		for (int i = 0; i < 8; ++i)
+			std::fill(std::begin(state[i]), std::end(state[i]), m_midstate[i]);
+
+		Byte first[L][BLOCK_SIZE];
+		if (m_saltTailSize > 0)
+		{
+			for (int l = 0; l < L; ++l)
+			{
+				std::memcpy(first[l], m_saltTail, m_saltTailSize);
+				std::memcpy((first[l] + m_saltTailSize), sources[l], (BLOCK_SIZE - m_saltTailSize));
+			}
+		}
+
+		for (std::size_t c = 0; c < chunks; ++c)
+		{
+			const Byte *blocks[L];
+			for (int l = 0; l < L; ++l)
+			{
+				blocks[l] = ((c == 0) && (m_saltTailSize > 0))
+					? first[l]
+					: (sources[l] + ((c * BLOCK_SIZE) - m_saltTailSize));
+			}
+			Compressor::compress(state, blocks);
+		}
+
+		Byte tail[L][BLOCK_SIZE * 2];
+		for (int l = 0; l < L; ++l)
+		{
+			std::fill(std::begin(tail[l]), std::end(tail[l]), Byte(0));
+			std::memcpy(tail[l], (sources[l] + ((chunks * BLOCK_SIZE) - m_saltTailSize)), remainder);
+			tail[l][remainder] = (1 << 7);
+			for (int i = 0; i < 8; ++i)
+				tail[l][(tailBlocks * BLOCK_SIZE) - 1 - static_cast<std::size_t>(i)] = ror<Byte>(m_messageBits, static_cast<unsigned int>(8 * i));
+		}
+		for (std::size_t t = 0; t < tailBlocks; ++t)
+		{
+			const Byte *blocks[L];
+			for (int l = 0; l < L; ++l)
+				blocks[l] = tail[l] + (t * BLOCK_SIZE);
+			Compressor::compress(state, blocks);
+		}
+
+		for (int l = 0; l < active; ++l)
+		{
+			Byte *out = output + (static_cast<std::size_t>(l) * DIGEST_SIZE);
+			for (std::size_t i = 0; i < DIGEST_SIZE; ++i)
+				out[i] = ror<Byte>(state[i / 4][l], static_cast<unsigned int>(8 * (3 - (i % 4))));
+		}
+	}
+
+	inline VerityTree::VerityTree(const Span<const Byte> salt, const uint32_t dataBlockSize, const uint32_t hashBlockSize)
+		: m_salt(salt.begin(), salt.end())
+		, m_dataBlockSize(dataBlockSize)
+		, m_hashBlockSize(hashBlockSize)
+		, m_threads(std::max(std::thread::hardware_concurrency(), 1u))
+		, m_paramsValid(isBlockSizeValid(dataBlockSize) && isBlockSizeValid(hashBlockSize) && (m_salt.size() <= MAX_SALT_SIZE))
+	{
+	}
+
+	inline VerityTree& VerityTree::setUuid(const Span<const Byte, 16> uuid)
+	{
+		std::copy(uuid.begin(), uuid.end(), m_uuid);
+		return (*this);
+	}
+
+	inline VerityTree& VerityTree::setSuperblock(const bool enabled)
+	{
+		m_superblock = enabled;
+		return (*this);
+	}
+
+	inline VerityTree& VerityTree::setThreads(const unsigned int threads)
+	{
+		m_threads = std::max(threads, 1u);
+		return (*this);
+	}
+
+	inline bool VerityTree::isValid() const
+	{
+		return (m_paramsValid && !m_buildFailed);
+	}
+
+	inline VerityTree& VerityTree::build(const Span<const Byte> image)
+	{
+		m_hashArea.clear();
+		m_rootHash.clear();
+		m_buildFailed = true;
+
+		const auto imageSize = static_cast<uint64_t>(image.size());
+		if (!m_paramsValid || ((imageSize % m_dataBlockSize) != 0)
+			|| !m_layout.init((imageSize / m_dataBlockSize), m_hashBlockSize, m_superblock))
+		{
+			m_layout = {};
+			return (*this);
+		}
+
+		m_hashArea.assign(static_cast<std::size_t>(m_layout.hashBlocks * m_hashBlockSize), 0);
+		if (m_superblock)
+			writeSuperblock(m_hashArea.data());
+
+		const SaltedHasher<LANES> dataHasher(m_salt, m_dataBlockSize);
+		const SaltedHasher<LANES> hashHasher(m_salt, m_hashBlockSize);
+
+		// digests of a level are contiguous: a hash block holds exactly `hashBlockSize / 32` of them
+		const auto hashLevel = [this](const SaltedHasher<LANES> &hasher, const Byte *input, const std::size_t stride, const uint64_t count, Byte *output) -> void
+		{
+			const uint64_t grain = std::max<uint64_t>(((4 * 1024 * 1024) / stride), LANES);
+			parallelFor(count, grain, m_threads, [&](const uint64_t begin, const uint64_t end) -> void
+			{
+				hasher.hash((input + (stride * begin)), stride, static_cast<std::size_t>(end - begin), (output + (DIGEST_SIZE * begin)));
+			});
+		};
+
+		const auto levelPtr = [this](const int level) -> Byte *
+		{
+			return m_hashArea.data() + (m_layout.levelBlock[level] * m_hashBlockSize);
+		};
+
+		m_rootHash.resize(DIGEST_SIZE);
+		if (m_layout.levels == 0)
+		{
+			dataHasher.hash(image.data(), m_dataBlockSize, 1, m_rootHash.data());
+		}
+		else
+		{
+			hashLevel(dataHasher, image.data(), m_dataBlockSize, m_layout.dataBlocks, levelPtr(0));
+			for (int i = 1; i < m_layout.levels; ++i)
+				hashLevel(hashHasher, levelPtr(i - 1), m_hashBlockSize, m_layout.levelSize[i - 1], levelPtr(i));
+			hashHasher.hash(levelPtr(m_layout.levels - 1), m_hashBlockSize, 1, m_rootHash.data());
+		}
+
+		m_buildFailed = false;
+		return (*this);
+	}
+
+	inline VerityTree& VerityTree::buildFile(const std::string &path)
+	{
+		const MappedFile file(path);
+		if (!file.isValid())
+		{
+			m_hashArea.clear();
+			m_rootHash.clear();
+			m_layout = {};
+			m_buildFailed = true;
+			return (*this);
+		}
+		return build(file.data());
+	}
+
+	inline uint64_t VerityTree::dataBlocks() const
+	{
+		return m_layout.dataBlocks;
+	}
+
+	inline std::vector<Byte> VerityTree::rootHash() const
+	{
+		return m_rootHash;
+	}
+
+	inline std::string VerityTree::rootHashString() const
+	{
+		const char hex[] = "0123456789abcdef";
+		std::string ret;
+		ret.reserve(m_rootHash.size() * 2);
+		for (const Byte c : m_rootHash)
+		{
+			ret += hex[c >> 4];
+			ret += hex[c & 0xF];
+		}
+		return ret;
+	}
+
+	inline Span<const Byte> VerityTree::hashArea() const
+	{
+		return m_hashArea;
+	}
+
+	inline void VerityTree::writeSuperblock(Byte *ptr) const
+	{
+		// struct verity_sb of cryptsetup, little endian
+		std::memcpy((ptr + 0), "verity\0\0", 8);
+		storeLE((ptr + 8), 1, 4);  // superblock version
+		storeLE((ptr + 12), 1, 4);  // hash type: normal
+		std::copy(std::begin(m_uuid), std::end(m_uuid), (ptr + 16));
+		std::memcpy((ptr + 32), "sha256", 6);
+		storeLE((ptr + 64), m_dataBlockSize, 4);
+		storeLE((ptr + 68), m_hashBlockSize, 4);
+		storeLE((ptr + 72), m_layout.dataBlocks, 8);
+		storeLE((ptr + 80), m_salt.size(), 2);
+		std::copy(m_salt.begin(), m_salt.end(), (ptr + 88));
+	}
+
+
+	inline VerityVerifier::VerityVerifier(const Span<const Byte> hashArea, const Span<const Byte> rootHash)
+	{
+		if (static_cast<std::size_t>(hashArea.size()) < SUPERBLOCK_SIZE)
+			return;
+
+		const Byte *ptr = hashArea.data();
+		const Byte algorithm[32] = {'s', 'h', 'a', '2', '5', '6'};
+		if ((std::memcmp(ptr, "verity\0\0", 8) != 0)
+			|| (loadLE((ptr + 8), 4) != 1)
+			|| (loadLE((ptr + 12), 4) != 1)
+			|| (std::memcmp((ptr + 32), algorithm, sizeof(algorithm)) != 0))
+		{
+			return;
+		}
+
+		const auto saltSize = static_cast<std::size_t>(loadLE((ptr + 80), 2));
+		if (saltSize > MAX_SALT_SIZE)
+			return;
+
+		init(hashArea, rootHash, loadLE((ptr + 72), 8), {(ptr + 88), saltSize}
+			, static_cast<uint32_t>(loadLE((ptr + 64), 4)), static_cast<uint32_t>(loadLE((ptr + 68), 4)), true);
+	}
+
+	inline VerityVerifier::VerityVerifier(const Span<const Byte> hashArea, const Span<const Byte> rootHash, const uint64_t dataBlocks
+		, const Span<const Byte> salt, const uint32_t dataBlockSize, const uint32_t hashBlockSize)
+	{
+		if (static_cast<std::size_t>(salt.size()) > MAX_SALT_SIZE)
+			return;
+
+		init(hashArea, rootHash, dataBlocks, salt, dataBlockSize, hashBlockSize, false);
+	}
+
+	inline void VerityVerifier::init(const Span<const Byte> hashArea, const Span<const Byte> rootHash, const uint64_t dataBlocks
+		, const Span<const Byte> salt, const uint32_t dataBlockSize, const uint32_t hashBlockSize, const bool superblock)
+	{
+		if ((static_cast<std::size_t>(rootHash.size()) != DIGEST_SIZE) || !isBlockSizeValid(dataBlockSize)
+			|| !m_layout.init(dataBlocks, hashBlockSize, superblock))
+		{
+			return;
+		}
+
+		// the whole hash area must be addressable
+		const auto hashAreaSize = static_cast<uint64_t>(hashArea.size());
+		if ((m_layout.hashBlocks > (hashAreaSize / hashBlockSize)) || (dataBlocks > (UINT64_MAX / dataBlockSize)))
+			return;
+
+		m_hashArea = hashArea.data();
+		std::copy(rootHash.begin(), rootHash.end(), m_rootHash);
+		m_salt.assign(salt.begin(), salt.end());
+		m_dataBlockSize = dataBlockSize;
+		m_hashBlockSize = hashBlockSize;
+		m_valid = true;
+	}
+
+	inline VerityVerifier& VerityVerifier::setThreads(const unsigned int threads)
+	{
+		m_threads = std::max(threads, 1u);
+		return (*this);
+	}
+
+	inline bool VerityVerifier::isValid() const
+	{
+		return m_valid;
+	}
+
+	inline uint64_t VerityVerifier::dataBlocks() const
+	{
+		return m_layout.dataBlocks;
+	}
+
+	inline uint32_t VerityVerifier::dataBlockSize() const
+	{
+		return m_dataBlockSize;
+	}
+
+	inline bool VerityVerifier::verify(const Span<const Byte> image, const uint64_t firstBlock, const uint64_t blockCount) const
+	{
+		if (!m_valid || (firstBlock >= m_layout.dataBlocks) || (blockCount > (m_layout.dataBlocks - firstBlock))
+			|| (static_cast<uint64_t>(image.size()) < ((firstBlock + blockCount) * m_dataBlockSize)))
+		{
+			return false;
+		}
+		return verifyRange((image.data() + (firstBlock * m_dataBlockSize)), firstBlock, blockCount);
+	}
+
+	inline bool VerityVerifier::verifyBlock(const uint64_t index, const Span<const Byte> block) const
+	{
+		if (!m_valid || (index >= m_layout.dataBlocks) || (static_cast<uint64_t>(block.size()) != m_dataBlockSize))
+			return false;
+		return verifyRange(block.data(), index, 1);
+	}
+
+	inline bool VerityVerifier::verifyRange(const Byte *data, const uint64_t firstBlock, const uint64_t blockCount) const
+	{
+		if (blockCount == 0)
+			return false;
+
+		const SaltedHasher<LANES> dataHasher(m_salt, m_dataBlockSize);
+		const SaltedHasher<LANES> hashHasher(m_salt, m_hashBlockSize);
+		const Byte *dataDigests = m_hashArea + (m_layout.levelBlock[0] * m_hashBlockSize);
+
+		std::atomic<bool> ok {true};
+		const auto task = [&](const uint64_t begin, const uint64_t end) -> void
+		{
+			uint64_t verified[Layout::MAX_LEVELS];  // the last good hash block of each level
+			std::fill(std::begin(verified), std::end(verified), UINT64_MAX);
+
+			const std::size_t batch = 64;
+			Byte digests[batch * DIGEST_SIZE];
+			for (uint64_t i = begin; (i < end) && ok; i += batch)
+			{
+				const auto count = static_cast<std::size_t>(std::min<uint64_t>(batch, (end - i)));
+				dataHasher.hash((data + (i * m_dataBlockSize)), m_dataBlockSize, count, digests);
+
+				for (std::size_t j = 0; j < count; ++j)
+				{
+					const uint64_t block = firstBlock + i + j;
+					const Byte *expected = (m_layout.levels == 0) ? m_rootHash : (dataDigests + (block * DIGEST_SIZE));
+					if ((std::memcmp((digests + (j * DIGEST_SIZE)), expected, DIGEST_SIZE) != 0)
+						|| ((m_layout.levels > 0) && !verifyPath(hashHasher, (block >> m_layout.digestBits), verified)))
+					{
+						ok = false;
+						return;
+					}
+				}
+			}
+		};
+
+		// pieces are aligned to whole level 0 hash blocks so threads rarely check the same path
+		const uint64_t grain = (uint64_t(64) << m_layout.digestBits);
+		parallelFor(blockCount, grain, m_threads, task);
+		return ok;
+	}
+
+	inline bool VerityVerifier::verifyPath(const SaltedHasher<LANES> &hasher, uint64_t hashBlock, uint64_t (&verified)[Layout::MAX_LEVELS]) const
+	{
+		// `hashBlock` is an index within level 0
+		for (int level = 0; level < m_layout.levels; ++level)
+		{
+			if (verified[level] == hashBlock)
+				return true;
+
+			Byte digest[DIGEST_SIZE];
+			hasher.hash((m_hashArea + ((m_layout.levelBlock[level] + hashBlock) * m_hashBlockSize)), m_hashBlockSize, 1, digest);
+
+			const bool isTop = ((level + 1) == m_layout.levels);
+			const Byte *expected = isTop
+				? m_rootHash
+				: (m_hashArea + (m_layout.levelBlock[level + 1] * m_hashBlockSize) + (hashBlock * DIGEST_SIZE));
+			if (std::memcmp(digest, expected, DIGEST_SIZE) != 0)
+				return false;
+
+			verified[level] = hashBlock;
+			hashBlock >>= m_layout.digestBits;
+		}
+		return true;
+	}
+}
+}
+	using VerityTree = Hash::Verity_NS::VerityTree;
+	using VerityVerifier = Hash::Verity_NS::VerityVerifier;
+}
+
+#endif  // CHOCOBO1_VERITY_H
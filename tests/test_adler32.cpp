@@ -0,0 +1,89 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/adler32.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+	uint32_t bytewiseAdler32(const uint8_t *data, const std::size_t size)
+	{
+		// reference for the SIMD kernels, straight from RFC 1950
+		uint32_t a = 1;
+		uint32_t b = 0;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			a = (a + data[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		return ((b << 16) | a);
+	}
+}
+
+TEST_CASE("adler32")  // NOLINT
+{
+	using Hash = Chocobo1::Adler32;
+
+	// checked against python zlib.adler32()
+	REQUIRE("00000001" == Hash().finalize().toString());
+	REQUIRE("11e60398" == Hash().addData("Wikipedia", 9).finalize().toString());
+
+	const char s1[] = "The quick brown fox jumps over the lazy dog";
+	REQUIRE("5bdc0fda" == Hash().addData(s1, strlen(s1)).finalize().toString());
+
+	const std::vector<uint8_t> s2(100000, 0xFF);
+	REQUIRE(0x149a302c == Hash().addData(s2.data(), s2.size()).finalize().toValue());
+
+	// my own tests
+	REQUIRE(Hash() == Hash());
+	REQUIRE(Hash().addData("123").finalize() != Hash().finalize());
+
+	std::vector<uint8_t> data;
+	for (int i = 0; i < 12000; ++i)
+		data.emplace_back(static_cast<uint8_t>((i * 167) ^ (i >> 3)));
+	for (std::size_t offset = 0; offset < 32; offset += 7)
+	{
+		for (std::size_t size = 0; (offset + size) <= data.size(); size += ((size < 300) ? 1 : 1009))
+		{
+			const uint8_t *ptr = data.data() + offset;
+			REQUIRE(bytewiseAdler32(ptr, size) == Hash().addData(ptr, size).finalize().toValue());
+		}
+	}
+
+	Hash h1;
+	h1.addData(data.data(), 33).addData((data.data() + 33), (data.size() - 33));
+	REQUIRE(h1.finalize() == Hash().addData(data.data(), data.size()).finalize());
+
+	for (const std::size_t split : {0, 1, 100, 5552, 11999, 12000})
+	{
+		const auto a = Hash().addData(data.data(), split).finalize().toValue();
+		const auto b = Hash().addData((data.data() + split), (data.size() - split)).finalize().toValue();
+		REQUIRE(Hash::combine(a, b, (data.size() - split)) == Hash().addData(data.data(), data.size()).finalize().toValue());
+	}
+
+	const unsigned char s16[] = {0x00, 0x0A};
+	const auto s16_1 = Hash().addData(s16, 2).finalize().toArray();
+	const auto s16_2 = Hash().addData(s16).finalize().toArray();
+	REQUIRE(s16_1 == s16_2);
+
+	REQUIRE(0x11e60398 == std::hash<Hash> {}(Hash().addData("Wikipedia", 9).finalize()));
+
+#if (__cplusplus >= 201703L)
+	constexpr uint8_t s17[] = {'W', 'i', 'k', 'i', 'p', 'e', 'd', 'i', 'a'};
+	constexpr auto s17_1 = Hash().addData(s17).finalize().toValue();
+	REQUIRE(0x11e60398 == s17_1);
+#endif
+}
@@ -0,0 +1,109 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/any_hasher.h"
+#include "../src/tree_digest.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	template <typename T>
+	std::string hashOf(T hasher, const std::string &data)
+	{
+		return hasher.addData(data.data(), data.size()).finalize().toString();
+	}
+}
+
+TEST_CASE("any-hasher")  // NOLINT
+{
+	using Chocobo1::AnyHasher;
+	using Chocobo1::HashId;
+
+	const std::string data = "The quick brown fox jumps over the lazy dog";
+
+	// every id has a name & round trips
+	for (int i = 0; i < static_cast<int>(HashId::Invalid); ++i)
+	{
+		const auto id = static_cast<HashId>(i);
+		const char *name = AnyHasher::name(id);
+		REQUIRE(name != nullptr);
+		REQUIRE(AnyHasher::findId(name) == id);
+
+		const bool needsLength = ((id == HashId::SHAKE_128) || (id == HashId::SHAKE_256) || (id == HashId::CSHAKE_128) || (id == HashId::CSHAKE_256));
+		REQUIRE(AnyHasher(id).isValid() == !needsLength);
+		REQUIRE(AnyHasher(id, 16).isValid());
+		REQUIRE(AnyHasher(id, 16).id() == id);
+	}
+	REQUIRE(AnyHasher::name(HashId::Invalid) == nullptr);
+	REQUIRE(AnyHasher::findId("sha2-257") == HashId::Invalid);
+	REQUIRE_FALSE(AnyHasher("sha2-257").isValid());
+	REQUIRE_FALSE(AnyHasher().isValid());
+
+	// same digests as the concrete classes
+	REQUIRE(hashOf(AnyHasher(HashId::Adler32), data) == hashOf(Chocobo1::Adler32(), data));
+	REQUIRE(hashOf(AnyHasher(HashId::Blake2), data) == hashOf(Chocobo1::Blake2(), data));
+	REQUIRE(hashOf(AnyHasher("crc-32"), data) == "414fa339");
+	REQUIRE(hashOf(AnyHasher(HashId::CRC_64_XZ), data) == hashOf(Chocobo1::CRC_64_XZ(), data));
+	REQUIRE(hashOf(AnyHasher(HashId::CSHAKE_256, 20, "N", "S"), data) == hashOf(Chocobo1::CSHAKE_256(20, "N", "S"), data));
+	REQUIRE(hashOf(AnyHasher(HashId::Fletcher32), data) == hashOf(Chocobo1::Fletcher32(), data));
+	REQUIRE(hashOf(AnyHasher("md5"), data) == "9e107d9d372bb6826bd81d3542a419d6");
+	REQUIRE(hashOf(AnyHasher(HashId::SHA1), data) == "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12");
+	REQUIRE(hashOf(AnyHasher("sha2-256"), data) == "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592");
+	REQUIRE(hashOf(AnyHasher(HashId::SHA3_512), data) == hashOf(Chocobo1::SHA3_512(), data));
+	REQUIRE(hashOf(AnyHasher(HashId::SHAKE_128, 32), data) == hashOf(Chocobo1::SHAKE_128(32), data));
+	REQUIRE(hashOf(AnyHasher(HashId::Tiger2_192), data) == hashOf(Chocobo1::Tiger2_192(), data));
+	REQUIRE(hashOf(AnyHasher(HashId::Whirlpool), data) == hashOf(Chocobo1::Whirlpool(), data));
+
+	const uint8_t zeroKey[16] = {};
+	REQUIRE(hashOf(AnyHasher(HashId::SipHash), data) == hashOf(Chocobo1::SipHash(zeroKey), data));
+
+	const uint8_t zeroKey32[32] = {};
+	REQUIRE(hashOf(AnyHasher("highwayhash-256"), data) == hashOf(Chocobo1::HighwayHash256(zeroKey32), data));
+
+	// wrapped objects keep their parameters
+	{
+		const uint8_t key[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+		const AnyHasher sipHash {Chocobo1::SipHash(key)};
+		REQUIRE(sipHash.id() == HashId::Invalid);
+		REQUIRE(hashOf(sipHash, data) == hashOf(Chocobo1::SipHash(key), data));
+	}
+
+	// chunks, copies, assignment & reset
+	{
+		AnyHasher hasher {HashId::SHA2_512};
+		for (const char c : data)
+			hasher.addData(&c, 1);
+
+		AnyHasher copy = hasher;
+		REQUIRE(copy.finalize().toString() == hashOf(Chocobo1::SHA2_512(), data));
+
+		AnyHasher assigned {HashId::MD2};
+		assigned = hasher;
+		REQUIRE(assigned.id() == HashId::SHA2_512);
+		REQUIRE(assigned.addData(data.data(), data.size()).finalize().toVector() == Chocobo1::SHA2_512().addData(data.data(), data.size()).addData(data.data(), data.size()).finalize().toVector());
+
+		hasher.reset();
+		const uint8_t array[] = {'a', 'b', 'c'};
+		REQUIRE(hasher.addData(array).finalize().toString() == Chocobo1::SHA2_512().addData(array).finalize().toString());
+	}
+
+	// usable where a concrete hasher is expected
+	{
+		const std::vector<uint8_t> content = {'h', 'i'};
+		const auto expected = Chocobo1::TreeDigest<Chocobo1::SHA2_256>().addFile("a.txt", content).finalize().toString();
+		REQUIRE(Chocobo1::TreeDigest<AnyHasher>(AnyHasher(HashId::SHA2_256)).addFile("a.txt", content).finalize().toString() == expected);
+	}
+}
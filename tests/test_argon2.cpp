@@ -0,0 +1,91 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/argon2.h"
+#include "../src/hash_service.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	std::string toHex(const std::vector<uint8_t> &bytes)
+	{
+		std::string ret;
+		for (const uint8_t c : bytes)
+		{
+			const char digits[] = "0123456789abcdef";
+			ret.push_back(digits[c >> 4]);
+			ret.push_back(digits[c & 0xf]);
+		}
+		return ret;
+	}
+}
+
+TEST_CASE("argon2")  // NOLINT
+{
+	// test vectors from RFC 9106 section 5
+	const std::vector<uint8_t> password(32, 0x01);
+	const std::vector<uint8_t> salt(16, 0x02);
+	const std::vector<uint8_t> secret(8, 0x03);
+	const std::vector<uint8_t> associatedData(12, 0x04);
+
+	const auto rfc = [&](auto argon2)
+	{
+		return toHex(argon2.setSecret(secret).setAssociatedData(associatedData).hash(password, salt));
+	};
+	REQUIRE(rfc(Chocobo1::Argon2d(32, 3, 4)) == "512b391b6f1162975371d30919734294f868e3be3984f3c1a13a4db9fabe4acb");
+	REQUIRE(rfc(Chocobo1::Argon2i(32, 3, 4)) == "c814d9d1dc7f37aa13f0d77f2494bda1c8de6b016dd388d29952a4c4672b6ce8");
+	REQUIRE(rfc(Chocobo1::Argon2id(32, 3, 4)) == "0d640df58d78766c08c037a34a8b53c9d01ef0452d75b65eb52520e96b01e659");
+
+	// same tag for any number of threads, or on a pool
+	{
+		const std::string expected = rfc(Chocobo1::Argon2id(32, 3, 4).setThreads(1));
+		REQUIRE(rfc(Chocobo1::Argon2id(32, 3, 4).setThreads(3)) == expected);
+		REQUIRE(rfc(Chocobo1::Argon2id(32, 3, 4).setThreads(16)) == expected);
+
+		Chocobo1::HashService service;
+		auto argon2 = Chocobo1::Argon2id(32, 3, 4);
+		argon2.setSecret(secret).setAssociatedData(associatedData);
+		REQUIRE(toHex(argon2.hash(password, salt, service)) == expected);
+	}
+
+	// my own tests
+	{
+		const auto tag = Chocobo1::Argon2id(64, 2, 2).hash(password, salt);
+		REQUIRE(tag.size() == 32);
+		REQUIRE(Chocobo1::Argon2id(64, 2, 2).hash(password, salt) == tag);
+		REQUIRE(Chocobo1::Argon2id(65, 2, 2).hash(password, salt) != tag);  // same number of blocks, but `m` is part of H0
+		REQUIRE(Chocobo1::Argon2id(64, 3, 2).hash(password, salt) != tag);
+		REQUIRE(Chocobo1::Argon2id(64, 2, 1).hash(password, salt) != tag);
+		REQUIRE(Chocobo1::Argon2d(64, 2, 2).hash(password, salt) != tag);
+
+		// long tags use the chained H' output
+		const auto longTag = Chocobo1::Argon2id(64, 2, 2, 100).hash(password, salt);
+		REQUIRE(longTag.size() == 100);
+		REQUIRE(std::vector<uint8_t>(longTag.begin(), (longTag.begin() + 32)) != tag);
+
+		// segments spanning several address blocks of Argon2i
+		REQUIRE(Chocobo1::Argon2i(4096, 2, 2).setThreads(1).hash(password, salt) == Chocobo1::Argon2i(4096, 2, 2).setThreads(2).hash(password, salt));
+	}
+
+	// invalid parameters
+	REQUIRE(Chocobo1::Argon2id(32, 3, 4).isValid());
+	REQUIRE_FALSE(Chocobo1::Argon2id(31, 3, 4).isValid());
+	REQUIRE_FALSE(Chocobo1::Argon2id(32, 0, 4).isValid());
+	REQUIRE_FALSE(Chocobo1::Argon2id(32, 3, 0).isValid());
+	REQUIRE_FALSE(Chocobo1::Argon2id(32, 3, 4, 3).isValid());
+	REQUIRE(Chocobo1::Argon2id(31, 3, 4).hash(password, salt).empty());
+	REQUIRE(Chocobo1::Argon2id(32, 3, 4).hash(password, {salt.data(), 7}).empty());
+}
@@ -0,0 +1,143 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/async_hash.h"
+#include "../src/blake2.h"
+#include "../src/sha2_256.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#if (HAS_COROUTINE_CHOCOBO1_HASH == 1)
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+	struct Detached
+	{
+		struct promise_type
+		{
+			Detached get_return_object() const noexcept { return {}; }
+			std::suspend_never initial_suspend() const noexcept { return {}; }
+			std::suspend_never final_suspend() const noexcept { return {}; }
+			void return_void() const noexcept {}
+			void unhandled_exception() const noexcept { std::terminate(); }
+		};
+	};
+
+	Detached start(Chocobo1::AsyncTask<void> task, bool &done)
+	{
+		co_await task;
+		done = true;
+	}
+}
+
+TEST_CASE("async-hash")  // NOLINT
+{
+	std::vector<uint8_t> data(3 * 1024 * 1024);
+	for (size_t i = 0; i < data.size(); ++i)
+		data[i] = static_cast<uint8_t>(i * 7);
+
+	const auto expected = Chocobo1::SHA2_256().addData(data.data(), data.size()).finalize().toArray();
+	const auto expectedSmall = Chocobo1::SHA2_256().addData(data.data(), 1000).finalize().toArray();
+
+	// large input is offloaded to the pool
+	{
+		const std::thread::id caller = std::this_thread::get_id();
+		std::thread::id worker;
+
+		const auto task = [&]() -> Chocobo1::AsyncTask<Chocobo1::SHA2_256::ResultArrayType>
+		{
+			const auto result = co_await Chocobo1::asyncHash<Chocobo1::SHA2_256>(data);
+			worker = std::this_thread::get_id();
+			co_return result;
+		};
+		REQUIRE(Chocobo1::syncWait(task()) == expected);
+		REQUIRE(worker != caller);
+	}
+
+	// an explicit pool
+	{
+		Chocobo1::AsyncThreadPool pool {1};
+		std::thread::id poolWorker;
+		const auto probe = [&]() -> Chocobo1::AsyncTask<void>
+		{
+			co_await pool.schedule();
+			poolWorker = std::this_thread::get_id();
+		};
+		Chocobo1::syncWait(probe());
+
+		Chocobo1::AsyncOptions options;
+		options.pool = &pool;
+		std::thread::id worker;
+		const auto task = [&]() -> Chocobo1::AsyncTask<Chocobo1::SHA2_256::ResultArrayType>
+		{
+			const auto result = co_await Chocobo1::asyncHash<Chocobo1::SHA2_256>(data, options);
+			worker = std::this_thread::get_id();
+			co_return result;
+		};
+		REQUIRE(Chocobo1::syncWait(task()) == expected);
+		REQUIRE(worker == poolWorker);
+	}
+
+	// small input, cooperative chunks handed to an "event loop"
+	{
+		std::deque<std::coroutine_handle<>> loop;
+		Chocobo1::AsyncOptions options;
+		options.chunkBudget = 100;
+		options.scheduler = [&loop](const std::coroutine_handle<> handle) { loop.push_back(handle); };
+
+		Chocobo1::AsyncHasher<Chocobo1::SHA2_256> hasher(options);
+		Chocobo1::SHA2_256::ResultArrayType result {};
+		const auto task = [&]() -> Chocobo1::AsyncTask<void>
+		{
+			co_await hasher.addData(data.data(), 1000);
+			result = hasher.finalize();
+		};
+
+		bool done = false;
+		start(task(), done);
+
+		int steps = 0;
+		while (!loop.empty())
+		{
+			const std::coroutine_handle<> handle = loop.front();
+			loop.pop_front();
+			++steps;
+			handle.resume();
+		}
+		REQUIRE(done);
+		REQUIRE(steps == 9);
+		REQUIRE(result == expectedSmall);
+	}
+
+	// streaming, reset & other classes
+	{
+		Chocobo1::AsyncOptions options;
+		options.offloadThreshold = 1024;
+		Chocobo1::AsyncHasher<Chocobo1::Blake2> hasher(options);
+		const auto task = [&]() -> Chocobo1::AsyncTask<Chocobo1::Blake2::ResultArrayType>
+		{
+			co_await hasher.addData(data.data(), 10);
+			co_await hasher.addData((data.data() + 10), 5000);
+			co_return hasher.finalize();
+		};
+		REQUIRE(Chocobo1::syncWait(task()) == Chocobo1::Blake2().addData(data.data(), 5010).finalize().toArray());
+
+		hasher.reset();
+		REQUIRE(Chocobo1::syncWait(task()) == Chocobo1::Blake2().addData(data.data(), 5010).finalize().toArray());
+	}
+}
+#endif
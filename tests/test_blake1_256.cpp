@@ -81,5 +81,9 @@ TEST_CASE("blake1-256")  // NOLINT
 	REQUIRE("dc980544f4181cc43505318e317cdfd4334dab81ae035a28818308867ce23060"
 			== Hash().addData(s18, sizeof(s18)).finalize().toString());
 
+	const char s19[56] = {0};  // padding spills into an extra block
+	REQUIRE("26ae7c289ebb79c9f3af2285023ab1037a9a6db63f0d6b6c6bbd199ab1627508"
+			== Hash().addData(s19, sizeof(s19)).finalize().toString());
+
 	REQUIRE(0x716f6e863f744b9a == std::hash<Hash> {}(Hash().finalize()));
 }
@@ -78,5 +78,9 @@ TEST_CASE("blake1-512")  // NOLINT
 	REQUIRE("125695c5cc01de48d8b107c101778fc447a55ad3440a17dc153c6c652faecdbf017aed68f4f48826b9dfc413ef8f14ae7dfd8b74a0afcf47b61ce7dcb1058976"
 			== Hash().addData(s18, sizeof(s18)).finalize().toString());
 
+	const char s19[112] = {0};  // padding spills into an extra block
+	REQUIRE("aa42836448c9db34e0e45a49f916b54c25c9eefe3f9f65db0c13654bcbd9a938c24251f3bedb7105fa4ea54292ce9ebf5adea15ce530fb71cdf409387a78c6ff"
+			== Hash().addData(s19, sizeof(s19)).finalize().toString());
+
 	REQUIRE(0xa8cfbbd73726062d == std::hash<Hash> {}(Hash().finalize()));
 }
@@ -13,7 +13,10 @@
 
 #include "catch2/single_include/catch2/catch.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <vector>
 
 
 TEST_CASE("blake2")  // NOLINT
@@ -71,4 +74,98 @@ TEST_CASE("blake2")  // NOLINT
 	REQUIRE(s17_1 == s17_2);
 
 	REQUIRE(0x786a02f742015903 == std::hash<Hash> {}(Hash().finalize()));
+
+	// shorter digests, checked with Python `hashlib.blake2b(digest_size=...)`
+	REQUIRE("bddd813c634239723171ef3fee98579b94964e3bb1cb3e427262c8c068d52319"
+			== Hash(32).addData("abc", 3).finalize().toString());
+	REQUIRE("3c523ed102ab45a37d54f5610d5a983162fde84f"
+			== Hash(20).addData(s11, strlen(s11)).finalize().toString());
+	REQUIRE(Hash(20).addData(s11, strlen(s11)).finalize().toVector().size() == 20);
+	REQUIRE("2e" == Hash(1).finalize().toString());
+	REQUIRE(0x2e == static_cast<uint64_t>(Hash(1).finalize()));
+}
+
+TEST_CASE("blake2bx")  // NOLINT
+{
+	using Hash = Chocobo1::Blake2bX;
+	using Byte = Hash::Byte;
+
+	const auto toHex = [](const std::vector<Byte> &data) -> std::string
+	{
+		std::string ret;
+		for (const Byte c : data)
+		{
+			const char digits[] = "0123456789abcdef";
+			ret += digits[c >> 4];
+			ret += digits[c & 0xf];
+		}
+		return ret;
+	};
+
+	std::vector<Byte> key(64);
+	for (size_t i = 0; i < key.size(); ++i)
+		key[i] = static_cast<Byte>(i);
+	const std::vector<Byte> salt = {'s', 'a', 'l', 't'};
+	const std::vector<Byte> personal(std::begin("personal"), (std::end("personal") - 1));
+
+	// reference values from an independent implementation of the BLAKE2X paper
+	// (Python `hashlib` only covers the root, it rejects the depth 0 parameter block of the output blocks)
+	REQUIRE("0a1d2a0ffd9ee845ccaf3b1040375a4999a670ad19cbe2ac691d341fd14602108a2e90eb7e6e2c68e9292be3682f7937b5fdd6a4c3a0fcbf44f6387b2a08856c44ab0ac1bae93ac5255f058778c42765292b95ea285cf0d648c481c0299986bbf2549d9c00d46c11d1334fd2eb8ea3fcf5ef6712028aa26bbc70a9be62829e158b"
+			== Hash(129, key, salt, personal).addData("abc", 3).finalize().toString());
+	REQUIRE("34" == Hash(1).finalize().toString());
+
+	std::vector<Byte> unknown(80);
+	Hash(Hash::UNKNOWN_LENGTH).addData("abc", 3).finalize().squeeze(unknown);
+	REQUIRE("ae080c1efbcf7f60ed52a04161d02b7ee63bed362534f0661da02c6e40cd208946d066b86b3dff620e57acea9cd72d3056cf6cb0c18341452a17ce2cced67b702669bf0bed358c1b708e97de2533b294"
+			== toHex(unknown));
+	REQUIRE(Hash(Hash::UNKNOWN_LENGTH).finalize().toString().empty());
+
+	// any chunking, offset & thread count gives the same output
+	{
+		const uint32_t length = 300000;
+		const std::vector<Byte> expected = Hash(length).setThreads(1).addData("abc", 3).finalize().toVector();
+		REQUIRE(expected.size() == length);
+		REQUIRE(Hash(length).setThreads(3).addData("abc", 3).finalize().toVector() == expected);
+
+		const size_t chunkSizes[] = {1, 7, 64, 65, 1000, 50000};
+		int matches = 0;
+		for (const size_t chunkSize : chunkSizes)
+		{
+			Hash hash {length};
+			hash.setThreads(2).addData("abc", 3).finalize();
+			std::vector<Byte> output(length);
+			for (size_t i = 0; i < output.size(); i += chunkSize)
+				hash.squeeze({(output.data() + i), std::min(chunkSize, (output.size() - i))});
+			if ((output == expected) && (hash.position() == length))
+				++matches;
+		}
+		REQUIRE(matches == 6);
+
+		Hash hash {length};
+		hash.addData("abc", 3).finalize();
+		std::vector<Byte> slice(1000);
+		hash.seek(12345).squeeze(slice);
+		REQUIRE(std::equal(slice.begin(), slice.end(), (expected.begin() + 12345)));
+
+		// bytes past the output length are zero
+		std::vector<Byte> tail(100, 0xFF);
+		hash.seek(length - 10).squeeze(tail);
+		REQUIRE(std::equal(tail.begin(), (tail.begin() + 10), (expected.end() - 10)));
+		REQUIRE(std::all_of((tail.begin() + 10), tail.end(), [](const Byte b) { return (b == 0); }));
+
+		// the output length is part of every output block
+		std::vector<Byte> prefix(100);
+		Hash(length + 1).addData("abc", 3).finalize().squeeze(prefix);
+		REQUIRE_FALSE(std::equal(prefix.begin(), prefix.end(), expected.begin()));
+
+		hash.reset();
+		REQUIRE(hash.addData("ab", 2).addData("c", 1).finalize().toVector() == expected);
+	}
+
+	// bad parameters
+	REQUIRE(Hash(Hash::MAX_LENGTH).isValid());
+	REQUIRE_FALSE(Hash(0).isValid());
+	REQUIRE_FALSE(Hash(16, std::vector<Byte>(65)).isValid());
+	REQUIRE_FALSE(Hash(16, {}, std::vector<Byte>(17)).isValid());
+	REQUIRE_FALSE(Hash(16, {}, {}, std::vector<Byte>(17)).isValid());
 }
@@ -13,7 +13,10 @@
 
 #include "catch2/single_include/catch2/catch.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <vector>
 
 
 TEST_CASE("blake2s")  // NOLINT
@@ -72,3 +75,98 @@ TEST_CASE("blake2s")  // NOLINT
 
 	REQUIRE(0x69217a3079908094 == std::hash<Hash> {}(Hash().finalize()));
 }
+
+TEST_CASE("blake2sx")  // NOLINT
+{
+	using Hash = Chocobo1::Blake2sX;
+	using Byte = Hash::Byte;
+
+	const auto toHex = [](const std::vector<Byte> &data) -> std::string
+	{
+		std::string ret;
+		for (const Byte c : data)
+		{
+			const char digits[] = "0123456789abcdef";
+			ret += digits[c >> 4];
+			ret += digits[c & 0xf];
+		}
+		return ret;
+	};
+
+	std::vector<Byte> key(32);
+	for (size_t i = 0; i < key.size(); ++i)
+		key[i] = static_cast<Byte>(i);
+	const std::vector<Byte> salt = {'s', 'a', 'l', 't'};
+	const std::vector<Byte> personal(std::begin("pers"), (std::end("pers") - 1));
+
+	// reference values from an independent implementation of the BLAKE2X paper
+	// (Python `hashlib` only covers the root, it rejects the depth 0 parameter block of the output blocks)
+	REQUIRE("c8d0b884f127b5af21772cdd8d5bd15b49848799c91420a3b99b2da06201d2091c1196b9d18b810b9942858eac3c2642def8ab346c6f49ab2949971281ba49e1da"
+			== Hash(65, key, salt, personal).addData("abc", 3).finalize().toString());
+	REQUIRE("07" == Hash(1).finalize().toString());
+
+	std::vector<Byte> unknown(40);
+	Hash(Hash::UNKNOWN_LENGTH).addData("abc", 3).finalize().squeeze(unknown);
+	REQUIRE("bf5c4f309fde8a62195bc8364ceea81e84eb9330579270c5737b9300085b61495576fef12a5cfa71"
+			== toHex(unknown));
+	REQUIRE(Hash(Hash::UNKNOWN_LENGTH).finalize().toString().empty());
+
+	// known lengths are too short to be spread across threads
+	{
+		std::vector<Byte> single(300000);
+		std::vector<Byte> threaded(300000);
+		Hash(Hash::UNKNOWN_LENGTH).setThreads(1).addData("abc", 3).finalize().squeeze(single);
+		Hash(Hash::UNKNOWN_LENGTH).setThreads(3).addData("abc", 3).finalize().squeeze(threaded);
+		REQUIRE(single == threaded);
+		REQUIRE(std::equal(unknown.begin(), unknown.end(), single.begin()));
+	}
+
+	// any chunking, offset & thread count gives the same output
+	{
+		const uint16_t length = 65000;
+		const std::vector<Byte> expected = Hash(length).setThreads(1).addData("abc", 3).finalize().toVector();
+		REQUIRE(expected.size() == length);
+		REQUIRE(Hash(length).setThreads(3).addData("abc", 3).finalize().toVector() == expected);
+
+		const size_t chunkSizes[] = {1, 7, 32, 33, 1000, 50000};
+		int matches = 0;
+		for (const size_t chunkSize : chunkSizes)
+		{
+			Hash hash {length};
+			hash.setThreads(2).addData("abc", 3).finalize();
+			std::vector<Byte> output(length);
+			for (size_t i = 0; i < output.size(); i += chunkSize)
+				hash.squeeze({(output.data() + i), std::min(chunkSize, (output.size() - i))});
+			if ((output == expected) && (hash.position() == length))
+				++matches;
+		}
+		REQUIRE(matches == 6);
+
+		Hash hash {length};
+		hash.addData("abc", 3).finalize();
+		std::vector<Byte> slice(1000);
+		hash.seek(12345).squeeze(slice);
+		REQUIRE(std::equal(slice.begin(), slice.end(), (expected.begin() + 12345)));
+
+		// bytes past the output length are zero
+		std::vector<Byte> tail(100, 0xFF);
+		hash.seek(length - 10).squeeze(tail);
+		REQUIRE(std::equal(tail.begin(), (tail.begin() + 10), (expected.end() - 10)));
+		REQUIRE(std::all_of((tail.begin() + 10), tail.end(), [](const Byte b) { return (b == 0); }));
+
+		// the output length is part of every output block
+		std::vector<Byte> prefix(100);
+		Hash(static_cast<uint16_t>(length + 1)).addData("abc", 3).finalize().squeeze(prefix);
+		REQUIRE_FALSE(std::equal(prefix.begin(), prefix.end(), expected.begin()));
+
+		hash.reset();
+		REQUIRE(hash.addData("ab", 2).addData("c", 1).finalize().toVector() == expected);
+	}
+
+	// bad parameters
+	REQUIRE(Hash(Hash::MAX_LENGTH).isValid());
+	REQUIRE_FALSE(Hash(0).isValid());
+	REQUIRE_FALSE(Hash(16, std::vector<Byte>(33)).isValid());
+	REQUIRE_FALSE(Hash(16, {}, std::vector<Byte>(9)).isValid());
+	REQUIRE_FALSE(Hash(16, {}, {}, std::vector<Byte>(9)).isValid());
+}
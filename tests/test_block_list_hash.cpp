@@ -0,0 +1,119 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/block_list_hash.h"
+#include "../src/sha2_512.h"
+#include "../src/sha3.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	std::vector<uint8_t> makeData(const size_t size)
+	{
+		std::vector<uint8_t> data(size);
+		for (size_t i = 0; i < size; ++i)
+			data[i] = static_cast<uint8_t>((i * 7) ^ (i >> 11));
+		return data;
+	}
+
+	// straightforward construction with the regular hashers
+	template <typename Inner, typename Outer>
+	std::string naiveBlockList(const std::vector<uint8_t> &data, const size_t partSize, const Inner &inner, Outer outer)
+	{
+		for (size_t i = 0; i < data.size(); i += partSize)
+		{
+			Inner hasher = inner;
+			outer.addData(hasher.addData((data.data() + i), std::min(partSize, (data.size() - i))).finalize().toVector());
+		}
+		return outer.finalize().toString();
+	}
+}
+
+TEST_CASE("block-list-hash")  // NOLINT
+{
+	using Chocobo1::BlockListHash;
+	using Chocobo1::DropboxContentHash;
+	using Chocobo1::S3ETag;
+
+	// reference values from Python hashlib
+	{
+		const auto data = makeData((20 * 1024 * 1024) + 123);
+
+		REQUIRE(S3ETag().addData(data).finalize().toETag() == "f6579d5d3ffb19799d9774985fa60a9f-3");
+		REQUIRE(S3ETag(5 * 1024 * 1024).setThreads(3).addData(data).finalize().toETag() == "cd2210160c5285e7ccad20615917ca35-5");
+		REQUIRE(DropboxContentHash().addData(data).finalize().toString() == "f69070ba35786fe8bf707e2964f3baabb045061c2fe2b823b83206636f959295");
+
+		// a size that is an exact multiple of the part size has no empty last part
+		S3ETag exact;
+		exact.addData(data.data(), (16 * 1024 * 1024)).finalize();
+		REQUIRE(exact.partCount() == 2);
+		REQUIRE(exact.toETag() == "479dc4bfa010a8e3e5098d05efcfb4dd-2");
+	}
+
+	// no data, no parts
+	{
+		DropboxContentHash hash;
+		REQUIRE(hash.finalize().toString() == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+		REQUIRE(hash.partCount() == 0);
+		REQUIRE_FALSE(BlockListHash<Chocobo1::MD5>(0).isValid());
+
+		// S3 reports an empty object with its plain MD5, no part count
+		REQUIRE(S3ETag().finalize().toETag() == "d41d8cd98f00b204e9800998ecf8427e");
+		REQUIRE(BlockListHash<Chocobo1::MD5, Chocobo1::SHA2_256>(1024).finalize().toETag() == "d41d8cd98f00b204e9800998ecf8427e");
+	}
+
+	// any chunking & thread count gives the same digest
+	{
+		const auto data = makeData(100000);
+		const size_t partSize = 1000;
+		const std::string expected = naiveBlockList(data, partSize, Chocobo1::MD5(), Chocobo1::MD5());
+
+		const size_t chunkSizes[] = {1, 7, 999, 1000, 1001, 4567, 100000};
+		int matches = 0;
+		for (const size_t chunkSize : chunkSizes)
+		{
+			for (unsigned int threads = 1; threads <= 4; ++threads)
+			{
+				S3ETag hash {partSize};
+				hash.setThreads(threads);
+				for (size_t i = 0; i < data.size(); i += chunkSize)
+					hash.addData((data.data() + i), std::min(chunkSize, (data.size() - i)));
+				hash.finalize();
+				if ((hash.toString() == expected) && (hash.partCount() == 100))
+					++matches;
+			}
+		}
+		REQUIRE(matches == (7 * 4));
+
+		// reset
+		S3ETag hash {partSize};
+		hash.addData(data).finalize();
+		hash.reset();
+		REQUIRE(hash.addData(data).finalize().toETag() == (expected + "-100"));
+	}
+
+	// other inner & outer hashers, with & without lanes
+	{
+		const auto data = makeData(54321);
+		REQUIRE(BlockListHash<Chocobo1::SHA1, Chocobo1::SHA2_512>(4096).addData(data).finalize().toString()
+			== naiveBlockList(data, 4096, Chocobo1::SHA1(), Chocobo1::SHA2_512()));
+		REQUIRE(BlockListHash<Chocobo1::SHA2_512, Chocobo1::SHA3_256>(3000).setThreads(2).addData(data).finalize().toString()
+			== naiveBlockList(data, 3000, Chocobo1::SHA2_512(), Chocobo1::SHA3_256()));
+		REQUIRE(BlockListHash<Chocobo1::SHAKE_128, Chocobo1::SHA2_256>(512, Chocobo1::SHAKE_128(20)).addData(data).finalize().toString()
+			== naiveBlockList(data, 512, Chocobo1::SHAKE_128(20), Chocobo1::SHA2_256()));
+	}
+}
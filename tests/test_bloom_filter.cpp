@@ -0,0 +1,190 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/bloom_filter.h"
+#include "../src/fnv.h"
+#include "../src/highwayhash.h"
+#include "../src/siphash.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	std::vector<std::string> makeKeys(const std::string &prefix, const std::size_t count)
+	{
+		std::vector<std::string> keys;
+		keys.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			keys.emplace_back("https://example.com/" + prefix + "/" + std::to_string(i));
+		return keys;
+	}
+}
+
+TEST_CASE("bloom-filter")  // NOLINT
+{
+	const uint8_t key[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+	const std::vector<std::string> members = makeKeys("in", 20000);
+	const std::vector<std::string> others = makeKeys("out", 20000);
+
+	// no false negatives, false positive rate near the target
+	{
+		Chocobo1::BloomFilter<Chocobo1::SipHash> filter(Chocobo1::SipHash(key), members.size(), 0.01);
+		REQUIRE(filter.isValid());
+		REQUIRE(filter.hashCount() == 7);
+		REQUIRE(filter.blockCount() == ((filter.sizeBytes() / 64)));
+
+		filter.insertAll(members);
+		REQUIRE(filter.itemCount() == members.size());
+
+		std::unique_ptr<bool[]> results(new bool[members.size()]);
+		REQUIRE(filter.containsAll(members, {results.get(), members.size()}) == members.size());
+		REQUIRE(std::all_of(members.begin(), members.end(), [&filter](const std::string &member) { return filter.contains(member); }));
+
+		const std::size_t falsePositives = filter.containsAll(others, {results.get(), others.size()});
+		REQUIRE(falsePositives < (others.size() / 100));
+
+		std::size_t count = 0;
+		std::size_t same = 0;
+		for (std::size_t i = 0; i < others.size(); ++i)
+		{
+			same += (results[i] == filter.contains(others[i].data(), others[i].size())) ? 1 : 0;
+			count += (results[i] ? 1 : 0);
+		}
+		REQUIRE(same == others.size());
+		REQUIRE(count == falsePositives);
+	}
+
+	// any digest of 64 bits or more, batch & single insertions agree
+	{
+		const uint8_t key32[32] = {};
+		Chocobo1::BloomFilter<Chocobo1::HighwayHash128> batch(Chocobo1::HighwayHash128(key32), 64, 5);
+		Chocobo1::BloomFilter<Chocobo1::HighwayHash128> single(Chocobo1::HighwayHash128(key32), 64, 5);
+		batch.insertAll(members);
+		for (const std::string &member : members)
+			single.insert(member);
+		REQUIRE(batch.serialize() == single.serialize());
+
+		Chocobo1::BloomFilter<Chocobo1::FNV64_1a> fnv(Chocobo1::FNV64_1a(), 1000, 0.001);
+		fnv.insert(std::vector<uint8_t> {'a', 'b', 'c'});
+		REQUIRE(fnv.contains(std::string("abc")));
+		REQUIRE_FALSE(fnv.contains(std::string("abd")));
+	}
+
+	// serialization, in place views & merging
+	{
+		Chocobo1::BloomFilter<Chocobo1::SipHash> left(Chocobo1::SipHash(key), 100, 6);
+		Chocobo1::BloomFilter<Chocobo1::SipHash> right(Chocobo1::SipHash(key), 100, 6);
+		left.insertAll(std::vector<std::string>(members.begin(), (members.begin() + 1000)));
+		right.insertAll(std::vector<std::string>((members.begin() + 1000), (members.begin() + 2000)));
+		REQUIRE(left.merge(right));
+		REQUIRE(left.itemCount() == 2000);
+		REQUIRE_FALSE(left.merge(Chocobo1::BloomFilter<Chocobo1::SipHash>(Chocobo1::SipHash(key), 100, 5)));
+
+		const std::vector<uint8_t> bytes = left.serialize();
+		REQUIRE(bytes.size() == (64 + left.sizeBytes()));
+
+		const auto loaded = Chocobo1::BloomFilter<Chocobo1::SipHash>::load(bytes, Chocobo1::SipHash(key));
+		REQUIRE(loaded.isValid());
+		REQUIRE_FALSE(loaded.isView());
+		REQUIRE(loaded.serialize() == bytes);
+
+		std::vector<uint64_t> aligned((bytes.size() / 8), 0);  // like a mapped file
+		std::memcpy(aligned.data(), bytes.data(), bytes.size());
+		const auto view = Chocobo1::BloomFilter<Chocobo1::SipHash>::view({reinterpret_cast<const uint8_t *>(aligned.data()), bytes.size()}, Chocobo1::SipHash(key));
+		REQUIRE(view.isValid());
+		REQUIRE(view.isView());
+		REQUIRE(view.itemCount() == 2000);
+		REQUIRE(std::all_of(members.begin(), (members.begin() + 2000), [&view](const std::string &member) { return view.contains(member); }));
+
+		const auto copy = view;  // copies of views are views
+		REQUIRE(copy.isView());
+		REQUIRE(copy.serialize() == bytes);
+
+		std::vector<uint8_t> corrupt = bytes;
+		corrupt[0] = 'X';
+		REQUIRE_FALSE(Chocobo1::BloomFilter<Chocobo1::SipHash>::load(corrupt, Chocobo1::SipHash(key)).isValid());
+		corrupt = bytes;
+		corrupt.pop_back();
+		REQUIRE_FALSE(Chocobo1::BloomFilter<Chocobo1::SipHash>::load(corrupt, Chocobo1::SipHash(key)).isValid());
+
+		auto cleared = loaded;
+		REQUIRE(cleared.clear().itemCount() == 0);
+		REQUIRE_FALSE(cleared.contains(members[0]));
+		REQUIRE(loaded.contains(members[0]));
+	}
+
+	REQUIRE_FALSE(Chocobo1::BloomFilter<Chocobo1::SipHash>(Chocobo1::SipHash(key), 0, 0.01).isValid());
+	REQUIRE_FALSE(Chocobo1::BloomFilter<Chocobo1::SipHash>(Chocobo1::SipHash(key), 100, 1.0).isValid());
+	REQUIRE_FALSE(Chocobo1::BloomFilter<Chocobo1::SipHash>(Chocobo1::SipHash(key), 100, 17).isValid());
+}
+
+TEST_CASE("count-min-sketch")  // NOLINT
+{
+	const uint8_t key[16] = {};
+	const std::vector<std::string> keys = makeKeys("cms", 1000);
+
+	// key i is seen (i % 10 + 1) times
+	Chocobo1::CountMinSketch<Chocobo1::SipHash> sketch(Chocobo1::SipHash(key), 0.001, 0.01);
+	REQUIRE(sketch.isValid());
+	REQUIRE(sketch.width() == 2719);
+	REQUIRE(sketch.depth() == 5);
+
+	std::vector<std::string> stream;
+	for (std::size_t i = 0; i < keys.size(); ++i)
+	{
+		for (std::size_t j = 0; j <= (i % 10); ++j)
+			stream.emplace_back(keys[i]);
+	}
+	sketch.addAll(stream);
+	REQUIRE(sketch.total() == stream.size());
+
+	std::vector<uint32_t> estimates(keys.size());
+	sketch.estimateAll(keys, estimates);
+	std::size_t exact = 0;
+	std::size_t beyondBound = 0;  // error above `epsilon * total`, with probability `delta`
+	for (std::size_t i = 0; i < keys.size(); ++i)
+	{
+		REQUIRE(estimates[i] == sketch.estimate(keys[i]));
+		REQUIRE(estimates[i] >= ((i % 10) + 1));
+		exact += (estimates[i] == ((i % 10) + 1)) ? 1 : 0;
+		beyondBound += (estimates[i] > ((i % 10) + 1 + (sketch.total() / 1000))) ? 1 : 0;
+	}
+	REQUIRE(exact > (keys.size() * 9 / 10));
+	REQUIRE(beyondBound <= (keys.size() * 2 / 100));
+
+	// merging, saturation & serialization
+	Chocobo1::CountMinSketch<Chocobo1::SipHash, uint8_t> small(Chocobo1::SipHash(key), 64, 3);
+	small.add(keys[0], 200).add(keys[0].data(), keys[0].size(), 100);
+	REQUIRE(small.estimate(keys[0]) == 255);
+
+	Chocobo1::CountMinSketch<Chocobo1::SipHash> other(Chocobo1::SipHash(key), sketch.width(), sketch.depth());
+	other.add(keys[1], 1000);
+	REQUIRE(sketch.merge(other));
+	REQUIRE(sketch.estimate(keys[1]) >= 1002);
+	REQUIRE_FALSE(sketch.merge(Chocobo1::CountMinSketch<Chocobo1::SipHash>(Chocobo1::SipHash(key), sketch.width(), 4)));
+
+	const std::vector<uint8_t> bytes = sketch.serialize();
+	const auto loaded = Chocobo1::CountMinSketch<Chocobo1::SipHash>::load(bytes, Chocobo1::SipHash(key));
+	REQUIRE(loaded.isValid());
+	REQUIRE(loaded.total() == sketch.total());
+	REQUIRE(loaded.estimate(keys[1]) == sketch.estimate(keys[1]));
+	REQUIRE_FALSE(Chocobo1::CountMinSketch<Chocobo1::SipHash, uint16_t>::load(bytes, Chocobo1::SipHash(key)).isValid());
+	REQUIRE_FALSE(Chocobo1::BloomFilter<Chocobo1::SipHash>::load(bytes, Chocobo1::SipHash(key)).isValid());
+
+	REQUIRE_FALSE(Chocobo1::CountMinSketch<Chocobo1::SipHash>(Chocobo1::SipHash(key), 0.0, 0.5).isValid());
+}
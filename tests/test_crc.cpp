@@ -0,0 +1,165 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/crc.h"
+#include "../src/crc_32.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+	template <typename T>
+	uint64_t check()
+	{
+		// the "check" column of the CRC catalogue
+		const char s[] = "123456789";
+		return T().addData(s, strlen(s)).finalize().toValue();
+	}
+
+	template <int Width, uint64_t Poly, uint64_t Init, bool RefIn, bool RefOut, uint64_t XorOut>
+	bool sameForAllSlices(const std::vector<uint8_t> &data)
+	{
+		const auto expected = Chocobo1::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, 1>().addData(data.data(), data.size()).finalize().toValue();
+		return (Chocobo1::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, 3>().addData(data.data(), data.size()).finalize().toValue() == expected)
+			&& (Chocobo1::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, 4>().addData(data.data(), data.size()).finalize().toValue() == expected)
+			&& (Chocobo1::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, 8>().addData(data.data(), data.size()).finalize().toValue() == expected)
+			&& (Chocobo1::Crc<Width, Poly, Init, RefIn, RefOut, XorOut, 16>().addData(data.data(), data.size()).finalize().toValue() == expected);
+	}
+
+	template <uint64_t Poly>
+	uint64_t bitwiseReflected64(const uint8_t *data, const std::size_t size)
+	{
+		// reference for the folding kernel: init & xorout all ones, as in CRC-64/XZ & CRC-64/NVME
+		const uint64_t poly = Chocobo1::Hash::CRC_NS::reflect<uint64_t>(Poly, 64);
+		uint64_t crc = ~static_cast<uint64_t>(0);
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			crc ^= data[i];
+			for (int j = 0; j < 8; ++j)
+				crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+		}
+		return ~crc;
+	}
+
+	template <typename T>
+	bool combines(const std::vector<uint8_t> &data, const std::size_t split)
+	{
+		const auto a = T().addData(data.data(), split).finalize().toValue();
+		const auto b = T().addData((data.data() + split), (data.size() - split)).finalize().toValue();
+		return (T::combine(a, b, (data.size() - split)) == T().addData(data.data(), data.size()).finalize().toValue());
+	}
+}
+
+TEST_CASE("crc")  // NOLINT
+{
+	// https://reveng.sourceforge.io/crc-catalogue/all.htm
+	REQUIRE(0xf4 == check<Chocobo1::CRC_8_SMBUS>());
+	REQUIRE(0xa1 == check<Chocobo1::CRC_8_MAXIM_DOW>());
+	REQUIRE(0xdf == check<Chocobo1::CRC_8_AUTOSAR>());
+	REQUIRE(0x26 == check<Chocobo1::CRC_8_BLUETOOTH>());
+
+	REQUIRE(0xbb3d == check<Chocobo1::CRC_16_ARC>());
+	REQUIRE(0x2189 == check<Chocobo1::CRC_16_KERMIT>());
+	REQUIRE(0x29b1 == check<Chocobo1::CRC_16_IBM_3740>());
+	REQUIRE(0x31c3 == check<Chocobo1::CRC_16_XMODEM>());
+	REQUIRE(0x906e == check<Chocobo1::CRC_16_IBM_SDLC>());
+	REQUIRE(0x4b37 == check<Chocobo1::CRC_16_MODBUS>());
+	REQUIRE(0xb4c8 == check<Chocobo1::CRC_16_USB>());
+
+	REQUIRE(0x21cf02 == check<Chocobo1::CRC_24_OPENPGP>());
+
+	REQUIRE(0xcbf43926 == check<Chocobo1::CRC_32_ISO_HDLC>());
+	REQUIRE(0xe3069283 == check<Chocobo1::CRC_32_ISCSI>());
+	REQUIRE(0xfc891918 == check<Chocobo1::CRC_32_BZIP2>());
+	REQUIRE(0x0376e6e7 == check<Chocobo1::CRC_32_MPEG_2>());
+	REQUIRE(0x765e7680 == check<Chocobo1::CRC_32_CKSUM>());
+
+	REQUIRE(0x6c40df5f0b497347 == check<Chocobo1::CRC_64_ECMA_182>());
+	REQUIRE(0x995dc9bbdf1939fa == check<Chocobo1::CRC_64_XZ>());
+	REQUIRE(0xb90956c775a41001 == check<Chocobo1::CRC_64_GO_ISO>());
+	REQUIRE(0xae8b14860a799888 == check<Chocobo1::CRC_64_NVME>());
+
+	// odd widths, non-symmetric init, `RefIn != RefOut`
+	REQUIRE(0x199 == check<Chocobo1::Crc<10, 0x233, 0x000, false, false, 0x000>>());  // CRC-10/ATM
+	REQUIRE(0xdaf == check<Chocobo1::Crc<12, 0x80f, 0x000, false, true, 0x000>>());  // CRC-12/UMTS
+	REQUIRE(0x63d0 == check<Chocobo1::Crc<16, 0x1021, 0xb2aa, true, true, 0x0000>>());  // CRC-16/RIELLO
+	REQUIRE(0xd4164fc646 == check<Chocobo1::Crc<40, 0x0004820009, 0x0000000000, false, false, 0xffffffffff>>());  // CRC-40/GSM
+
+	// my own tests
+	using Hash = Chocobo1::CRC_16_IBM_SDLC;
+
+	REQUIRE(Hash() == Hash());
+	REQUIRE(Hash().addData("123").finalize() != Hash().finalize());
+
+	REQUIRE("906e" == Hash().addData("123456789", 9).finalize().toString());
+	REQUIRE(std::vector<uint8_t> {0x90, 0x6e} == Hash().addData("123456789", 9).finalize().toVector());
+	REQUIRE("21cf02" == Chocobo1::CRC_24_OPENPGP().addData("123456789", 9).finalize().toString());
+
+	std::vector<uint8_t> data;
+	for (int i = 0; i < 100; ++i)
+	{
+		REQUIRE(sameForAllSlices<32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF>(data));
+		REQUIRE(sameForAllSlices<16, 0x1021, 0xFFFF, false, false, 0x0000>(data));
+		REQUIRE(sameForAllSlices<64, 0x42F0E1EBA9EA3693, 0x0, false, false, 0x0>(data));
+		REQUIRE(sameForAllSlices<8, 0x31, 0x00, true, true, 0x00>(data));
+		REQUIRE(sameForAllSlices<12, 0x80f, 0x000, false, true, 0x000>(data));
+		data.emplace_back(static_cast<uint8_t>((i * 131) ^ 0x5a));
+	}
+
+	Hash h1;
+	h1.addData(data.data(), 33).addData((data.data() + 33), (data.size() - 33));
+	REQUIRE(h1.finalize() == Hash().addData(data.data(), data.size()).finalize());
+
+	REQUIRE(Chocobo1::CRC_32().addData(data.data(), data.size()).finalize() == Chocobo1::CRC_32_ISO_HDLC().addData(data.data(), data.size()).finalize());
+
+	const unsigned char s16[] = {0x00, 0x0A};
+	const auto s16_1 = Hash().addData(s16, 2).finalize().toArray();
+	const auto s16_2 = Hash().addData(s16).finalize().toArray();
+	REQUIRE(s16_1 == s16_2);
+
+	std::vector<uint8_t> large;
+	for (int i = 0; i < 1500; ++i)
+		large.emplace_back(static_cast<uint8_t>((i * 167) ^ (i >> 3)));
+	for (std::size_t offset = 0; offset < 16; offset += 5)
+	{
+		for (std::size_t size = 0; (offset + size) <= large.size(); size += ((size < 300) ? 1 : 97))
+		{
+			const uint8_t *ptr = large.data() + offset;
+			REQUIRE(bitwiseReflected64<0x42F0E1EBA9EA3693>(ptr, size) == Chocobo1::CRC_64_XZ().addData(ptr, size).finalize().toValue());
+			REQUIRE(bitwiseReflected64<0xAD93D23594C93659>(ptr, size) == Chocobo1::CRC_64_NVME().addData(ptr, size).finalize().toValue());
+		}
+	}
+	REQUIRE(Chocobo1::CRC_64_XZ().addData(large.data(), 700).addData((large.data() + 700), 800).finalize()
+		== Chocobo1::CRC_64_XZ().addData(large.data(), large.size()).finalize());
+
+	for (const std::size_t split : {0, 1, 15, 64, 333, 1499, 1500})
+	{
+		REQUIRE(combines<Chocobo1::CRC_64_XZ>(large, split));
+		REQUIRE(combines<Chocobo1::CRC_64_NVME>(large, split));
+		REQUIRE(combines<Chocobo1::CRC_64_ECMA_182>(large, split));
+		REQUIRE(combines<Chocobo1::CRC_32>(large, split));
+		REQUIRE(combines<Chocobo1::CRC_16_IBM_3740>(large, split));
+		REQUIRE(combines<Chocobo1::CRC_8_MAXIM_DOW>(large, split));
+		REQUIRE(combines<Chocobo1::Crc<12, 0x80f, 0x000, false, true, 0x000>>(large, split));
+	}
+
+	REQUIRE(0x906e == std::hash<Hash> {}(Hash().addData("123456789", 9).finalize()));
+
+#if (__cplusplus >= 201703L)
+	constexpr uint8_t s17[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+	constexpr auto s17_1 = Chocobo1::CRC_64_XZ().addData(s17).finalize().toValue();
+	REQUIRE(0x995dc9bbdf1939fa == s17_1);
+#endif
+}
@@ -13,6 +13,7 @@
 
 #include "catch2/single_include/catch2/catch.hpp"
 
+#include <array>
 #include <cstring>
 
 
@@ -166,4 +167,19 @@ TEST_CASE("cshake-128")  // NOLINT
 	REQUIRE(h19.finalize().toVector() == h19_2.finalize().toVector());
 	h19 = std::move(h19_2);
 	REQUIRE(h19.finalize().toVector() == Hash::BaseType(1344 / 8).finalize().toVector());
+
+	std::array<uint8_t, 4> s20 {};
+	Hash((256 / 8), "", "Email Signature").addData(s1).finalize().toSpan(s20);
+	REQUIRE(s20 == std::array<uint8_t, 4> {0xc1, 0xc3, 0x69, 0x25});
+
+#if (__cpp_lib_constexpr_string >= 201907L)
+	constexpr auto s21 = []()
+	{
+		const uint8_t data[4] = {0, 1, 2, 3};
+		std::array<uint8_t, 4> ret {};
+		Hash((256 / 8), "", "Email Signature").addData(data).finalize().toSpan(ret);
+		return ret;
+	}();
+	REQUIRE(s21 == s20);
+#endif
 }
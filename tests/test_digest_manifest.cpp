@@ -0,0 +1,174 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/digest_manifest.h"
+#include "../src/mapped_file.h"
+#include "../src/md5.h"
+#include "../src/sha2_256.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	std::vector<uint8_t> digestOf(const std::string &path)
+	{
+		return Chocobo1::SHA2_256().addData(path.data(), path.size()).finalize().toVector();
+	}
+}
+
+TEST_CASE("digest-manifest")  // NOLINT
+{
+	using Chocobo1::DigestManifest;
+	using Chocobo1::DigestManifestBuilder;
+
+	// `sha256sum` text, both directions
+	{
+		const std::string text =
+			"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad  abc.txt\n"
+			"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855 *empty.bin\n"
+			"\n"
+			"\\ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad  dir/back\\\\slash\\nnewline\n"
+			"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015a  short digest\n"
+			"not a digest line\n"
+			"BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD  dir/with spaces  \n";
+
+		DigestManifestBuilder builder;
+		REQUIRE(builder.isValid());
+		REQUIRE(builder.addSumText(text) == 2);
+		REQUIRE(builder.size() == 4);
+
+		const std::vector<uint8_t> bytes = builder.serialize();
+		const DigestManifest manifest = DigestManifest::view(bytes);
+		REQUIRE(manifest.isValid());
+		REQUIRE(manifest.size() == 4);
+		REQUIRE(manifest.digestSize() == 32);
+		REQUIRE(manifest.algorithm() == "sha2-256");
+
+		REQUIRE(manifest.find("abc.txt") == 0);
+		REQUIRE(manifest.find("empty.bin") == 1);
+		REQUIRE(manifest.find("dir/back\\slash\nnewline") == 2);
+		REQUIRE(manifest.find("dir/with spaces  ") == 3);
+		REQUIRE(manifest.find("dir/with spaces") == DigestManifest::NOT_FOUND);
+		REQUIRE(manifest.find("missing") == DigestManifest::NOT_FOUND);
+
+		const auto record = manifest.record(1);
+		REQUIRE(record.pathString() == "empty.bin");
+		REQUIRE(record.binary);
+		REQUIRE(std::vector<uint8_t>(record.digest.begin(), record.digest.end()) == Chocobo1::SHA2_256().finalize().toVector());
+		REQUIRE(manifest.record(4).digest.empty());
+
+		const auto abc = Chocobo1::SHA2_256().addData("abc", 3).finalize().toVector();
+		REQUIRE(manifest.findDigest(abc) == 0);
+		REQUIRE(manifest.findAllDigest(abc) == std::vector<size_t>({0, 2, 3}));
+		REQUIRE(manifest.findDigest(digestOf("nothing")) == DigestManifest::NOT_FOUND);
+		REQUIRE(manifest.findDigest({abc.data(), 31}) == DigestManifest::NOT_FOUND);
+
+		REQUIRE(manifest.toSumText() ==
+			"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad  abc.txt\n"
+			"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855 *empty.bin\n"
+			"\\ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad  dir/back\\\\slash\\nnewline\n"
+			"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad  dir/with spaces  \n");
+	}
+
+	// many records, every lookup hits its own record
+	{
+		DigestManifestBuilder builder;
+		for (int i = 0; i < 20000; ++i)
+		{
+			const std::string path = "data/" + std::to_string(i % 100) + "/file" + std::to_string(i);
+			builder.add(path, digestOf(path));
+		}
+		REQUIRE(builder.add("data/0/file0", digestOf("duplicate")));
+
+		const std::vector<uint8_t> bytes = builder.serialize();
+		const DigestManifest manifest = DigestManifest::view(bytes);
+		REQUIRE(manifest.size() == 20001);
+
+		int matches = 0;
+		for (int i = 0; i < 20000; ++i)
+		{
+			const std::string path = "data/" + std::to_string(i % 100) + "/file" + std::to_string(i);
+			const auto index = static_cast<size_t>(i);
+			if ((manifest.find(path) == index) && (manifest.findDigest(digestOf(path)) == index))
+				++matches;
+		}
+		REQUIRE(matches == 20000);
+		REQUIRE(manifest.findDigest(digestOf("duplicate")) == 20000);
+	}
+
+	// other digest sizes, empty manifest
+	{
+		DigestManifestBuilder builder {"md5", 16};
+		const auto digest = Chocobo1::MD5().addData("abc", 3).finalize().toVector();
+		REQUIRE(builder.add("abc", digest));
+		REQUIRE_FALSE(builder.add("abc", digestOf("abc")));
+		const std::vector<uint8_t> bytes = builder.serialize();
+		REQUIRE(DigestManifest::view(bytes).findDigest(digest) == 0);
+		REQUIRE(DigestManifest::view(bytes).algorithm() == "md5");
+
+		const std::vector<uint8_t> empty = DigestManifestBuilder().serialize();
+		REQUIRE(empty.size() == (64 + 16));
+		REQUIRE(DigestManifest::view(empty).isValid());
+		REQUIRE(DigestManifest::view(empty).find("abc") == DigestManifest::NOT_FOUND);
+		REQUIRE(DigestManifest::view(empty).toSumText().empty());
+
+		REQUIRE_FALSE(DigestManifestBuilder("sha2-256", 0).isValid());
+		REQUIRE_FALSE(DigestManifestBuilder(std::string(24, 'a'), 32).isValid());
+		REQUIRE(DigestManifestBuilder("sha2-256", 0).serialize().empty());
+	}
+
+	// bad data
+	{
+		DigestManifestBuilder builder;
+		builder.add("abc", digestOf("abc"));
+		std::vector<uint8_t> bytes = builder.serialize();
+		REQUIRE(DigestManifest::view(bytes).isValid());
+
+		REQUIRE_FALSE(DigestManifest::view({bytes.data(), (bytes.size() - 1)}).isValid());
+		REQUIRE_FALSE(DigestManifest::view({bytes.data(), 63}).isValid());
+		REQUIRE_FALSE(DigestManifest().isValid());
+		REQUIRE(DigestManifest().find("abc") == DigestManifest::NOT_FOUND);
+
+		bytes[0] ^= 1;
+		REQUIRE_FALSE(DigestManifest::view(bytes).isValid());
+		bytes[0] ^= 1;
+
+		// a path outside of the string pool
+		bytes[64] = 0xFF;
+		const DigestManifest manifest = DigestManifest::view(bytes);
+		REQUIRE(manifest.isValid());
+		REQUIRE(manifest.record(0).digest.empty());
+		REQUIRE(manifest.find("abc") == DigestManifest::NOT_FOUND);
+	}
+
+	// from a mapped file
+	{
+		const std::string path = "chocobo1_hash_manifest_test.bin";
+		DigestManifestBuilder builder;
+		builder.add("abc", digestOf("abc"));
+		const std::vector<uint8_t> bytes = builder.serialize();
+		std::ofstream(path, std::ios_base::binary).write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+		{
+			const Chocobo1::MappedFile file(path);
+			const DigestManifest manifest = DigestManifest::view(file.data());
+			REQUIRE(manifest.find("abc") == 0);
+			REQUIRE(manifest.findDigest(digestOf("abc")) == 0);
+		}
+		std::remove(path.c_str());
+	}
+}
@@ -0,0 +1,175 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/fletcher.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+
+namespace
+{
+	std::vector<uint8_t> testData()
+	{
+		std::vector<uint8_t> data;
+		for (int i = 0; i < 12000; ++i)
+			data.emplace_back(static_cast<uint8_t>((i * 167) ^ (i >> 3)));
+		return data;
+	}
+
+	template <typename Hash>
+	bool combines(const std::vector<uint8_t> &data, const std::size_t split)
+	{
+		const auto a = Hash().addData(data.data(), split).finalize().toValue();
+		const auto b = Hash().addData((data.data() + split), (data.size() - split)).finalize().toValue();
+		return (Hash::combine(a, b, (data.size() - split)) == Hash().addData(data.data(), data.size()).finalize().toValue());
+	}
+
+	template <typename Hash>
+	typename Hash::ValueType wordwise(const uint8_t *data, const std::size_t size)
+	{
+		// reference for the SIMD kernels, one word & one modulo at a time
+		const int halfBits = std::numeric_limits<typename Hash::ValueType>::digits / 2;
+		const std::size_t wordBytes = static_cast<std::size_t>(halfBits / 8);
+		const uint64_t mod = (uint64_t(1) << halfBits) - 1;
+
+		uint64_t a = 0;
+		uint64_t b = 0;
+		for (std::size_t i = 0; i < size; i += wordBytes)
+		{
+			uint64_t word = 0;
+			for (std::size_t j = 0; (j < wordBytes) && ((i + j) < size); ++j)
+				word |= (uint64_t(data[i + j]) << (8 * j));
+			a = (a + word) % mod;
+			b = (b + a) % mod;
+		}
+		return static_cast<typename Hash::ValueType>((b << halfBits) | a);
+	}
+
+	template <typename Hash>
+	bool matchesWordwise(const std::vector<uint8_t> &data)
+	{
+		// every alignment & a run of sizes around the kernel block sizes
+		for (std::size_t offset = 0; offset < 32; offset += 7)
+		{
+			for (std::size_t size = 0; (offset + size) <= data.size(); size += ((size < 300) ? 1 : 1009))
+			{
+				const uint8_t *ptr = data.data() + offset;
+				if (wordwise<Hash>(ptr, size) != Hash().addData(ptr, size).finalize().toValue())
+					return false;
+			}
+		}
+
+		// largest sums: `a` & `b` at `MOD - 1` when the kernels start, then all bits set
+		std::vector<uint8_t> worst(300001, 0xFF);
+		worst[0] = 0xFE;
+		const std::size_t wordBytes = sizeof(typename Hash::ValueType) / 2;
+		Hash hash;
+		hash.addData(worst.data(), wordBytes).addData((worst.data() + wordBytes), (worst.size() - wordBytes));
+		return (wordwise<Hash>(worst.data(), worst.size()) == hash.finalize().toValue());
+	}
+
+	template <typename Hash>
+	bool splits(const std::vector<uint8_t> &data)
+	{
+		// byte at a time, so every partial word state is visited
+		Hash hash;
+		for (const uint8_t c : data)
+			hash.addData(&c, 1);
+		return (hash.finalize() == Hash().addData(data.data(), data.size()).finalize());
+	}
+}
+
+TEST_CASE("fletcher16")  // NOLINT
+{
+	using Hash = Chocobo1::Fletcher16;
+
+	// https://en.wikipedia.org/wiki/Fletcher%27s_checksum#Test_vectors
+	REQUIRE("0000" == Hash().finalize().toString());
+	REQUIRE(0xc8f0 == Hash().addData("abcde", 5).finalize().toValue());
+	REQUIRE(0x2057 == Hash().addData("abcdef", 6).finalize().toValue());
+	REQUIRE(0x0627 == Hash().addData("abcdefgh", 8).finalize().toValue());
+
+	// my own tests
+	const std::vector<uint8_t> data = testData();
+	REQUIRE("da5f" == Hash().addData(data.data(), data.size()).finalize().toString());
+	REQUIRE(splits<Hash>(data));
+	REQUIRE(matchesWordwise<Hash>(data));
+	for (const std::size_t split : {0, 1, 333, 11999, 12000})
+		REQUIRE(combines<Hash>(data, split));
+
+	REQUIRE(0xc8f0 == std::hash<Hash> {}(Hash().addData("abcde", 5).finalize()));
+}
+
+
+TEST_CASE("fletcher32")  // NOLINT
+{
+	using Hash = Chocobo1::Fletcher32;
+
+	// https://en.wikipedia.org/wiki/Fletcher%27s_checksum#Test_vectors
+	REQUIRE("00000000" == Hash().finalize().toString());
+	REQUIRE(0xf04fc729 == Hash().addData("abcde", 5).finalize().toValue());
+	REQUIRE(0x56502d2a == Hash().addData("abcdef", 6).finalize().toValue());
+	REQUIRE(0xebe19591 == Hash().addData("abcdefgh", 8).finalize().toValue());
+
+	// my own tests
+	REQUIRE(Hash() == Hash());
+	REQUIRE(Hash().addData("123").finalize() != Hash().finalize());
+
+	const std::vector<uint8_t> data = testData();
+	REQUIRE("016cff5f" == Hash().addData(data.data(), data.size()).finalize().toString());
+	REQUIRE(splits<Hash>(data));
+	REQUIRE(matchesWordwise<Hash>(data));
+	for (const std::size_t split : {0, 2, 334, 11998, 12000})
+		REQUIRE(combines<Hash>(data, split));
+
+	const std::vector<uint8_t> s1(100001, 0xFF);
+	REQUIRE(0x00ff00ff == Hash().addData(s1.data(), s1.size()).finalize().toValue());
+
+	const unsigned char s16[] = {0x00, 0x0A};
+	const auto s16_1 = Hash().addData(s16, 2).finalize().toArray();
+	const auto s16_2 = Hash().addData(s16).finalize().toArray();
+	REQUIRE(s16_1 == s16_2);
+
+	REQUIRE(0xf04fc729 == std::hash<Hash> {}(Hash().addData("abcde", 5).finalize()));
+
+#if (__cplusplus >= 201703L)
+	constexpr uint8_t s17[] = {'a', 'b', 'c', 'd', 'e'};
+	constexpr auto s17_1 = Hash().addData(s17).finalize().toValue();
+	REQUIRE(0xf04fc729 == s17_1);
+#endif
+}
+
+
+TEST_CASE("fletcher64")  // NOLINT
+{
+	using Hash = Chocobo1::Fletcher64;
+
+	// https://en.wikipedia.org/wiki/Fletcher%27s_checksum#Test_vectors
+	REQUIRE("0000000000000000" == Hash().finalize().toString());
+	REQUIRE(0xc8c6c527646362c6 == Hash().addData("abcde", 5).finalize().toValue());
+	REQUIRE(0xc8c72b276463c8c6 == Hash().addData("abcdef", 6).finalize().toValue());
+	REQUIRE(0x312e2b28cccac8c6 == Hash().addData("abcdefgh", 8).finalize().toValue());
+
+	// my own tests
+	const std::vector<uint8_t> data = testData();
+	REQUIRE("065ada1bbf803fdf" == Hash().addData(data.data(), data.size()).finalize().toString());
+	REQUIRE(splits<Hash>(data));
+	REQUIRE(matchesWordwise<Hash>(data));
+	for (const std::size_t split : {0, 4, 332, 11996, 12000})
+		REQUIRE(combines<Hash>(data, split));
+
+	const std::vector<uint8_t> s1(100001, 0xFF);
+	REQUIRE(0x000000ff000000ff == Hash().addData(s1.data(), s1.size()).finalize().toValue());
+}
@@ -0,0 +1,110 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/hash_chain.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <vector>
+
+
+namespace
+{
+	// straightforward chains with the regular hashers
+	std::vector<uint8_t> sha256Chain(std::vector<uint8_t> value, std::vector<uint8_t> tweak, const std::vector<uint8_t> &seed
+		, const uint32_t start, const uint32_t steps)
+	{
+		std::vector<uint8_t> block(64, 0);
+		std::copy(seed.begin(), seed.end(), block.begin());
+
+		for (uint32_t i = start; i < (start + steps); ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+				tweak[18 + j] = static_cast<uint8_t>(i >> (8 * (3 - j)));
+			const auto digest = Chocobo1::SHA2_256().addData(block.data(), block.size()).addData(tweak.data(), tweak.size())
+				.addData(value.data(), value.size()).finalize().toArray();
+			std::copy_n(digest.begin(), value.size(), value.begin());
+		}
+		return value;
+	}
+
+	std::vector<uint8_t> shake256Chain(std::vector<uint8_t> value, std::vector<uint8_t> tweak, const std::vector<uint8_t> &seed
+		, const uint32_t start, const uint32_t steps)
+	{
+		for (uint32_t i = start; i < (start + steps); ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+				tweak[28 + j] = static_cast<uint8_t>(i >> (8 * (3 - j)));
+			value = Chocobo1::SHAKE_256(static_cast<int>(value.size())).addData(seed.data(), seed.size()).addData(tweak.data(), tweak.size())
+				.addData(value.data(), value.size()).finalize().toVector();
+		}
+		return value;
+	}
+}
+
+TEST_CASE("hash-chain")  // NOLINT
+{
+	// SPHINCS+ like parameters: SHA2 with a 22-byte compressed address, SHAKE with a 32-byte address
+	const size_t chains = 67;
+	std::vector<uint8_t> seed(32);
+	for (size_t i = 0; i < seed.size(); ++i)
+		seed[i] = static_cast<uint8_t>(i * 3);
+
+	for (const int n : {16, 24, 32})
+	{
+		std::vector<uint32_t> starts(chains);
+		std::vector<uint32_t> steps(chains);
+		std::vector<uint8_t> values(chains * static_cast<size_t>(n));
+		std::vector<uint8_t> sha2Tweaks(chains * 22);
+		std::vector<uint8_t> shakeTweaks(chains * 32);
+		for (size_t c = 0; c < chains; ++c)
+		{
+			starts[c] = static_cast<uint32_t>(c % 5);
+			steps[c] = static_cast<uint32_t>((c * 7) % 16);  // includes empty chains
+			for (size_t i = 0; i < static_cast<size_t>(n); ++i)
+				values[(c * static_cast<size_t>(n)) + i] = static_cast<uint8_t>(c + i);
+			for (size_t i = 0; i < 22; ++i)
+				sha2Tweaks[(c * 22) + i] = static_cast<uint8_t>(c ^ (i * 11));
+			for (size_t i = 0; i < 32; ++i)
+				shakeTweaks[(c * 32) + i] = static_cast<uint8_t>(c ^ (i * 13));
+		}
+
+		std::vector<uint8_t> sha2Values = values;
+		Chocobo1::HashChain<Chocobo1::SHA2_256>({seed.data(), static_cast<size_t>(n)}, n, 22, 18).run(sha2Values, sha2Tweaks, starts, steps);
+
+		std::vector<uint8_t> shakeValues = values;
+		Chocobo1::HashChain<Chocobo1::SHAKE_256, 4>({seed.data(), static_cast<size_t>(n)}, n, 32, 28).run(shakeValues, shakeTweaks, starts, steps);
+
+		const std::vector<uint8_t> sha2Seed(seed.begin(), (seed.begin() + n));
+		for (size_t c = 0; c < chains; ++c)
+		{
+			const auto offset = static_cast<std::ptrdiff_t>(c * static_cast<size_t>(n));
+			const std::vector<uint8_t> value((values.begin() + offset), (values.begin() + offset + n));
+			const std::vector<uint8_t> sha2Tweak((sha2Tweaks.begin() + static_cast<std::ptrdiff_t>(c * 22)), (sha2Tweaks.begin() + static_cast<std::ptrdiff_t>((c + 1) * 22)));
+			const std::vector<uint8_t> shakeTweak((shakeTweaks.begin() + static_cast<std::ptrdiff_t>(c * 32)), (shakeTweaks.begin() + static_cast<std::ptrdiff_t>((c + 1) * 32)));
+
+			REQUIRE(std::vector<uint8_t>((sha2Values.begin() + offset), (sha2Values.begin() + offset + n))
+				== sha256Chain(value, sha2Tweak, sha2Seed, starts[c], steps[c]));
+			REQUIRE(std::vector<uint8_t>((shakeValues.begin() + offset), (shakeValues.begin() + offset + n))
+				== shake256Chain(value, shakeTweak, sha2Seed, starts[c], steps[c]));
+		}
+	}
+
+	// a single step, without step number
+	{
+		const uint8_t tweak[4] = {1, 2, 3, 4};
+		std::vector<uint8_t> value(32, 0xAA);
+		Chocobo1::HashChain<Chocobo1::SHAKE_128>(seed, 32, 4, -1).step(value, tweak, 5);
+
+		const std::vector<uint8_t> input(32, 0xAA);
+		REQUIRE(value == Chocobo1::SHAKE_128(32).addData(seed.data(), seed.size()).addData(tweak).addData(input.data(), input.size()).finalize().toVector());
+	}
+}
@@ -0,0 +1,154 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/blake2.h"
+#include "../src/hash_service.h"
+#include "../src/siphash.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <array>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+	struct ThrowingHasher
+	{
+		// throws on the second chunk
+		using Byte = uint8_t;
+		using ResultArrayType = std::array<Byte, 1>;
+		template <typename T>
+		using Span = Chocobo1::HashService::Span<T>;
+
+		ThrowingHasher& addData(const void *, std::size_t)
+		{
+			if (++chunks == 2)
+				throw std::runtime_error("hasher failed");
+			return (*this);
+		}
+		ThrowingHasher& finalize()
+		{
+			return (*this);
+		}
+		ResultArrayType toArray() const
+		{
+			return {static_cast<Byte>(chunks)};
+		}
+
+		int chunks = 0;
+	};
+}
+
+TEST_CASE("hash-service")  // NOLINT
+{
+	std::vector<std::vector<uint8_t>> data;
+	for (size_t i = 0; i < 100; ++i)
+	{
+		std::vector<uint8_t> d(i * 37);
+		for (size_t j = 0; j < d.size(); ++j)
+			d[j] = static_cast<uint8_t>(i + j);
+		data.emplace_back(d);
+	}
+
+	Chocobo1::HashServiceOptions options;
+	options.threads = 3;
+	options.queueCapacity = 4;  // forces producers to wait
+	options.pinThreads = true;
+	Chocobo1::HashService service(options);
+
+	// one-shot jobs, batchable & not
+	{
+		std::vector<std::future<Chocobo1::SHA2_256::ResultArrayType>> sha256;
+		std::vector<std::future<Chocobo1::MD5::ResultArrayType>> md5;
+		std::vector<std::future<Chocobo1::Blake2::ResultArrayType>> blake2;
+		for (const auto &d : data)
+		{
+			sha256.emplace_back(service.submit<Chocobo1::SHA2_256>(d));
+			md5.emplace_back(service.submit<Chocobo1::MD5>(std::vector<uint8_t>(d)));
+			blake2.emplace_back(service.submit<Chocobo1::Blake2>(d));
+		}
+
+		for (size_t i = 0; i < data.size(); ++i)
+		{
+			const auto &d = data[i];
+			REQUIRE(sha256[i].get() == Chocobo1::SHA2_256().addData(d.data(), d.size()).finalize().toArray());
+			REQUIRE(md5[i].get() == Chocobo1::MD5().addData(d.data(), d.size()).finalize().toArray());
+			REQUIRE(blake2[i].get() == Chocobo1::Blake2().addData(d.data(), d.size()).finalize().toArray());
+		}
+	}
+
+	// classes constructed with parameters
+	{
+		const uint8_t key[16] = {1, 2, 3};
+		const auto &d = data[10];
+		REQUIRE(service.submit(d, Chocobo1::SipHash(key)).get() == Chocobo1::SipHash(key).addData(d.data(), d.size()).finalize().toArray());
+
+		// a prototype holding prior input is honored for batchable algorithms too
+		Chocobo1::SHA2_256 prefixed;
+		prefixed.addData(data[3].data(), data[3].size());
+		const auto expected = Chocobo1::SHA2_256(prefixed).addData(d.data(), d.size()).finalize().toArray();
+		REQUIRE(service.submit(d, prefixed).get() == expected);
+		REQUIRE(service.submit(std::vector<uint8_t>(d), prefixed).get() == expected);
+	}
+
+	// a throwing job doesn't take down its worker
+	{
+		for (int i = 0; i < 6; ++i)
+			service.post([]() -> void { throw std::runtime_error("job failed"); });
+		std::promise<int> done;
+		service.post([&done]() -> void { done.set_value(1); });
+		REQUIRE(done.get_future().get() == 1);
+		REQUIRE(service.submit<Chocobo1::MD5>(data[5]).get() == Chocobo1::MD5().addData(data[5].data(), data[5].size()).finalize().toArray());
+	}
+
+	// streaming sessions
+	{
+		auto session1 = service.openSession<Chocobo1::SHA2_256>();
+		auto session2 = service.openSession<Chocobo1::Blake2>();
+		Chocobo1::SHA2_256 expected1;
+		Chocobo1::Blake2 expected2;
+		for (const auto &d : data)
+		{
+			session1.addData(d.data(), d.size());
+			session2.addData(d.data(), d.size());
+			expected1.addData(d.data(), d.size());
+			expected2.addData(d.data(), d.size());
+		}
+		auto result1 = session1.finalize();
+		auto result2 = session2.finalize();
+		REQUIRE(result1.get() == expected1.finalize().toArray());
+		REQUIRE(result2.get() == expected2.finalize().toArray());
+
+		REQUIRE(service.openSession<Chocobo1::MD5>().finalize().get() == Chocobo1::MD5().finalize().toArray());
+	}
+
+	// a throwing hasher fails the session instead of hanging it
+	{
+		const uint8_t chunk[3] = {};
+		auto session = service.openSession<ThrowingHasher>();
+		session.addData(chunk, sizeof(chunk));
+		session.addData(chunk, sizeof(chunk));
+		auto result = session.finalize();
+		REQUIRE_THROWS_AS(result.get(), std::runtime_error);
+
+		// chunks after the failure are dropped, whether or not the drain job has seen it yet
+		auto late = service.openSession<ThrowingHasher>();
+		late.addData(chunk, sizeof(chunk)).addData(chunk, sizeof(chunk)).addData(chunk, sizeof(chunk));
+		REQUIRE_THROWS_AS(late.finalize().get(), std::runtime_error);
+
+		auto fine = service.openSession<ThrowingHasher>();
+		fine.addData(chunk, sizeof(chunk));
+		REQUIRE(fine.finalize().get() == ThrowingHasher::ResultArrayType {1});
+	}
+}
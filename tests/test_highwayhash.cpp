@@ -0,0 +1,90 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/highwayhash.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <string>
+#include <vector>
+
+
+TEST_CASE("highwayhash")  // NOLINT
+{
+	using Hash64 = Chocobo1::HighwayHash64;
+	using Hash128 = Chocobo1::HighwayHash128;
+	using Hash256 = Chocobo1::HighwayHash256;
+
+	// test vectors from the reference implementation "highwayhash/highwayhash_test.cc"
+	// key = {0, 1, ..., 31}, data[i] = i
+	uint8_t key[32] = {};
+	for (int i = 0; i < 32; ++i)
+		key[i] = static_cast<uint8_t>(i);
+
+	std::vector<uint8_t> data(5000);
+	for (size_t i = 0; i < data.size(); ++i)
+		data[i] = static_cast<uint8_t>(i);
+
+	const char *expected64[] = {
+		"907a56de22c26e53", "7eab43aac7cddd78", "b8d0569ab0b53d62", "5c6befab8a463d80",
+		"f205a46893007eda", "2b8a1668e4a94541", "bd4ccc325befca6f", "4d02ae1738f59482",
+		"e1205108e55f3171", "32d2644ec77a1584", "f6e10acdb103a90b", "c3bbf4615b415c15",
+		"243cc2040063fa9c", "a89a58ce65e641ff", "24b031a348455a23", "40793f86a449f33b"};
+	for (size_t size = 0; size < (sizeof(expected64) / sizeof(expected64[0])); ++size)
+		REQUIRE(Hash64(key).addData(data.data(), size).finalize().toString() == expected64[size]);
+
+	REQUIRE(Hash128(key).finalize().toString() == "0fed268f9d8ffec733565e767f093e6f");
+	REQUIRE(Hash256(key).finalize().toString() == "dd44482ac2c874f5d946017313c7351fb3aebeccb98714ff41da233145751df4");
+
+	// my own tests
+	REQUIRE(Hash64(key) == Hash64(key));
+	REQUIRE(Hash64(key).addData("123").finalize() != Hash64(key).finalize());
+
+	const uint8_t zeroKey[32] = {};
+	REQUIRE(Hash64(zeroKey).finalize() != Hash64(key).finalize());
+
+	// one shot (AVX2 kernel when available) matches streaming a byte at a time (portable code),
+	// across every remainder length
+	for (const size_t size : {31, 32, 33, 47, 48, 63, 64, 65, 95, 100, 255, 256, 1000, 4999})
+	{
+		Hash64 h64(key);
+		Hash128 h128(key);
+		Hash256 h256(key);
+		for (size_t i = 0; i < size; ++i)
+		{
+			h64.addData(&data[i], 1);
+			h128.addData(&data[i], 1);
+			h256.addData(&data[i], 1);
+		}
+		REQUIRE(h64.finalize().toString() == Hash64(key).addData(data.data(), size).finalize().toString());
+		REQUIRE(h128.finalize().toString() == Hash128(key).addData(data.data(), size).finalize().toString());
+		REQUIRE(h256.finalize().toString() == Hash256(key).addData(data.data(), size).finalize().toString());
+
+		// uneven chunks
+		const size_t split = size / 3;
+		REQUIRE(Hash256(key).addData(data.data(), split).addData((data.data() + split), (size - split)).finalize().toArray()
+			== h256.toArray());
+	}
+
+	Hash128 hash(key);
+	hash.addData(data.data(), 100).finalize();
+	hash.reset();
+	REQUIRE(hash.finalize().toString() == "0fed268f9d8ffec733565e767f093e6f");
+	REQUIRE(hash.toVector().size() == 16);
+
+	const int s1[2] = {0};
+	const char s1_2[8] = {0};
+	REQUIRE(Hash64(key).addData(Hash64::Span<const int>(s1)).finalize().toString()
+			== Hash64(key).addData(s1_2).finalize().toString());
+
+	REQUIRE(0x907a56de22c26e53 == std::hash<Hash64> {}(Hash64(key).finalize()));
+	REQUIRE(0x0fed268f9d8ffec7 == static_cast<uint64_t>(Hash128(key).finalize()));
+}
@@ -0,0 +1,139 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/fnv.h"
+#include "../src/hyperloglog.h"
+#include "../src/siphash.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	// well mixed 64-bit values (SplitMix64), stands in for digests of distinct keys
+	uint64_t mix(uint64_t x)
+	{
+		x += 0x9E3779B97F4A7C15;
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EB;
+		return (x ^ (x >> 31));
+	}
+
+	double relativeError(const uint64_t estimate, const uint64_t actual)
+	{
+		return std::abs((static_cast<double>(estimate) / static_cast<double>(actual)) - 1);
+	}
+}
+
+TEST_CASE("hyperloglog")  // NOLINT
+{
+	const uint8_t key[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+	using HLL = Chocobo1::HyperLogLog<Chocobo1::SipHash>;
+
+	// keys, duplicates don't count
+	{
+		std::vector<std::string> users;
+		for (int i = 0; i < 1000; ++i)
+			users.emplace_back("user-" + std::to_string(i % 500));
+
+		HLL hll {Chocobo1::SipHash(key)};
+		REQUIRE(hll.isValid());
+		REQUIRE(hll.precision() == 14);
+		REQUIRE(hll.estimate() == 0);
+
+		hll.addAll(users);
+		REQUIRE(hll.isSparse());
+		REQUIRE(hll.estimate() == 500);
+
+		Chocobo1::HyperLogLog<Chocobo1::FNV64_1a> fnv(Chocobo1::FNV64_1a(), 12);
+		fnv.addAll(users).add(std::string("user-0")).add(users[1].data(), users[1].size());
+		REQUIRE(fnv.estimate() == 500);
+	}
+
+	// accuracy across the sparse & dense ranges
+	for (const int precision : {10, 14, 16})
+	{
+		HLL hll(Chocobo1::SipHash(key), precision);
+		uint64_t count = 0;
+		for (const uint64_t target : {100, 1000, 10000, 100000, 1000000})
+		{
+			for (; count < target; ++count)
+				hll.addHash(mix(count));
+
+			// 4 standard errors
+			const double bound = 4 * 1.04 / std::sqrt(std::pow(2.0, precision));
+			REQUIRE(relativeError(hll.estimate(), target) < bound);
+		}
+		REQUIRE_FALSE(hll.isSparse());
+	}
+
+	// merging shards equals one sketch over everything, in every representation
+	for (const uint64_t shardSize : {10, 1000, 100000})
+	{
+		HLL all {Chocobo1::SipHash(key)};
+		HLL merged {Chocobo1::SipHash(key)};
+		HLL smallFirst {Chocobo1::SipHash(key)};
+		smallFirst.addHash(mix(~uint64_t(0)));
+		all.addHash(mix(~uint64_t(0)));
+
+		for (uint64_t shard = 0; shard < 8; ++shard)
+		{
+			HLL part {Chocobo1::SipHash(key)};
+			for (uint64_t i = 0; i < (shardSize * (shard + 1)); ++i)
+			{
+				part.addHash(mix((shard << 40) + i));
+				all.addHash(mix((shard << 40) + i));
+			}
+			REQUIRE(merged.merge(part));
+			REQUIRE(smallFirst.merge(part));
+		}
+		REQUIRE(merged.merge(merged));
+		REQUIRE(smallFirst.serialize() == all.serialize());
+		REQUIRE(merged.estimate() <= all.estimate());
+		REQUIRE(relativeError(merged.estimate(), (shardSize * 36)) < 0.05);
+	}
+	REQUIRE_FALSE(HLL(Chocobo1::SipHash(key), 14).merge(HLL(Chocobo1::SipHash(key), 12)));
+
+	// serialization
+	for (const uint64_t size : {0, 5, 3000, 50000})
+	{
+		HLL hll(Chocobo1::SipHash(key), 12);
+		for (uint64_t i = 0; i < size; ++i)
+			hll.addHash(mix(i));
+
+		const std::vector<uint8_t> bytes = hll.serialize();
+		if (hll.isSparse())
+			REQUIRE(bytes.size() <= (8 + 5 + (4 * size)));  // deltas of sorted entries take under 4 bytes
+		else
+			REQUIRE(bytes.size() == (8 + 3072));
+
+		const HLL loaded = HLL::load(bytes, Chocobo1::SipHash(key));
+		REQUIRE(loaded.isValid());
+		REQUIRE(loaded.isSparse() == hll.isSparse());
+		REQUIRE(loaded.estimate() == hll.estimate());
+		REQUIRE(loaded.serialize() == bytes);
+
+		std::vector<uint8_t> corrupt = bytes;
+		corrupt.emplace_back(0);
+		REQUIRE_FALSE(HLL::load(corrupt, Chocobo1::SipHash(key)).isValid());
+		corrupt = bytes;
+		corrupt[5] = 30;
+		REQUIRE_FALSE(HLL::load(corrupt, Chocobo1::SipHash(key)).isValid());
+	}
+
+	REQUIRE_FALSE(HLL(Chocobo1::SipHash(key), 3).isValid());
+	REQUIRE_FALSE(HLL(Chocobo1::SipHash(key), 19).isValid());
+	REQUIRE(HLL(Chocobo1::SipHash(key)).addHash(1).clear().estimate() == 0);
+}
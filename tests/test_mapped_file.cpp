@@ -0,0 +1,58 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/mapped_file.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+
+
+TEST_CASE("mapped-file")  // NOLINT
+{
+	using Chocobo1::MappedFile;
+
+	const std::string path = "chocobo1_hash_mapped_file_test.bin";
+	std::string content;
+	for (int i = 0; i < 100000; ++i)
+		content += static_cast<char>(i * 7);
+	std::ofstream(path, std::ios_base::binary) << content;
+
+	{
+		const MappedFile file(path);
+		REQUIRE(file.isValid());
+		REQUIRE(file.size() == content.size());
+		REQUIRE(std::string(reinterpret_cast<const char *>(file.data().data()), file.size()) == content);
+
+		// moves keep the view
+		MappedFile moved = MappedFile(path);
+		MappedFile other = std::move(moved);
+		REQUIRE_FALSE(moved.isValid());  // NOLINT
+		REQUIRE(other.size() == content.size());
+		REQUIRE(std::string(reinterpret_cast<const char *>(other.data().data()), other.size()) == content);
+	}
+
+	// empty file
+	std::ofstream(path, (std::ios_base::binary | std::ios_base::trunc));
+	{
+		const MappedFile file(path);
+		REQUIRE(file.isValid());
+		REQUIRE(file.size() == 0);
+		REQUIRE(file.data().empty());
+	}
+
+	std::remove(path.c_str());
+	REQUIRE_FALSE(MappedFile(path).isValid());
+	REQUIRE_FALSE(MappedFile().isValid());
+}
@@ -77,4 +77,10 @@ TEST_CASE("md5")  // NOLINT
 			== Hash().addData(s17, sizeof(s17)).finalize().toString());
 
 	REQUIRE(0xd41d8cd98f00b204 == std::hash<Hash> {}(Hash().finalize()));
+
+#if (__cpp_consteval >= 201811L)
+	using namespace Chocobo1::Literals;
+	constexpr auto s18 = "The quick brown fox jumps over the lazy dog"_md5;
+	REQUIRE(s18 == Hash().addData("The quick brown fox jumps over the lazy dog", 43).finalize().toArray());
+#endif
 }
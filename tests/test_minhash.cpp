@@ -0,0 +1,148 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/minhash.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	using Bytes = Chocobo1::Hash::MinHash_NS::Span<const uint8_t>;
+
+	std::string toString(const Bytes span)
+	{
+		return {reinterpret_cast<const char *>(span.data()), static_cast<std::size_t>(span.size())};
+	}
+
+	std::vector<std::string> toStrings(const std::vector<Bytes> &spans)
+	{
+		std::vector<std::string> ret;
+		for (const Bytes span : spans)
+			ret.emplace_back(toString(span));
+		return ret;
+	}
+
+	std::string makeDocument(const int words, const int seed)
+	{
+		std::string ret;
+		for (int i = 0; i < words; ++i)
+			ret += "w" + std::to_string((i * 7919 + seed) % 5003) + " ";
+		return ret;
+	}
+
+	double jaccard(const std::vector<std::string> &left, const std::vector<std::string> &right)
+	{
+		const std::set<std::string> a(left.begin(), left.end());
+		const std::set<std::string> b(right.begin(), right.end());
+		std::size_t common = 0;
+		for (const std::string &s : a)
+			common += b.count(s);
+		return (static_cast<double>(common) / static_cast<double>(a.size() + b.size() - common));
+	}
+}
+
+TEST_CASE("minhash")  // NOLINT
+{
+	// shingling
+	{
+		const std::string text = "  the quick\tbrown  fox jumps ";
+		REQUIRE(toStrings(Chocobo1::shingles(text.data(), text.size(), 2))
+			== std::vector<std::string>({"the quick", "quick\tbrown", "brown  fox", "fox jumps"}));
+		REQUIRE(toStrings(Chocobo1::shingles(text.data(), text.size(), 9)) == std::vector<std::string>({"the quick\tbrown  fox jumps"}));
+		REQUIRE(toStrings(Chocobo1::shingles("abcde", 5, 3, Chocobo1::ShingleMode::Bytes)) == std::vector<std::string>({"abc", "bcd", "cde"}));
+		REQUIRE(toStrings(Chocobo1::shingles("ab", 2, 3, Chocobo1::ShingleMode::Bytes)) == std::vector<std::string>({"ab"}));
+		REQUIRE(Chocobo1::shingles(" \n ", 3, 2).empty());
+		REQUIRE(Chocobo1::shingles("", 0, 2, Chocobo1::ShingleMode::Bytes).empty());
+	}
+
+	// the lanes give the same values as `SipHash`, any length & count
+	{
+		const uint8_t key[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+		std::string text;
+		for (int i = 0; i < 2000; ++i)
+			text.push_back(static_cast<char>('a' + ((i * 37) % 26)));
+
+		std::vector<Bytes> pieces;
+		for (std::size_t i = 0; i < 300; ++i)
+			pieces.emplace_back((reinterpret_cast<const uint8_t *>(text.data()) + i), ((i * 13) % 41));
+
+		const std::vector<uint64_t> values = Chocobo1::ShingleHasher<Chocobo1::SipHash>(key).hash(pieces);
+		const std::vector<uint64_t> eightLanes = Chocobo1::ShingleHasher<Chocobo1::SipHash, 8>(key).hash(pieces);
+		std::size_t same = 0;
+		for (std::size_t i = 0; i < pieces.size(); ++i)
+		{
+			const uint64_t expected = Chocobo1::SipHash(key).addData(pieces[i]).finalize();
+			same += ((values[i] == expected) && (eightLanes[i] == expected)) ? 1 : 0;
+		}
+		REQUIRE(same == pieces.size());
+
+		const std::vector<uint64_t> fnv = Chocobo1::ShingleHasher<Chocobo1::FNV64_1a>(Chocobo1::FNV64_1a()).hash(pieces);
+		REQUIRE(fnv[1] == static_cast<uint64_t>(Chocobo1::FNV64_1a().addData(pieces[1]).finalize()));
+	}
+
+	// near duplicates: the estimates follow the Jaccard similarity
+	{
+		const uint8_t key[16] = {};
+		const Chocobo1::ShingleHasher<Chocobo1::SipHash> hasher(key);
+		const Chocobo1::MinHash minHash(256);
+
+		const std::string original = makeDocument(400, 1);
+		std::string edited = original;
+		edited.replace(1000, 200, makeDocument(30, 2));
+		const std::string unrelated = makeDocument(400, 3);
+
+		const auto originalShingles = Chocobo1::shingles(original.data(), original.size(), 3);
+		const auto editedShingles = Chocobo1::shingles(edited.data(), edited.size(), 3);
+		const auto unrelatedShingles = Chocobo1::shingles(unrelated.data(), unrelated.size(), 3);
+
+		const auto originalHashes = hasher.hash(originalShingles);
+		const auto editedHashes = hasher.hash(editedShingles);
+		const auto unrelatedHashes = hasher.hash(unrelatedShingles);
+
+		const auto a = minHash.signature(originalHashes);
+		const auto b = minHash.signature(editedHashes);
+		const auto c = minHash.signature(unrelatedHashes);
+		REQUIRE(a.size() == 256);
+		REQUIRE(Chocobo1::MinHash::similarity(a, a) == 1);
+
+		const double expected = jaccard(toStrings(originalShingles), toStrings(editedShingles));
+		REQUIRE(std::abs(Chocobo1::MinHash::similarity(a, b) - expected) < 0.1);
+		REQUIRE(Chocobo1::MinHash::similarity(a, c) < 0.05);
+
+		REQUIRE(Chocobo1::hammingDistance(Chocobo1::simHash(originalHashes), Chocobo1::simHash(editedHashes)) < 16);
+		REQUIRE(Chocobo1::hammingDistance(Chocobo1::simHash(originalHashes), Chocobo1::simHash(unrelatedHashes)) > 16);
+		const std::vector<double> weights(originalHashes.size(), 2.0);
+		REQUIRE(Chocobo1::simHash(originalHashes, weights) == Chocobo1::simHash(originalHashes));
+
+		// densification fills every bin of short documents
+		const std::vector<uint64_t> few = {hasher.hash(originalShingles).front(), originalHashes.back()};
+		const auto sparse = minHash.signature(few);
+		const uint64_t empty = Chocobo1::MinHash::EMPTY;
+		REQUIRE(std::all_of(sparse.begin(), sparse.end(), [&](const uint64_t v) { return ((v == few[0]) || (v == few[1])); }));
+		REQUIRE(minHash.signature(std::vector<uint64_t>()) == std::vector<uint64_t>(256, empty));
+
+		// LSH candidates
+		Chocobo1::LshIndex index(64, 4);
+		index.insert(1, a).insert(3, c);
+		REQUIRE(index.size() == 2);
+		REQUIRE(index.candidates(b) == std::vector<uint64_t>({1}));
+		REQUIRE(index.candidates(c) == std::vector<uint64_t>({3}));
+		index.clear();
+		REQUIRE(index.candidates(a).empty());
+	}
+}
@@ -0,0 +1,77 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/multi_buffer.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+	template <typename Hash, int Lanes>
+	void compareWithSingleLane()
+	{
+		using MultiHash = Chocobo1::MultiBuffer<Hash, Lanes>;
+		using Span = typename MultiHash::template Span<const uint8_t>;
+
+		// lengths around the block & padding boundaries, more messages than lanes
+		std::vector<std::vector<uint8_t>> data;
+		for (int len = 0; len < 300; len += 7)
+		{
+			std::vector<uint8_t> d(static_cast<size_t>(len));
+			for (size_t i = 0; i < d.size(); ++i)
+				d[i] = static_cast<uint8_t>((i * 31) + static_cast<size_t>(len));
+			data.emplace_back(d);
+		}
+		for (const int len : {55, 56, 63, 64, 65, 119, 120, 4096})
+			data.emplace_back(static_cast<size_t>(len), static_cast<uint8_t>('a'));
+
+		std::vector<Span> messages;
+		for (const auto &d : data)
+			messages.emplace_back(d.data(), d.size());
+
+		const auto results = MultiHash::hash(messages);
+		REQUIRE(results.size() == data.size());
+		for (size_t i = 0; i < data.size(); ++i)
+			REQUIRE(results[i] == Hash().addData(data[i].data(), data[i].size()).finalize().toArray());
+	}
+}
+
+TEST_CASE("multi-buffer")  // NOLINT
+{
+	compareWithSingleLane<Chocobo1::MD5, 1>();
+	compareWithSingleLane<Chocobo1::MD5, 8>();
+	compareWithSingleLane<Chocobo1::SHA1, 4>();
+	compareWithSingleLane<Chocobo1::SHA1, 8>();
+	compareWithSingleLane<Chocobo1::SHA2_256, 3>();
+	compareWithSingleLane<Chocobo1::SHA2_256, 8>();
+
+	using Hash = Chocobo1::MultiBuffer<Chocobo1::SHA2_256>;
+	using Span = Hash::Span<const uint8_t>;
+
+	REQUIRE(Hash::hash({}).empty());
+
+	const char s1[] = "abc";
+	const char s2[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+	const Span messages[] = {
+		{reinterpret_cast<const uint8_t *>(s1), strlen(s1)},
+		{reinterpret_cast<const uint8_t *>(s2), strlen(s2)},
+		{}
+	};
+	const auto results = Hash::hash(messages);
+	REQUIRE(results.size() == 3);
+	REQUIRE(Chocobo1::SHA2_256().addData(s1, strlen(s1)).finalize().toArray() == results[0]);
+	REQUIRE(Chocobo1::SHA2_256().addData(s2, strlen(s2)).finalize().toArray() == results[1]);
+	REQUIRE(Chocobo1::SHA2_256().finalize().toArray() == results[2]);
+}
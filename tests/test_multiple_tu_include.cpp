@@ -11,19 +11,36 @@
 
 // Test headers included in different Translation Units (TU) can be linked together successfully
 
+#include "../src/adler32.h"
+#include "../src/any_hasher.h"
+#include "../src/argon2.h"
+#include "../src/async_hash.h"
 #include "../src/blake1_224.h"
 #include "../src/blake1_256.h"
 #include "../src/blake1_384.h"
 #include "../src/blake1_512.h"
 #include "../src/blake2.h"
 #include "../src/blake2s.h"
+#include "../src/block_list_hash.h"
+#include "../src/bloom_filter.h"
+#include "../src/crc.h"
 #include "../src/crc_32.h"
 #include "../src/cshake.h"
+#include "../src/digest_manifest.h"
+#include "../src/fletcher.h"
 #include "../src/fnv.h"
 #include "../src/has_160.h"
+#include "../src/hash_chain.h"
+#include "../src/hash_service.h"
+#include "../src/highwayhash.h"
+#include "../src/hyperloglog.h"
+#include "../src/mapped_file.h"
 #include "../src/md2.h"
 #include "../src/md4.h"
 #include "../src/md5.h"
+#include "../src/minhash.h"
+#include "../src/multi_buffer.h"
+#include "../src/range_hash.h"
 #include "../src/ripemd_128.h"
 #include "../src/ripemd_160.h"
 #include "../src/ripemd_256.h"
@@ -39,5 +56,8 @@
 #include "../src/sha3.h"
 #include "../src/sm3.h"
 #include "../src/tiger.h"
+#include "../src/tree_digest.h"
 #include "../src/tuple_hash.h"
+#include "../src/value_hash.h"
+#include "../src/verity.h"
 #include "../src/whirlpool.h"
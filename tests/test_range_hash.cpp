@@ -0,0 +1,189 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#define USE_LIBSTDCXX_DEQUE_SEGMENTS_CHOCOBO1_HASH 1  // exercise the opt-in `std::deque` chunking
+#include "../src/range_hash.h"
+#include "../src/sha1.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <array>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if (__cpp_lib_ranges >= 201911L)
+#include <ranges>
+#endif
+
+
+namespace
+{
+	// counts how often it was fed, to see whether contiguous pieces are passed on as is
+	struct Counter
+	{
+		Counter& addData(const void *ptr, const std::size_t length)
+		{
+			++calls;
+			sha1.addData(ptr, length);
+			return *this;
+		}
+
+		Chocobo1::SHA1 sha1;
+		int calls = 0;
+	};
+
+	// `count` bytes of a pattern, produced on the fly
+	struct Generator
+	{
+		struct End {};
+
+		using iterator_category = std::input_iterator_tag;
+		using value_type = uint8_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const uint8_t *;
+		using reference = uint8_t;
+
+		uint8_t operator*() const { return static_cast<uint8_t>(index * 7); }
+		Generator& operator++() { ++index; return *this; }
+		friend bool operator!=(const Generator &it, End) { return (it.index != it.count); }
+
+		std::size_t index;
+		std::size_t count;
+	};
+
+	// two pieces, each contiguous
+	struct Rope
+	{
+		struct Iterator
+		{
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = char;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const char *;
+			using reference = const char &;
+
+			const char& operator*() const { return (pos < rope->left.size()) ? rope->left[pos] : rope->right[pos - rope->left.size()]; }
+			Iterator& operator++() { ++pos; return *this; }
+			Iterator& operator+=(const difference_type n) { pos += static_cast<std::size_t>(n); return *this; }
+			difference_type operator-(const Iterator &other) const { return static_cast<difference_type>(pos - other.pos); }
+			bool operator!=(const Iterator &other) const { return (pos != other.pos); }
+			bool operator==(const Iterator &other) const { return (pos == other.pos); }
+
+			const Rope *rope;
+			std::size_t pos;
+		};
+
+		Iterator begin() const { return {this, 0}; }
+		Iterator end() const { return {this, left.size() + right.size()}; }
+
+		std::string left;
+		std::string right;
+	};
+
+	std::string sha1(const std::string &str)
+	{
+		return Chocobo1::SHA1().addData(str.data(), str.size()).finalize().toString();
+	}
+}
+
+namespace Chocobo1
+{
+	template <>
+	struct RangeSegments<Rope::Iterator>
+	{
+		static constexpr bool IsSegmented = true;
+		static std::size_t contiguousLength(const Rope::Iterator &it)
+		{
+			const std::size_t leftSize = it.rope->left.size();
+			return (it.pos < leftSize) ? (leftSize - it.pos) : (leftSize + it.rope->right.size() - it.pos);
+		}
+	};
+}
+
+TEST_CASE("range-hash")  // NOLINT
+{
+	for (const size_t size : {0, 1, 511, 512, 513, 4096, 100000})
+	{
+		std::string flat(size, '\0');
+		for (size_t i = 0; i < size; ++i)
+			flat[i] = static_cast<char>((i * 31) ^ (i >> 7));
+		const std::string expected = sha1(flat);
+
+		const std::vector<char> vector(flat.begin(), flat.end());
+		const std::deque<char> deque(flat.begin(), flat.end());
+		const std::list<char> list(flat.begin(), flat.end());
+
+		Chocobo1::SHA1 hasher;
+		REQUIRE(Chocobo1::addRange(hasher, flat).finalize().toString() == expected);
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), vector.begin(), vector.end()).finalize().toString() == expected);
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), deque).finalize().toString() == expected);
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), deque.begin(), deque.end()).finalize().toString() == expected);
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), list).finalize().toString() == expected);
+
+		std::istringstream stream(flat);
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()).finalize().toString()
+			== expected);
+
+		// contiguous containers are fed in a single call
+		Counter counter;
+		Chocobo1::addRange(counter, vector);
+		REQUIRE(counter.calls == ((size > 0) ? 1 : 0));
+		REQUIRE(counter.sha1.finalize().toString() == expected);
+
+#if (USE_LIBSTDCXX_DEQUE_SEGMENTS_CHOCOBO1_HASH == 1) && defined(__GLIBCXX__)
+		// ... deques a chunk at a time
+		Counter dequeCounter;
+		Chocobo1::addRange(dequeCounter, deque.begin() + (size / 3), deque.end());
+		REQUIRE(dequeCounter.sha1.finalize().toString() == sha1(flat.substr(size / 3)));
+		REQUIRE(dequeCounter.calls <= static_cast<int>((size / 512) + 1));
+#endif
+
+		const Rope rope {flat.substr(0, (size / 2)), flat.substr(size / 2)};
+		Counter ropeCounter;
+		Chocobo1::addRange(ropeCounter, rope);
+		REQUIRE(ropeCounter.sha1.finalize().toString() == expected);
+		REQUIRE(ropeCounter.calls <= 2);
+	}
+
+	// generator with a sentinel, staged
+	{
+		std::string flat;
+		for (size_t i = 0; i < 10000; ++i)
+			flat.push_back(static_cast<char>(i * 7));
+
+		Counter counter;
+		Chocobo1::addRange(counter, Generator {0, 10000}, Generator::End {});
+		REQUIRE(counter.sha1.finalize().toString() == sha1(flat));
+		REQUIRE(counter.calls == ((10000 + 511) / 512));
+	}
+
+	// arrays
+	{
+		const uint8_t array[] = {'a', 'b', 'c'};
+		const std::array<uint8_t, 3> stdArray = {{'a', 'b', 'c'}};
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), array).finalize().toString() == sha1("abc"));
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), stdArray).finalize().toString() == sha1("abc"));
+	}
+
+#if (__cpp_lib_ranges >= 201911L)
+	{
+		auto lazy = std::views::iota(0, 3000) | std::views::transform([](const int i) { return static_cast<char>(i * 7); });
+		std::string flat;
+		for (const char c : lazy)
+			flat.push_back(c);
+		REQUIRE(Chocobo1::addRange(Chocobo1::SHA1(), lazy).finalize().toString() == sha1(flat));
+	}
+#endif
+}
@@ -250,6 +250,15 @@ TEST_CASE("sha3-256")  // NOLINT
 	REQUIRE(h19.finalize().toVector() == h19_2.finalize().toVector());
 	h19 = std::move(h19_2);
 	REQUIRE(h19.finalize().toVector() == Hash::BaseType(256 / 8).finalize().toVector());
+
+	const auto s20 = Hash().addData(s11, strlen(s11)).finalize().toArray();
+	REQUIRE(std::vector<uint8_t>(s20.begin(), s20.end()) == Hash().addData(s11, strlen(s11)).finalize().toVector());
+
+#if (__cpp_consteval >= 201811L)
+	using namespace Chocobo1::Literals;
+	constexpr auto s21 = "The quick brown fox jumps over the lazy dog"_sha3_256;
+	REQUIRE(s21 == s20);
+#endif
 }
 
 
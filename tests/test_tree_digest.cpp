@@ -0,0 +1,126 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/cshake.h"
+#include "../src/sha2_256.h"
+#include "../src/tree_digest.h"
+#include "../src/tuple_hash.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if (USE_STD_FILESYSTEM_CHOCOBO1_HASH == 1)
+#include <filesystem>
+#include <fstream>
+#endif
+
+
+namespace
+{
+	std::vector<uint8_t> toBytes(const std::string &str)
+	{
+		return {str.begin(), str.end()};
+	}
+}
+
+TEST_CASE("tree-digest")  // NOLINT
+{
+	using Hash = Chocobo1::TreeDigest<Chocobo1::SHA2_256>;
+
+	// empty tree
+	REQUIRE(Hash().finalize().toString() == Chocobo1::SHA2_256().finalize().toString());
+
+	// single leaf: H(0x00 || uint64_be(path size) || path || uint32_be(mode) || H(content))
+	{
+		const auto content = toBytes("hello");
+		const auto fileDigest = Chocobo1::SHA2_256().addData(content.data(), content.size()).finalize().toVector();
+
+		std::vector<uint8_t> leaf = {0x00, 0, 0, 0, 0, 0, 0, 0, 5, 'a', '.', 't', 'x', 't', 0, 0, 0x01, 0xa4};
+		leaf.insert(leaf.end(), fileDigest.begin(), fileDigest.end());
+		const auto expected = Chocobo1::SHA2_256().addData(leaf.data(), leaf.size()).finalize().toString();
+
+		REQUIRE(Hash().addFile("a.txt", content, 0644).finalize().toString() == expected);
+		REQUIRE(Hash().addEntry("a.txt", fileDigest, 0644).finalize().toString() == expected);
+	}
+
+	// independent of insertion order
+	const auto a = toBytes("aaa");
+	const auto b = toBytes("bbb");
+	const auto c = toBytes("ccc");
+	const std::string root = Hash().addFile("a", a).addFile("dir/b", b).addFile("dir/c", c).finalize().toString();
+	REQUIRE(Hash().addFile("dir/c", c).addFile("a", a).addFile("dir/b", b).finalize().toString() == root);
+
+	// paths, content and modes all matter
+	REQUIRE(Hash().addFile("a", a).addFile("dir/b", b).addFile("dir/d", c).finalize().toString() != root);
+	REQUIRE(Hash().addFile("a", a).addFile("dir/b", b).addFile("dir/c", a).finalize().toString() != root);
+	REQUIRE(Hash().addFile("a", a).addFile("dir/b", b).addFile("dir/c", c, 0755).finalize().toString() != root);
+
+	// odd node is promoted: root = H(0x01 || H(0x01 || l0 || l1) || l2)
+	{
+		const auto leaf = [](const std::string &path, const std::vector<uint8_t> &data) -> std::vector<uint8_t>
+		{
+			return Hash().addFile(path, data).finalize().toVector();
+		};
+		const auto node = [](const std::vector<uint8_t> &left, const std::vector<uint8_t> &right) -> std::vector<uint8_t>
+		{
+			std::vector<uint8_t> buf = {0x01};
+			buf.insert(buf.end(), left.begin(), left.end());
+			buf.insert(buf.end(), right.begin(), right.end());
+			return Chocobo1::SHA2_256().addData(buf.data(), buf.size()).finalize().toVector();
+		};
+		const auto expected = node(node(leaf("a", a), leaf("dir/b", b)), leaf("dir/c", c));
+		REQUIRE(Hash().addFile("a", a).addFile("dir/b", b).addFile("dir/c", c).finalize().toVector() == expected);
+	}
+
+	// reset
+	Hash hash;
+	hash.addFile("a", a).finalize();
+	hash.reset();
+	REQUIRE(hash.finalize().toString() == Hash().finalize().toString());
+
+	// classes without a default constructor or `addData()`
+	REQUIRE(Chocobo1::TreeDigest<Chocobo1::CSHAKE_128>(Chocobo1::CSHAKE_128(16)).addFile("a", a).finalize().toVector().size() == 16);
+	REQUIRE(Chocobo1::TreeDigest<Chocobo1::TupleHash_256>(Chocobo1::TupleHash_256(24)).addFile("a", a).finalize().toVector().size() == 24);
+}
+
+#if (USE_STD_FILESYSTEM_CHOCOBO1_HASH == 1)
+TEST_CASE("tree-digest directory")  // NOLINT
+{
+	namespace fs = std::filesystem;
+	using Hash = Chocobo1::TreeDigest<Chocobo1::SHA2_256>;
+
+	const fs::path dir = fs::temp_directory_path() / "chocobo1_hash_tree_digest_test";
+	fs::remove_all(dir);
+	fs::create_directories(dir / "sub" / "deeper");
+
+	Hash expected;
+	int fileCount = 0;
+	for (const char *name : {"x", "sub/y", "sub/deeper/z", "sub/w"})
+	{
+		std::string content;
+		for (int i = 0; i < (fileCount * 10000); ++i)
+			content += static_cast<char>('a' + (i % 26));
+		++fileCount;
+
+		std::ofstream(dir / name, std::ios_base::binary) << content;
+		expected.addFile(name, toBytes(content));
+	}
+
+	REQUIRE(Hash().addDirectory(dir).finalize().toString() == expected.finalize().toString());
+	REQUIRE(Hash().addDirectory(dir, false, 1).finalize().toString() == expected.toString());
+	REQUIRE(Hash().addDirectory(dir, true).finalize().toString() != expected.toString());
+
+	fs::remove_all(dir);
+}
+#endif
@@ -0,0 +1,163 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/crc_32.h"
+#include "../src/cshake.h"
+#include "../src/sha2_256.h"
+#include "../src/value_hash.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+	struct Record
+	{
+		uint32_t id;
+		uint8_t flags;  // followed by padding
+		uint64_t offset;
+		double weight;
+	};
+
+	enum class Color : uint16_t
+	{
+		Red = 0x0102
+	};
+
+	std::string sha256(const std::vector<uint8_t> &bytes)
+	{
+		return Chocobo1::SHA2_256().addData(bytes.data(), bytes.size()).finalize().toString();
+	}
+}
+
+TEST_CASE("value-hash")  // NOLINT
+{
+	using LE = Chocobo1::ValueHash<Chocobo1::SHA2_256>;
+	using BE = Chocobo1::ValueHash<Chocobo1::SHA2_256, Chocobo1::ByteOrder::Big>;
+
+	// nothing added
+	REQUIRE(LE().finalize().toString() == Chocobo1::SHA2_256().finalize().toString());
+
+	// scalar encodings
+	{
+		const std::vector<uint8_t> le = {
+			0x04, 0x03, 0x02, 0x01,
+			0xff, 0xff,
+			0x01,
+			0x02, 0x01,
+			0x00, 0x00, 0x80, 0x3f,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf,
+			0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01};
+		const std::vector<uint8_t> be = {
+			0x01, 0x02, 0x03, 0x04,
+			0xff, 0xff,
+			0x01,
+			0x01, 0x02,
+			0x3f, 0x80, 0x00, 0x00,
+			0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+
+		const auto add = [](auto &&hasher)
+		{
+			return hasher.addValue(uint32_t(0x01020304)).addValue(int16_t(-1)).addValue(true).addValue(Color::Red)
+				.addValue(1.0f).addValue(-1.0).addValue(uint64_t(0x0102030405060708)).finalize().toString();
+		};
+		REQUIRE(add(LE()) == sha256(le));
+		REQUIRE(add(BE()) == sha256(be));
+	}
+
+	// strings are length prefixed
+	{
+		const std::vector<uint8_t> expected = {0, 0, 0, 0, 0, 0, 0, 3, 'a', 'b', 'c', 0, 0, 0, 0, 0, 0, 0, 0};
+		REQUIRE(BE().addValue(std::string("abc")).addValue(std::string()).finalize().toString() == sha256(expected));
+	}
+
+	// batched arrays, across many buffer flushes, give the same digest as one value at a time
+	for (const size_t count : {0, 1, 127, 128, 129, 1000, 5000})
+	{
+		std::vector<uint32_t> values(count);
+		for (size_t i = 0; i < count; ++i)
+			values[i] = static_cast<uint32_t>((i * 0x9E3779B9) ^ (i >> 3));
+
+		LE le1;
+		BE be1;
+		std::vector<uint8_t> leBytes;
+		std::vector<uint8_t> beBytes;
+		for (const uint32_t v : values)
+		{
+			le1.addValue(v);
+			be1.addValue(v);
+			for (int i = 0; i < 4; ++i)
+			{
+				leBytes.push_back(static_cast<uint8_t>(v >> (8 * i)));
+				beBytes.push_back(static_cast<uint8_t>(v >> (8 * (3 - i))));
+			}
+		}
+
+		const auto leBatched = LE().addValues(values.data(), values.size()).finalize().toString();
+		const auto beBatched = BE().addValues(LE::Span<const uint32_t>(values.data(), values.size())).finalize().toString();
+		REQUIRE(leBatched == le1.finalize().toString());
+		REQUIRE(beBatched == be1.finalize().toString());
+		REQUIRE(leBatched == sha256(leBytes));
+		REQUIRE(beBatched == sha256(beBytes));
+	}
+
+	// tuples, pairs & arrays are their elements in order
+	{
+		const auto sequential = BE().addValue(uint8_t(1)).addValue(std::string("x")).addValue(int64_t(-2))
+			.addValue(uint16_t(3)).addValue(uint16_t(4)).addValue(1.5f).finalize().toString();
+
+		const auto nested = std::make_tuple(uint8_t(1), std::make_pair(std::string("x"), int64_t(-2)), std::array<uint16_t, 2> {{3, 4}}, 1.5f);
+		REQUIRE(BE().addValue(nested).finalize().toString() == sequential);
+	}
+
+	// members are hashed without padding bytes
+	{
+		Record r1 {};
+		Record r2 {};
+		std::memset(&r2, 0xAA, sizeof(r2));
+		r1.id = r2.id = 7;
+		r1.flags = r2.flags = 0x80;
+		r1.offset = r2.offset = 0x123456789;
+		r1.weight = r2.weight = 0.25;
+
+		const auto d1 = LE().addMembers(r1, &Record::id, &Record::flags, &Record::offset, &Record::weight).finalize().toString();
+		const auto d2 = LE().addMembers(r2, &Record::id, &Record::flags, &Record::offset, &Record::weight).finalize().toString();
+		REQUIRE(d1 == d2);
+		REQUIRE(d1 == LE().addValue(std::make_tuple(r1.id, r1.flags, r1.offset, r1.weight)).finalize().toString());
+	}
+
+	// raw data interleaved with values, reset
+	{
+		LE hasher;
+		hasher.addValue(uint16_t(0x0201)).addData("xyz", 3);
+		hasher.reset();
+		hasher.addValue(uint16_t(0x0201)).addData("xyz", 3);
+		REQUIRE(hasher.finalize().toString() == sha256({0x01, 0x02, 'x', 'y', 'z'}));
+	}
+
+	// other hashers
+	{
+		REQUIRE(Chocobo1::ValueHash<Chocobo1::CRC_32>().addValue(uint32_t(0x34333231)).addValues("56789", 5).finalize().toString()
+			== "cbf43926");
+
+		const uint8_t data[] = {0x01, 0x00, 0x00, 0x00};
+		const auto digest = Chocobo1::ValueHash<Chocobo1::CSHAKE_128>(Chocobo1::CSHAKE_128(32, "", "Email")).addValue(uint32_t(1)).finalize().toString();
+		REQUIRE(digest == Chocobo1::CSHAKE_128(32, "", "Email").addData(data).finalize().toString());
+	}
+}
@@ -0,0 +1,260 @@
+/*
+ *  Chocobo1/Hash
+ *
+ *   Copyright 2026 by Mike Tzou (Chocobo1)
+ *     https://github.com/Chocobo1/Hash
+ *
+ *   Licensed under GNU General Public License 3 or later.
+ *
+ *  @license GPL3 <https://www.gnu.org/licenses/gpl-3.0-standalone.html>
+ */
+
+#include "../src/verity.h"
+
+#include "catch2/single_include/catch2/catch.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+	std::vector<uint8_t> saltedHash(const std::vector<uint8_t> &salt, const uint8_t *data, const size_t size)
+	{
+		return Chocobo1::SHA2_256().addData(salt.data(), salt.size()).addData(data, size).finalize().toVector();
+	}
+
+	// builds the levels bottom up with the regular hasher, returns the root & the hash levels as `veritysetup --no-superblock` lays them out
+	std::vector<uint8_t> naiveTree(const std::vector<uint8_t> &image, const std::vector<uint8_t> &salt, const size_t dataBlockSize
+		, const size_t hashBlockSize, std::vector<uint8_t> &hashArea)
+	{
+		std::vector<std::vector<uint8_t>> levels;
+		std::vector<uint8_t> digests;
+		for (size_t i = 0; i < image.size(); i += dataBlockSize)
+		{
+			const auto digest = saltedHash(salt, (image.data() + i), dataBlockSize);
+			digests.insert(digests.end(), digest.begin(), digest.end());
+		}
+		if (digests.size() == 32)
+		{
+			hashArea.clear();
+			return digests;
+		}
+
+		while (true)
+		{
+			digests.resize(((digests.size() + hashBlockSize - 1) / hashBlockSize) * hashBlockSize, 0);
+			levels.push_back(digests);
+			if (digests.size() == hashBlockSize)
+				break;
+
+			std::vector<uint8_t> next;
+			for (size_t i = 0; i < digests.size(); i += hashBlockSize)
+			{
+				const auto digest = saltedHash(salt, (digests.data() + i), hashBlockSize);
+				next.insert(next.end(), digest.begin(), digest.end());
+			}
+			digests = next;
+		}
+
+		hashArea.clear();
+		for (auto it = levels.rbegin(); it != levels.rend(); ++it)
+			hashArea.insert(hashArea.end(), it->begin(), it->end());
+		return saltedHash(salt, levels.back().data(), hashBlockSize);
+	}
+
+	std::vector<uint8_t> makeImage(const size_t blocks, const size_t blockSize)
+	{
+		std::vector<uint8_t> image(blocks * blockSize);
+		for (size_t b = 0; b < blocks; ++b)
+		{
+			for (size_t i = 0; i < blockSize; ++i)
+				image[(b * blockSize) + i] = static_cast<uint8_t>((b * 31) + (i * 7));
+		}
+		return image;
+	}
+}
+
+TEST_CASE("verity")  // NOLINT
+{
+	using Chocobo1::VerityTree;
+	using Chocobo1::VerityVerifier;
+
+	std::vector<uint8_t> salt(40);
+	for (size_t i = 0; i < salt.size(); ++i)
+		salt[i] = static_cast<uint8_t>(i);
+
+	// reference values from an independent implementation of the `veritysetup format --salt=0001..27` layout, all zero uuid
+	{
+		const auto image = makeImage(300, 4096);
+
+		VerityTree tree {salt};
+		REQUIRE(tree.build(image).isValid());
+		REQUIRE(tree.dataBlocks() == 300);
+		REQUIRE(tree.rootHashString() == "f1a532edce0ce1ec1052042f422b4dda09dd51d2ad2903cf1aed47be067a25e1");
+		REQUIRE(tree.hashArea().size() == (5 * 4096));
+		REQUIRE(Chocobo1::SHA2_256().addData(tree.hashArea()).finalize().toString() == "755442f873156d4b9ad188957193c058f414773f76b0b7056a4cbba274e65c11");
+
+		const auto *superblock = tree.hashArea().data();
+		REQUIRE(std::string(reinterpret_cast<const char *>(superblock), 8) == std::string("verity\0\0", 8));
+		REQUIRE(std::string(reinterpret_cast<const char *>(superblock + 32)) == "sha256");
+		REQUIRE(superblock[72] == 44);  // data blocks: 300
+		REQUIRE(superblock[73] == 1);
+		REQUIRE(superblock[80] == salt.size());
+		REQUIRE(std::equal(salt.begin(), salt.end(), (superblock + 88)));
+
+		tree.setSuperblock(false);
+		REQUIRE(tree.build(image).rootHashString() == "f1a532edce0ce1ec1052042f422b4dda09dd51d2ad2903cf1aed47be067a25e1");
+		REQUIRE(Chocobo1::SHA2_256().addData(tree.hashArea()).finalize().toString() == "07b60f5bfbfb802e138c7a307ae3528a1902e4b46bd1f17b8004e7a749d1c661");
+	}
+
+	// against the straightforward construction: salt sizes across the 64-byte boundary, block sizes, level counts, threads
+	{
+		const size_t saltSizes[] = {0, 1, 63, 64, 65, 200, 256};
+		const size_t blockCounts[] = {1, 2, 7, 16, 17, 129, 300};
+		const std::pair<size_t, size_t> blockSizes[] = {{4096, 4096}, {512, 512}, {1024, 512}, {512, 2048}};
+
+		int matches = 0;
+		int total = 0;
+		for (const size_t saltSize : saltSizes)
+		{
+			std::vector<uint8_t> testSalt(saltSize);
+			for (size_t i = 0; i < saltSize; ++i)
+				testSalt[i] = static_cast<uint8_t>(0xA5 ^ i);
+
+			for (const size_t blocks : blockCounts)
+			{
+				for (const auto &sizes : blockSizes)
+				{
+					const auto image = makeImage(blocks, sizes.first);
+					std::vector<uint8_t> expectedArea;
+					const auto expectedRoot = naiveTree(image, testSalt, sizes.first, sizes.second, expectedArea);
+
+					VerityTree tree {testSalt, static_cast<uint32_t>(sizes.first), static_cast<uint32_t>(sizes.second)};
+					tree.setSuperblock(false).setThreads(static_cast<unsigned int>(1 + (blocks % 3)));
+					tree.build(image);
+
+					const auto area = tree.hashArea();
+					++total;
+					if (tree.isValid() && (tree.rootHash() == expectedRoot) && (std::vector<uint8_t>(area.begin(), area.end()) == expectedArea))
+						++matches;
+				}
+			}
+		}
+		REQUIRE(matches == total);
+	}
+
+	// bad parameters & images
+	{
+		REQUIRE_FALSE(VerityTree(salt, 4095).isValid());
+		REQUIRE_FALSE(VerityTree(salt, 4096, 256).isValid());
+		REQUIRE_FALSE(VerityTree(std::vector<uint8_t>(257)).isValid());
+
+		VerityTree tree {salt};
+		REQUIRE_FALSE(tree.build(std::vector<uint8_t>(4097)).isValid());
+		REQUIRE(tree.rootHash().empty());
+		REQUIRE_FALSE(tree.build(std::vector<uint8_t>()).isValid());
+		REQUIRE(tree.build(std::vector<uint8_t>(4096)).isValid());
+		REQUIRE(tree.rootHash() == saltedHash(salt, std::vector<uint8_t>(4096).data(), 4096));
+	}
+
+	// verifier
+	{
+		auto image = makeImage(20000, 4096);
+		const VerityTree tree = VerityTree(salt).build(image);
+		const auto rootHash = tree.rootHash();
+		auto hashArea = std::vector<uint8_t>(tree.hashArea().begin(), tree.hashArea().end());
+
+		VerityVerifier verifier {hashArea, rootHash};
+		REQUIRE(verifier.isValid());
+		REQUIRE(verifier.dataBlocks() == 20000);
+		REQUIRE(verifier.dataBlockSize() == 4096);
+		REQUIRE(verifier.verify(image, 0, 20000));
+		REQUIRE(verifier.setThreads(3).verify(image, 0, 20000));
+		REQUIRE(verifier.verify(image, 12345, 1000));
+		REQUIRE(verifier.verifyBlock(19999, {(image.data() + (19999 * 4096)), 4096}));
+
+		// out of range
+		REQUIRE_FALSE(verifier.verify(image, 20000));
+		REQUIRE_FALSE(verifier.verify(image, 19999, 2));
+		REQUIRE_FALSE(verifier.verify({image.data(), (4096 * 100)}, 99, 2));
+		REQUIRE_FALSE(verifier.verifyBlock(0, {image.data(), 4095}));
+
+		// a corrupted data block only fails the ranges that include it
+		image[(777 * 4096) + 5] ^= 1;
+		REQUIRE_FALSE(verifier.verify(image, 777));
+		REQUIRE_FALSE(verifier.verify(image, 0, 20000));
+		REQUIRE(verifier.verify(image, 0, 777));
+		REQUIRE(verifier.verify(image, 778, (20000 - 778)));
+		image[(777 * 4096) + 5] ^= 1;
+
+		// a corrupted level 0 hash block fails the data blocks it covers
+		const size_t level0 = (1 + 1 + 2) * 4096;  // superblock, top level, middle level
+		hashArea[level0 + (200 * 32)] ^= 1;
+		{
+			const VerityVerifier corrupted {hashArea, rootHash};
+			REQUIRE(corrupted.isValid());
+			REQUIRE_FALSE(corrupted.verify(image, 130));
+			REQUIRE_FALSE(corrupted.verify(image, 200));
+			REQUIRE(corrupted.verify(image, 0, 128));
+			REQUIRE(corrupted.verify(image, 256, 1000));
+		}
+		hashArea[level0 + (200 * 32)] ^= 1;
+
+		// wrong root hash
+		auto badRoot = rootHash;
+		badRoot[31] ^= 1;
+		REQUIRE_FALSE(VerityVerifier(hashArea, badRoot).verify(image, 0));
+
+		// bad superblock & sizes
+		REQUIRE_FALSE(VerityVerifier({hashArea.data(), (hashArea.size() - 1)}, rootHash).isValid());
+		REQUIRE_FALSE(VerityVerifier(hashArea, {rootHash.data(), 31}).isValid());
+		hashArea[32] = 'S';
+		REQUIRE_FALSE(VerityVerifier(hashArea, rootHash).isValid());
+		hashArea[32] = 's';
+		REQUIRE(VerityVerifier(hashArea, rootHash).isValid());
+
+		// without the superblock
+		const VerityTree plainTree = VerityTree(salt, 4096, 1024).setSuperblock(false).build(image);
+		const VerityVerifier plainVerifier {plainTree.hashArea(), plainTree.rootHash(), 20000, salt, 4096, 1024};
+		REQUIRE(plainVerifier.isValid());
+		REQUIRE(plainVerifier.verify(image, 0, 20000));
+		REQUIRE_FALSE(VerityVerifier(plainTree.hashArea(), plainTree.rootHash(), 20001, salt, 4096, 1024).isValid());
+	}
+
+	// single block image: no hash levels
+	{
+		const auto image = makeImage(1, 4096);
+		const VerityTree tree = VerityTree(salt).build(image);
+		REQUIRE(tree.hashArea().size() == 4096);
+
+		const VerityVerifier verifier {tree.hashArea(), tree.rootHash()};
+		REQUIRE(verifier.verify(image, 0));
+
+		auto corrupted = image;
+		corrupted[4095] ^= 1;
+		REQUIRE_FALSE(verifier.verify(corrupted, 0));
+	}
+
+	// from a file
+	{
+		const std::string path = "chocobo1_hash_verity_test.img";
+		const auto image = makeImage(300, 4096);
+		std::ofstream(path, std::ios_base::binary).write(reinterpret_cast<const char *>(image.data()), static_cast<std::streamsize>(image.size()));
+
+		VerityTree tree {salt};
+		REQUIRE(tree.buildFile(path).isValid());
+		REQUIRE(tree.rootHashString() == "f1a532edce0ce1ec1052042f422b4dda09dd51d2ad2903cf1aed47be067a25e1");
+
+		const Chocobo1::MappedFile file(path);
+		REQUIRE(VerityVerifier(tree.hashArea(), tree.rootHash()).verify(file.data(), 0, 300));
+
+		std::remove(path.c_str());
+		REQUIRE_FALSE(tree.buildFile(path).isValid());
+		REQUIRE(tree.hashArea().empty());
+	}
+}